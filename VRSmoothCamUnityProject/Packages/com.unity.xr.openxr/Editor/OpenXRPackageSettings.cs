@@ -0,0 +1,149 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor.XR.OpenXR.Features;
+using UnityEditor.Build;
+using UnityEngine;
+using UnityEngine.XR.Management;
+using UnityEngine.XR.OpenXR;
+
+namespace UnityEditor.XR.OpenXR
+{
+    [XRConfigurationData("OpenXR", Constants.k_SettingsKey)]
+    internal class OpenXRPackageSettings : ScriptableObject, ISerializationCallbackReceiver, IPackageSettings
+    {
+        [SerializeField]
+        List<BuildTargetGroup> Keys = new List<BuildTargetGroup>();
+        [SerializeField]
+        List<OpenXRSettings> Values = new List<OpenXRSettings>();
+
+        Dictionary<BuildTargetGroup, OpenXRSettings> Settings = new Dictionary<BuildTargetGroup, OpenXRSettings>();
+
+
+        public static OpenXRPackageSettings Instance
+        {
+            get
+            {
+                OpenXRPackageSettings ret = null;
+                EditorBuildSettings.TryGetConfigObject(Constants.k_SettingsKey, out ret);
+                if (ret == null)
+                {
+                    string searchText = String.Format("t:OpenXRPackageSettings");
+                    string[] assets = AssetDatabase.FindAssets(searchText);
+                    if (assets.Length > 0)
+                    {
+                        string path = AssetDatabase.GUIDToAssetPath(assets[0]);
+                        ret = AssetDatabase.LoadAssetAtPath(path, typeof(OpenXRPackageSettings)) as OpenXRPackageSettings;
+                        EditorBuildSettings.AddConfigObject(Constants.k_SettingsKey, ret, true);
+                        // Can't modify EditorBuildSettings once a build has already started - it won't get picked up
+                        // Not sure how to gracefully fix this, for now fail the build so there are now surprises.
+                        if (BuildPipeline.isBuildingPlayer)
+                            throw new BuildFailedException(
+                                "OpenXR Settings found in project but not yet loaded.  Please build again.");
+                    }
+                }
+                return ret;
+            }
+        }
+
+        public static OpenXRPackageSettings GetOrCreateInstance()
+        {
+            if (Instance != null)
+                return Instance;
+
+            OpenXRPackageSettings settings = ScriptableObject.CreateInstance<OpenXRPackageSettings>();
+            if (settings != null)
+            {
+                string newAssetName = String.Format("OpenXR Package Settings.asset");
+                string assetPath = GetAssetPathForComponents(s_DefaultSettingsPath);
+                if (!string.IsNullOrEmpty(assetPath))
+                {
+                    assetPath = Path.Combine(assetPath, newAssetName);
+                    AssetDatabase.CreateAsset(settings, assetPath);
+                    EditorBuildSettings.AddConfigObject(Constants.k_SettingsKey, settings, true);
+                }
+            }
+            return settings;
+        }
+
+        private static readonly string[] s_DefaultSettingsPath = {"XR","Settings"};
+        private static string GetAssetPathForComponents(string[] pathComponents, string root = "Assets")
+        {
+            if (pathComponents.Length <= 0)
+                return null;
+
+            string path = root;
+            foreach( var pc in pathComponents)
+            {
+                string subFolder = Path.Combine(path, pc);
+                bool shouldCreate = true;
+                foreach (var f in AssetDatabase.GetSubFolders(path))
+                {
+                    if (String.Compare(Path.GetFullPath(f), Path.GetFullPath(subFolder), true) == 0)
+                    {
+                        shouldCreate = false;
+                        break;
+                    }
+                }
+
+                if (shouldCreate)
+                    AssetDatabase.CreateFolder(path, pc);
+                path = subFolder;
+            }
+
+            return path;
+        }
+
+        public string GetActiveLoaderLibraryPath()
+        {
+            return OpenXRChooseRuntimeLibraries.GetLoaderLibraryPath();
+        }
+
+        public OpenXRSettings GetSettingsForBuildTargetGroup(BuildTargetGroup buildTargetGroup)
+        {
+            OpenXRSettings ret = null;
+            Settings.TryGetValue(buildTargetGroup, out ret);
+            if (ret == null)
+            {
+                ret = ScriptableObject.CreateInstance<OpenXRSettings>();
+                if (Settings.ContainsKey(buildTargetGroup))
+                {
+                    Settings[buildTargetGroup] = ret;
+                }
+                else
+                {
+                    Settings.Add(buildTargetGroup, ret);
+                }
+
+                ret.name = buildTargetGroup.ToString();
+
+                AssetDatabase.AddObjectToAsset(ret, this);
+            }
+
+            return ret;
+        }
+
+        /// <summary>Pre-serialization action</summary>
+        public void OnBeforeSerialize()
+        {
+            Keys.Clear();
+            Values.Clear();
+
+            foreach (var kv in Settings)
+            {
+                Keys.Add(kv.Key);
+                Values.Add(kv.Value);
+            }
+        }
+
+        /// <summary>Post-deserialization action</summary>
+        public void OnAfterDeserialize()
+        {
+            Settings = new Dictionary<BuildTargetGroup, OpenXRSettings>();
+            for (int i = 0; i < Math.Min(Keys.Count, Values.Count); i++)
+            {
+                Settings.Add(Keys[i], Values[i]);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "openxr/openxr.h"
+
+// This data was dumped from vive index.
+
+uint32_t s_VisibilityMaskVerticesSizes[2][3] =
+    {
+        // first view
+        {
+            // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+            99,
+            // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+            0,
+            // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+            0,
+        },
+        // second view
+        {
+            // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+            99,
+            // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+            0,
+            // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+            0,
+        }};
+
+uint32_t s_VisibilityMaskIndicesSizes[2][3] =
+    {
+        // first view
+        {
+            // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+            99,
+            // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+            0,
+            // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+            0,
+        },
+        // second view
+        {
+            // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+            99,
+            // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+            0,
+            // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+            0,
+        }};
+
+// clang-format off
+XrVector2f s_VisibilityMaskVertices[2][3][99] = 
+{
+    // first view
+    {
+        // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+        { { 1.052831f, -0.000900f }, { 1.052831f, -0.407369f }, { 0.915293f, -0.407369f }, { 1.052831f, -0.000900f }, { 0.915293f, -0.407369f }, { 0.902318f, -0.158971f }, { 1.052831f, -0.000900f }, { 0.902318f, -0.158971f }, { 0.899723f, 0.086603f }, { 1.052831f, -0.000900f }, { 0.899723f, 0.086603f }, { 0.912698f, 0.318065f }, { 1.052831f, -0.000900f }, { 0.912698f, 0.318065f }, { 0.930864f, 0.557994f }, { 1.052831f, -0.000900f }, { 0.930864f, 0.557994f }, { 1.052831f, 0.557994f }, { 1.052831f, 1.410448f }, { 1.052831f, 0.557994f }, { 0.936054f, 0.557994f }, { 1.052831f, 1.410448f }, { 0.936054f, 0.557994f }, { 0.829657f, 0.809214f }, { 1.052831f, 1.410448f }, { 0.829657f, 0.809214f }, { 0.653193f, 1.046320f }, { 1.052831f, 1.410448f }, { 0.653193f, 1.046320f }, { 0.458564f, 1.212859f }, { 1.052831f, 1.410448f }, { 0.458564f, 1.212859f }, { 0.196464f, 1.345526f }, { 1.052831f, 1.410448f }, { 0.196464f, 1.345526f }, { -0.086397f, 1.410448f }, { -1.542221f, 1.410448f }, { -0.460084f, 1.410448f }, { -0.779276f, 1.311654f }, { -1.542221f, 1.410448f }, { -0.779276f, 1.311654f }, { -1.043971f, 1.139469f }, { -1.542221f, 1.410448f }, { -1.043971f, 1.139469f }, { -1.207459f, 0.984221f }, { -1.542221f, 1.410448f }, { -1.207459f, 0.984221f }, { -1.357972f, 0.758405f }, { -1.542221f, 1.410448f }, { -1.357972f, 0.758405f }, { -1.433229f, 0.543880f }, { -1.542221f, 1.410448f }, { -1.433229f, 0.543880f }, { -1.542221f, 0.543880f }, { -1.542221f, -0.031950f }, { -1.542221f, 0.543880f }, { -1.433229f, 0.543880f }, { -1.542221f, -0.031950f }, { -1.433229f, 0.543880f }, { -1.415063f, 0.207979f }, { -1.542221f, -0.031950f }, { -1.415063f, 0.207979f }, { -1.409873f, 0.007568f }, { -1.542221f, -0.031950f }, { -1.409873f, 0.007568f }, { -1.417658f, -0.136390f }, { -1.542221f, -0.031950f }, { -1.417658f, -0.136390f }, { -1.430634f, -0.336801f }, { -1.542221f, -0.031950f }, { -1.430634f, -0.336801f }, { -1.441014f, -0.537213f }, { -1.542221f, -0.031950f }, { -1.441014f, -0.537213f }, { -1.542221f, -0.537213f }, { -1.542221f, -1.412249f }, { -1.542221f, -0.537213f }, { -1.441014f, -0.537213f }, { -1.542221f, -1.412249f }, { -1.441014f, -0.537213f }, { -1.319046f, -0.819482f }, { -1.542221f, -1.412249f }, { -1.319046f, -0.819482f }, { -1.095872f, -1.096107f }, { -1.542221f, -1.412249f }, { -1.095872f, -1.096107f }, { -0.810416f, -1.288050f }, { -1.542221f, -1.412249f }, { -0.810416f, -1.288050f }, { -0.408183f, -1.412249f }, { 1.052831f, -1.412249f }, { -0.083802f, -1.412249f }, { 0.406663f, -1.254178f }, { 1.052831f, -1.412249f }, { 0.406663f, -1.254178f }, { 0.915293f, -0.407369f }, { 1.052831f, -1.412249f }, { 0.915293f, -0.407369f }, { 1.052831f, -0.407369f }, }, // 99
+        // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+        { }, // 0
+        // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+        { }, // 0
+    },
+    // second view
+    {
+        // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+        { { -1.055433f, 0.002549f }, { -1.055433f, -0.404238f }, { -0.917752f, -0.404238f }, { -1.055433f, 0.002549f }, { -0.917752f, -0.404238f }, { -0.904763f, -0.155646f }, { -1.055433f, 0.002549f }, { -0.904763f, -0.155646f }, { -0.902165f, 0.090121f }, { -1.055433f, 0.002549f }, { -0.902165f, 0.090121f }, { -0.915154f, 0.321764f }, { -1.055433f, 0.002549f }, { -0.915154f, 0.321764f }, { -0.933338f, 0.561881f }, { -1.055433f, 0.002549f }, { -0.933338f, 0.561881f }, { -1.055433f, 0.561881f }, { -1.055433f, 1.415004f }, { -1.055433f, 0.561881f }, { -0.938534f, 0.561881f }, { -1.055433f, 1.415004f }, { -0.938534f, 0.561881f }, { -0.832026f, 0.813298f }, { -1.055433f, 1.415004f }, { -0.832026f, 0.813298f }, { -0.655378f, 1.050591f }, { -1.055433f, 1.415004f }, { -0.655378f, 1.050591f }, { -0.460546f, 1.217261f }, { -1.055433f, 1.415004f }, { -0.460546f, 1.217261f }, { -0.198173f, 1.350031f }, { -1.055433f, 1.415004f }, { -0.198173f, 1.350031f }, { 0.084983f, 1.415004f }, { 1.542325f, 1.415004f }, { 0.459060f, 1.415004f }, { 0.778584f, 1.316133f }, { 1.542325f, 1.415004f }, { 0.778584f, 1.316133f }, { 1.043556f, 1.143813f }, { 1.542325f, 1.415004f }, { 1.043556f, 1.143813f }, { 1.207214f, 0.988443f }, { 1.542325f, 1.415004f }, { 1.207214f, 0.988443f }, { 1.357885f, 0.762450f }, { 1.542325f, 1.415004f }, { 1.357885f, 0.762450f }, { 1.433219f, 0.547757f }, { 1.542325f, 1.415004f }, { 1.433219f, 0.547757f }, { 1.542325f, 0.547757f }, { 1.542325f, -0.028525f }, { 1.542325f, 0.547757f }, { 1.433219f, 0.547757f }, { 1.542325f, -0.028525f }, { 1.433219f, 0.547757f }, { 1.415035f, 0.211592f }, { 1.542325f, -0.028525f }, { 1.415035f, 0.211592f }, { 1.409840f, 0.011024f }, { 1.542325f, -0.028525f }, { 1.409840f, 0.011024f }, { 1.417633f, -0.133047f }, { 1.542325f, -0.028525f }, { 1.417633f, -0.133047f }, { 1.430622f, -0.333615f }, { 1.542325f, -0.028525f }, { 1.430622f, -0.333615f }, { 1.441013f, -0.534184f }, { 1.542325f, -0.028525f }, { 1.441013f, -0.534184f }, { 1.542325f, -0.534184f }, { 1.542325f, -1.409906f }, { 1.542325f, -0.534184f }, { 1.441013f, -0.534184f }, { 1.542325f, -1.409906f }, { 1.441013f, -0.534184f }, { 1.318918f, -0.816675f }, { 1.542325f, -1.409906f }, { 1.318918f, -0.816675f }, { 1.095511f, -1.093516f }, { 1.542325f, -1.409906f }, { 1.095511f, -1.093516f }, { 0.809757f, -1.285610f }, { 1.542325f, -1.409906f }, { 0.809757f, -1.285610f }, { 0.407105f, -1.409906f }, { -1.055433f, -1.409906f }, { 0.082385f, -1.409906f }, { -0.408591f, -1.251711f }, { -1.055433f, -1.409906f }, { -0.408591f, -1.251711f }, { -0.917752f, -0.404238f }, { -1.055433f, -1.409906f }, { -0.917752f, -0.404238f }, { -1.055433f, -0.404238f }, }, // 99
+        // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+        { }, // 0
+        // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+        { }, // 0
+    }
+};
+
+uint32_t s_VisibilityMaskIndices[2][3][99] = 
+{
+    // first view
+    {
+        // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,  }, // 99
+        // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+        { }, // 0
+        // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+        { }, // 0
+    },
+    // second view
+    {
+        // XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR
+        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,  }, // 99
+        // XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR
+        { }, // 0
+        // XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR
+        { }, // 0
+    }
+};
\ No newline at end of file
@@ -0,0 +1,667 @@
+using System.Linq;
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnityEngine.Serialization;
+using UnityEngine.InputSystem;
+using UnityEngine.InputSystem.LowLevel;
+using UnityEngine.InputSystem.Utilities;
+#if UNITY_EDITOR
+using UnityEditor;
+using UnityEditor.XR.OpenXR;
+#endif
+
+[assembly:InternalsVisibleTo("Unity.XR.OpenXR.Editor")]
+namespace UnityEngine.XR.OpenXR.Features
+{
+    /// <summary>
+    /// A Unity OpenXR Feature.
+    /// This class can be inherited from to add feature specific data and logic.
+    /// Feature-specific settings are serialized for access at runtime.
+    /// </summary>
+    [Serializable]
+    public abstract partial class OpenXRFeature : ScriptableObject
+    {
+        /// <summary>
+        /// Feature will be enabled when OpenXR is initialized.
+        /// </summary>
+        [FormerlySerializedAs("enabled")] [HideInInspector] [SerializeField] private bool m_enabled = false;
+
+        internal bool failedInitialization { get; private set; } = false;
+
+        /// <summary>
+        /// True if a required feature failed initialization, false if all features initialized successfully.
+        /// </summary>
+        internal static bool requiredFeatureFailed { get; private set; }
+
+        /// <summary>
+        /// Feature is enabled and will be started when the OpenXR loader is initialized.
+        ///
+        /// Note that the enabled state of a feature cannot be modified once OpenXR is initialized and
+        /// can be used at runtime to determine if a feature successfully initialized.
+        /// </summary>
+        public bool enabled
+        {
+            get => m_enabled && (OpenXRLoaderBase.Instance == null || !failedInitialization);
+            set
+            {
+                if (m_enabled == value)
+                    return;
+
+                if (OpenXRLoaderBase.Instance != null)
+                {
+                    Debug.LogError("OpenXRFeature.enabled cannot be changed while OpenXR is running");
+                    return;
+                }
+
+                m_enabled = value;
+            }
+        }
+
+        /// <summary>
+        /// Automatically filled out by the build process from OpenXRFeatureAttribute.
+        /// Name of the feature.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal string nameUi = null;
+
+        /// <summary>
+        /// Automatically filled out by the build process from OpenXRFeatureAttribute.
+        /// Version of the feature.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal string version = null;
+
+        /// <summary>
+        /// Feature id.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal string featureIdInternal  = null;
+
+        /// <summary>
+        /// Automatically filled out by the build process from OpenXRFeatureAttribute.
+        /// OpenXR runtime extension strings that need to be enabled to use this extension.
+        /// May contain multiple extensions separated by spaces.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal string openxrExtensionStrings = null;
+
+        /// <summary>
+        /// Automatically filled out by the build process from OpenXRFeatureAttribute.
+        /// Company name of the author of the feature.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal string company = null;
+
+        /// <summary>
+        /// Automatically filled out by the build process from OpenXRFeatureAttribute.
+        /// Priority of the feature.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal int priority = 0;
+
+        /// <summary>
+        /// Automatically filled out by the build process from OpenXRFeatureAttribute.
+        /// True if the feature is required, false otherwise.
+        /// </summary>
+        [HideInInspector] [SerializeField] internal bool required = false;
+
+        /// <summary>
+        /// Accessor for xrGetInstanceProcAddr function pointer.
+        /// </summary>
+        protected static IntPtr xrGetInstanceProcAddr => Internal_GetProcAddressPtr(false);
+
+        /// <summary>
+        /// Called to hook xrGetInstanceProcAddr.
+        /// Returning a different function pointer allows intercepting any OpenXR method.
+        /// </summary>
+        /// <param name="func">xrGetInstanceProcAddr native function pointer</param>
+        /// <returns>Function pointer that Unity will use to look up OpenXR native functions.</returns>
+        protected internal virtual IntPtr HookGetInstanceProcAddr(IntPtr func) => func;
+
+        /// <summary>
+        /// Called after the XR Loader is initialized and has created its subsystems.
+        /// </summary>
+        protected internal virtual void OnSubsystemCreate() { }
+
+        /// <summary>
+        /// Called after the XR loader starts its subsystems.
+        /// </summary>
+        protected internal virtual void OnSubsystemStart() { }
+
+        /// <summary>
+        /// Called before the XR loader stops its subsystems.
+        /// </summary>
+        protected internal virtual void OnSubsystemStop () { }
+
+        /// <summary>
+        /// Called before the XR loader destroys its subsystems.
+        /// </summary>
+        protected internal virtual void OnSubsystemDestroy () { }
+
+        /// <summary>
+        /// Called when xrInstance is created.
+        /// </summary>
+        /// <param name="xrInstance">Handle of the xrInstance</param>
+        protected internal virtual bool OnInstanceCreate(ulong xrInstance) => true;
+
+        /// <summary>
+        /// Called when xrSystemId is created.
+        /// </summary>
+        /// <param name="xrSystem">Handle of the xrSystemId</param>
+        protected internal virtual void OnSystemChange (ulong xrSystem) { }
+
+        /// <summary>
+        /// Called when xrSession is created.
+        /// </summary>
+        /// <param name="xrSession">Handle of the xrSession</param>
+        protected internal virtual void OnSessionCreate(ulong xrSession) { }
+
+        /// <summary>
+        /// Called when the reference xrSpace for the app changes.
+        /// </summary>
+        /// <param name="xrSpace">Handle of the xrSpace</param>
+        protected internal virtual void OnAppSpaceChange (ulong xrSpace) { }
+
+        /// <summary>
+        /// Called when xrSessionState changes.
+        /// </summary>
+        /// <param name="oldState">Previous state</param>
+        /// <param name="newState">New state</param>
+        protected internal virtual void OnSessionStateChange(int oldState, int newState) { }
+
+        /// <summary>
+        /// Called after xrSessionBegin.
+        /// </summary>
+        /// <param name="xrSession">Handle of the xrSession</param>
+        protected internal virtual void OnSessionBegin (ulong xrSession) { }
+
+        /// <summary>
+        /// Called before xrEndSession.
+        /// </summary>
+        /// <param name="xrSession">Handle of the xrSession</param>
+        protected internal virtual void OnSessionEnd(ulong xrSession) { }
+
+        /// <summary>
+        /// Called when the runtime sends an Exiting event.
+        /// </summary>
+        /// <param name="xrSession">Handle of the xrSession</param>
+        protected internal virtual void OnSessionExiting (ulong xrSession) { }
+
+        /// <summary>
+        /// Called before xrDestroySession.
+        /// </summary>
+        /// <param name="xrSession">Handle of the xrSession</param>
+        protected internal virtual void OnSessionDestroy (ulong xrSession) { }
+
+        /// <summary>
+        /// Called before xrDestroyInstance
+        /// </summary>
+        /// <param name="xrInstance">Handle of the xrInstance</param>
+        protected internal virtual void OnInstanceDestroy (ulong xrInstance) { }
+
+        /// <summary>
+        /// Notification to the feature implementer that the session is
+        /// about to be lost. This feature should do what it needs to do to
+        /// prepare for potential session recreation.
+        /// </summary>
+        /// <param name="xrSession">The session that is going to be lost</param>
+        protected internal virtual void OnSessionLossPending(ulong xrSession) { }
+
+        /// <summary>
+        /// Notification to the feature implementer that the instance is
+        /// about to be lost. This feature should do what it needs to do to
+        /// clean up in preparation for termination.
+        /// </summary>
+        /// <param name="xrInstance">The instance that is going to be lost</param>
+        protected internal virtual void OnInstanceLossPending (ulong xrInstance) { }
+
+        /// <summary>
+        /// Notification to the feature implementer that the form factor has changed.
+        /// </summary>
+        /// <param name="xrFormFactor">New form factor value</param>
+        protected internal virtual void OnFormFactorChange (int xrFormFactor) {}
+
+        /// <summary>
+        /// Notification to the feature implementer that the view configuration type has changed.
+        /// </summary>
+        /// <param name="xrViewConfigurationType">New view configuration type</param>
+        protected internal virtual void OnViewConfigurationTypeChange (int xrViewConfigurationType) {}
+
+        /// <summary>
+        /// Notification to the feature implementer that the environment blend mode has changed.
+        /// </summary>
+        /// <param name="xrEnvironmentBlendMode">New environment blend mode value</param>
+        protected internal virtual void OnEnvironmentBlendModeChange (int xrEnvironmentBlendMode) {}
+
+        /// <summary>
+        /// Converts an XrPath to a string.
+        /// </summary>
+        /// <param name="path">Path to convert</param>
+        /// <returns>String that represents the path, or null if the path is invalid.</returns>
+        protected static string PathToString(ulong path) =>
+            Internal_PathToStringPtr(path, out var stringPtr) ? Marshal.PtrToStringAnsi(stringPtr) : null;
+
+        /// <summary>
+        /// Converts a string to an XrPath.
+        /// </summary>
+        /// <param name="str">String to convert</param>
+        /// <returns>Path of converted string, or XrPath.none if string could not be converted.</returns>
+        protected static ulong StringToPath(string str) =>
+            Internal_StringToPath(str, out var id) ? id : 0ul;
+
+        /// <summary>
+        /// Returns the path of the current interaction profile for the given user path.
+        /// </summary>
+        /// <param name="userPath">OpenXR User Path (eg: /user/hand/left)</param>
+        /// <returns>A path to the interaction profile, or XrPath.none if the path could not be retrieved.</returns>
+        protected static ulong GetCurrentInteractionProfile(ulong userPath) =>
+            Internal_GetCurrentInteractionProfile(userPath, out ulong profileId) ? profileId : 0ul;
+
+        /// <summary>
+        /// Returns the path of the current interaction profile for the given user path.
+        /// </summary>
+        /// <param name="userPath">User path</param>
+        /// <returns>A path to the interaction profile, or XrPath.none if the path could not be retrieved.</returns>
+        protected static ulong GetCurrentInteractionProfile(string userPath) =>
+            GetCurrentInteractionProfile(StringToPath(userPath));
+
+        /// <summary>
+        /// Returns the current app space.
+        /// </summary>
+        /// <returns>Current app space</returns>
+        protected static ulong GetCurrentAppSpace() =>
+            Internal_GetAppSpace(out ulong appSpaceId) ? appSpaceId : 0ul;
+
+#if UNITY_EDITOR
+        /// <summary>
+        /// A Build-time validation rule.
+        /// </summary>
+        public class ValidationRule
+        {
+            /// <summary>
+            /// Creates a validation rule for an OpenXRFeature.
+            /// </summary>
+            /// <param name="feature">Feature to create validation rule for</param>
+            public ValidationRule(OpenXRFeature feature)
+            {
+                if (feature == null)
+                    throw new Exception("Invalid feature");
+                this.feature = feature;
+            }
+
+            internal ValidationRule()
+            {}
+
+            /// <summary>
+            /// Message describing the rule that will be showed to the developer if it fails.
+            /// </summary>
+            public string message;
+
+            /// <summary>
+            /// Lambda function that returns true if validation passes, false if validation fails.
+            /// </summary>
+            public Func<bool> checkPredicate;
+
+            /// <summary>
+            /// Lambda function that fixes the issue, if possible.
+            /// </summary>
+            public Action fixIt;
+
+            /// <summary>
+            /// Text describing how the issue is fixed, shown in a tooltip.
+            /// </summary>
+            public string fixItMessage;
+
+            /// <summary>
+            /// If true, failing the rule is treated as an error and stops the build.
+            /// If false, failing the rule is treated as a warning and it doesn't stop the build. The developer has the option to correct the problem, but is not required to.
+            /// </summary>
+            public bool error;
+
+            /// <summary>
+            /// If true, will deny the project from entering playmode in editor.
+            /// If false, can still enter playmode in editor if this issue isn't fixed.
+            /// </summary>
+            public bool errorEnteringPlaymode;
+
+            internal OpenXRFeature feature;
+        }
+
+        /// <summary>
+        /// Allows a feature to add to a list of validation rules which your feature will evaluate at build time.
+        /// Details of the validation results can be found in OpenXRProjectValidation.
+        /// </summary>
+        /// <param name="rules">Your feature will check the rules in this list at build time. Add rules that you want your feature to check, and remove rules that you want your feature to ignore.</param>
+        /// <param name="targetGroup">Build target group these validation rules will be evaluated for.</param>
+        protected internal virtual void GetValidationChecks(List<ValidationRule> rules, BuildTargetGroup targetGroup)
+        {
+        }
+
+        internal static void GetValidationList(List<ValidationRule> rules, BuildTargetGroup targetGroup)
+        {
+            var openXrSettings = OpenXRSettings.GetSettingsForBuildTargetGroup(targetGroup);
+            if (openXrSettings == null)
+            {
+                Debug.LogError("Invalid OpenXR Settings");
+                return;
+            }
+
+            foreach (var feature in openXrSettings.features)
+            {
+                if (feature != null && feature.enabled)
+                    feature.GetValidationChecks(rules, targetGroup);
+            }
+        }
+#endif
+
+        /// <summary>
+        /// Creates a subsystem based on a given a list of descriptors and a specific subsystem id.
+        /// Promoted to public for extensions.
+        /// </summary>
+        ///
+        /// <typeparam name="TDescriptor">The descriptor type being passed in</typeparam>
+        /// <typeparam name="TSubsystem">The subsystem type being requested</typeparam>
+        /// <param name="descriptors">List of TDescriptor instances to use for subsystem matching</param>
+        /// <param name="id">The identifier key of the particular subsystem implementation being requested</param>
+        protected void CreateSubsystem<TDescriptor, TSubsystem>(List<TDescriptor> descriptors, string id)
+            where TDescriptor : ISubsystemDescriptor
+            where TSubsystem : ISubsystem
+        {
+            if (OpenXRLoaderBase.Instance == null)
+            {
+                Debug.LogError("CreateSubsystem called before loader was initialized");
+                return;
+            }
+
+            OpenXRLoaderBase.Instance.CreateSubsystem<TDescriptor, TSubsystem>(descriptors, id);
+        }
+
+        /// <summary>
+        /// Start a subsystem instance of a given type. Subsystem is assumed to already be loaded from
+        /// a previous call to CreateSubsystem.
+        /// Promoted to public for extensions.
+        /// </summary>
+        ///
+        /// <typeparam name="T">A subclass of <see cref="ISubsystem"/></typeparam>
+        protected void StartSubsystem<T>() where T : class, ISubsystem
+        {
+            if (OpenXRLoaderBase.Instance == null)
+            {
+                Debug.LogError("StartSubsystem called before loader was initialized");
+                return;
+            }
+
+            OpenXRLoaderBase.Instance.StartSubsystem<T>();
+        }
+
+        /// <summary>
+        /// Stops a subsystem instance of a given type. Subsystem is assumed to already be loaded from
+        /// a previous call to CreateSubsystem.
+        /// Promoted to public for extensions.
+        /// </summary>
+        ///
+        /// <typeparam name="T">A subclass of <see cref="ISubsystem"/></typeparam>
+        protected void StopSubsystem<T>() where T : class, ISubsystem
+        {
+            if (OpenXRLoaderBase.Instance == null)
+            {
+                Debug.LogError("StopSubsystem called before loader was initialized");
+                return;
+            }
+
+            OpenXRLoaderBase.Instance.StopSubsystem<T>();
+        }
+
+        /// <summary>
+        /// Destroys a subsystem instance of a given type. Subsystem is assumed to already be loaded from
+        /// a previous call to CreateSubsystem.
+        /// Promoted to public for extensions.
+        /// </summary>
+        ///
+        /// <typeparam name="T">A subclass of <see cref="ISubsystem"/></typeparam>
+        protected void DestroySubsystem<T>() where T : class, ISubsystem
+        {
+            if (OpenXRLoaderBase.Instance == null)
+            {
+                Debug.LogError("DestroySubsystem called before loader was initialized");
+                return;
+            }
+
+            OpenXRLoaderBase.Instance.DestroySubsystem<T>();
+        }
+
+        /// <inheritdoc />
+        protected virtual void OnEnable()
+        {
+#if UNITY_EDITOR
+            foreach (Attribute attr in Attribute.GetCustomAttributes(GetType()))
+            {
+                if (attr is UnityEditor.XR.OpenXR.Features.OpenXRFeatureAttribute)
+                {
+                    var feature = (UnityEditor.XR.OpenXR.Features.OpenXRFeatureAttribute) attr;
+                    nameUi = feature.UiName;
+                    version = feature.Version;
+                    featureIdInternal = feature.FeatureId;
+                    openxrExtensionStrings = feature.OpenxrExtensionStrings;
+                    priority = feature.Priority;
+                    required = feature.Required;
+                    company = feature.Company;
+                }
+            }
+#endif
+        }
+
+        /// <inheritdoc />
+        protected virtual void OnDisable()
+        {
+            // Virtual for future expansion and to match OnEnable
+        }
+
+        internal enum LoaderEvent
+        {
+            SubsystemCreate,
+            SubsystemDestroy,
+            SubsystemStart,
+            SubsystemStop,
+        }
+
+        internal static bool ReceiveLoaderEvent(OpenXRLoaderBase loader, LoaderEvent e)
+        {
+            var instance = OpenXRSettings.Instance;
+            if (instance == null)
+                return true;
+
+            foreach (var feature in instance.features)
+            {
+                if (feature == null || !feature.enabled)
+                    continue;
+
+                switch (e)
+                {
+                    case LoaderEvent.SubsystemCreate:
+                        feature.OnSubsystemCreate();
+                        break;
+                    case LoaderEvent.SubsystemDestroy:
+                        feature.OnSubsystemDestroy();
+                        break;
+                    case LoaderEvent.SubsystemStart:
+                        feature.OnSubsystemStart();
+                        break;
+                    case LoaderEvent.SubsystemStop:
+                        feature.OnSubsystemStop();
+                        break;
+
+                    default:
+                        throw new ArgumentOutOfRangeException(nameof(e), e, null);
+                }
+            }
+
+            return true;
+        }
+
+        // Must be kept in sync with unity_type.h ScriptEvents
+        internal enum NativeEvent
+        {
+            // Setup
+            XrSetupConfigValues,
+            XrSystemIdChanged,
+            XrInstanceChanged,
+            XrSessionChanged,
+            XrBeginSession,
+
+            // Runtime
+            XrSessionStateChanged,
+            XrChangedSpaceApp,
+
+            // Shutdown
+            XrEndSession,
+            XrDestroySession,
+            XrDestroyInstance,
+
+            // General Session Events
+            XrIdle,
+            XrReady,
+            XrSynchronized,
+            XrVisible,
+            XrFocused,
+            XrStopping,
+            XrExiting,
+            XrLossPending,
+            XrInstanceLossPending,
+            XrRestartRequested,
+        };
+
+        internal static void ReceiveNativeEvent(NativeEvent e, ulong payload)
+        {
+            if (null == OpenXRSettings.Instance)
+                return;
+
+            foreach (var feature in OpenXRSettings.Instance.features)
+            {
+                if (feature == null || !feature.enabled)
+                    continue;
+
+                switch (e)
+                {
+                    case NativeEvent.XrSetupConfigValues:
+                        feature.OnFormFactorChange(Internal_GetFormFactor());
+                        feature.OnEnvironmentBlendModeChange(Internal_GetEnvironmentBlendMode());
+                        feature.OnViewConfigurationTypeChange(Internal_GetViewConfigurationType());
+                        break;
+
+                    case NativeEvent.XrSystemIdChanged:
+                        feature.OnSystemChange(payload);
+                        break;
+                    case NativeEvent.XrInstanceChanged:
+                        feature.failedInitialization = !feature.OnInstanceCreate(payload);
+                        requiredFeatureFailed |= (feature.required && feature.failedInitialization);
+                        break;
+                    case NativeEvent.XrSessionChanged:
+                        feature.OnSessionCreate(payload);
+                        break;
+                    case NativeEvent.XrBeginSession:
+                        feature.OnSessionBegin(payload);
+                        break;
+                    case NativeEvent.XrChangedSpaceApp:
+                        feature.OnAppSpaceChange(payload);
+                        break;
+                    case NativeEvent.XrSessionStateChanged:
+                        Internal_GetSessionState(out var oldState, out var newState);
+                        feature.OnSessionStateChange(oldState, newState);
+                        break;
+                    case NativeEvent.XrEndSession:
+                        feature.OnSessionEnd(payload);
+                        break;
+                    case NativeEvent.XrExiting:
+                        feature.OnSessionExiting(payload);
+                        break;
+                    case NativeEvent.XrDestroySession:
+                        feature.OnSessionDestroy(payload);
+                        break;
+                    case NativeEvent.XrDestroyInstance:
+                        feature.OnInstanceDestroy(payload);
+                        break;
+                    case NativeEvent.XrLossPending:
+                        feature.OnSessionLossPending(payload);
+                        break;
+                    case NativeEvent.XrInstanceLossPending:
+                        feature.OnInstanceLossPending(payload);
+                        break;
+                }
+            }
+        }
+
+        internal static void Initialize()
+        {
+            requiredFeatureFailed = false;
+
+            var instance = OpenXRSettings.Instance;
+            if (instance == null || instance.features == null)
+                return;
+
+            foreach (var feature in instance.features)
+                if(feature != null)
+                    feature.failedInitialization = false;
+        }
+
+        internal static void HookGetInstanceProcAddr()
+        {
+            var procAddr = Internal_GetProcAddressPtr(true);
+
+            var instance = OpenXRSettings.Instance;
+            if (instance != null && instance.features != null)
+            {
+                // Hook the features in reverse priority order to ensure the highest priority feature is
+                // hooked last.  This will ensure the highest priority feature is called first in the chain.
+                for(var featureIndex=instance.features.Length - 1; featureIndex >= 0; featureIndex--)
+                {
+                    var feature = instance.features[featureIndex];
+                    if (feature == null || !feature.enabled)
+                        continue;
+
+                    procAddr = feature.HookGetInstanceProcAddr(procAddr);
+                }
+            }
+
+            Internal_SetProcAddressPtrAndLoadStage1(procAddr);
+        }
+
+        [StructLayout(LayoutKind.Explicit, Size = kSize)]
+        private struct GetInternalDeviceIdCommand : IInputDeviceCommandInfo
+        {
+            private static FourCC Type => new FourCC('X', 'R', 'D', 'I');
+
+            private const int kSize = 8 + sizeof(uint);
+
+            [FieldOffset(0)] private InputDeviceCommand baseCommand;
+
+            [FieldOffset(8)] public readonly uint deviceId;
+
+            public FourCC typeStatic => Type;
+
+            public static GetInternalDeviceIdCommand Create() =>
+                new GetInternalDeviceIdCommand { baseCommand = new InputDeviceCommand(Type, kSize) };
+        }
+
+        /// <summary>
+        /// Returns XrAction handle bound to the given <see cref="UnityEngine.InputSystem.InputAction"/>.
+        /// </summary>
+        /// <param name="inputAction">Action to retrieve XrAction handles for</param>
+        /// <returns>XrAction handle bound to the given <see cref="UnityEngine.InputSystem.InputAction"/> or 0 if there is no bound XrAction</returns>
+        protected ulong GetAction(InputAction inputAction)
+        {
+            if (inputAction == null || inputAction.controls.Count == 0)
+                return 0;
+
+            foreach (var control in inputAction.controls)
+            {
+                var command = GetInternalDeviceIdCommand.Create();
+                if (control.device.ExecuteCommand(ref command) <= 0)
+                    continue;
+
+                // Populate the action handles list and make sure we dont overflow
+                var xrAction = Internal_GetAction(command.deviceId, control.name);
+                if (xrAction != 0)
+                    return xrAction;
+            }
+
+            return 0;
+        }
+    }
+}
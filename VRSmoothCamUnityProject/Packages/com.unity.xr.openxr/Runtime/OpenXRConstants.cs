@@ -0,0 +1,13 @@
+﻿namespace UnityEngine.XR.OpenXR
+{
+    /// <summary>
+    /// Static constants
+    /// </summary>
+    public static class Constants
+    {
+        /// <summary>
+        /// Key used to store and retrieve custom configuration settings from EditorBuildSettings.
+        /// </summary>
+        public const string k_SettingsKey = "com.unity.xr.openxr.settings4";
+    }
+}
@@ -0,0 +1,798 @@
+#if UNITY_EDITOR
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.CompilerServices;
+using System.Text;
+using UnityEditor.IMGUI.Controls;
+using UnityEngine.Networking.PlayerConnection;
+
+[assembly:InternalsVisibleTo("Unity.XR.OpenXR.Features.RuntimeDebugger.Editor")]
+namespace UnityEditor.XR.OpenXR.Features.RuntimeDebugger
+{
+    internal class DebuggerState
+    {
+        public enum Command
+        {
+            kStartFunctionCall,
+            kStartStruct,  // Legacy, decode only.
+
+            kFloat,
+            kString,
+            kInt32,
+            kInt64,
+            kUInt32,
+            kUInt64,
+
+            kEndStruct,  // Legacy, decode only.
+            kEndFunctionCall,
+
+            kCacheNotLargeEnough,
+
+            kNameTable,
+            kThreadInfo,
+
+            kStartKeyframeCall,
+
+            kDroppedData,
+
+            kEnum,
+            kEnumTable,
+
+            kStruct,
+            kEndField,
+            kSchemaTable,
+
+            kFrameSummary,
+
+            kCallOutputs,
+
+            kOverheadReport,
+        };
+
+        // How a struct field is packed after kStruct, see trace_format.h.
+        private enum FieldKind : byte
+        {
+            kFieldDynamic,
+            kFieldFloat,
+            kFieldInt32,
+            kFieldUInt32,
+            kFieldInt64,
+            kFieldUInt64,
+            kFieldEnum,
+            kFieldString,
+            kFieldStruct,
+            kFieldNext,
+        };
+
+        private struct SchemaField
+        {
+            public UInt16 nameId;
+            public FieldKind kind;
+            // Enum type or struct id.
+            public UInt32 type;
+        }
+
+        private class StructSchema
+        {
+            public UInt16 nameId;
+            public List<SchemaField> fields = new List<SchemaField>();
+        }
+
+        // Written in place of a name id when the name is sent inline as a string.
+        private const UInt16 kInlineName = 0xFFFF;
+
+        // 64-bit values and start times are deltas against the previous value in the same slot, per thread.
+        // See trace_format.h for the details of the encoding.
+        private const int kDeltaSlots = 64;
+
+        // Results are values of the first enum type, XrResult.
+        private const int kResultEnumType = 0;
+
+        private class DeltaState
+        {
+            public UInt64[] values = new UInt64[kDeltaSlots];
+            public UInt64 startTime;
+            public UInt32 frame;
+            public UInt16 sequence;
+            // False after calls went missing, until the thread's next keyframe.
+            public bool valid;
+        }
+
+        internal static List<FunctionCall> _functionCalls = new List<FunctionCall>();
+
+        private static Action _doneCallback;
+        internal static UInt32 _lastPayloadSize;
+        internal static UInt32 _frameCount;
+        // Calls overwritten in the player's cache before this payload was read.
+        internal static UInt64 _droppedCalls;
+        internal static UInt64 _droppedBytes;
+
+        // Name id -> name, sent by the player once per capture session.
+        private static Dictionary<UInt16, string> _names = new Dictionary<UInt16, string>();
+        internal static bool hasNameTable => _names.Count > 0;
+
+        // Enum type -> value -> name, sent by the player with the name table.
+        private static List<Dictionary<Int32, string>> _enumTypes = new List<Dictionary<Int32, string>>();
+
+        // Struct id -> field layout, sent by the player with the name table.
+        private static List<StructSchema> _structs = new List<StructSchema>();
+
+        // Thread index -> display name, sent by the player the first time each thread makes a call.
+        private static Dictionary<UInt32, string> _threads = new Dictionary<UInt32, string>();
+
+        private static Dictionary<UInt32, DeltaState> _deltaStates = new Dictionary<UInt32, DeltaState>();
+
+        // xrEndFrame start and predicted display time from the last frame summary, 0 at the start of a session.
+        private static UInt64 _lastFrameEndStart;
+        private static Int64 _lastPredictedDisplayTime;
+        // Delta state of the thread whose call is being parsed.
+        private static DeltaState _currentDelta;
+
+        internal static void SetDoneCallback(Action done)
+        {
+            _doneCallback = done;
+        }
+
+        private static StringBuilder _sb = new StringBuilder();
+        internal static string ReadString(BinaryReader r)
+        {
+            _sb.Clear();
+            byte b;
+            while ((b = r.ReadByte()) != (byte)0)
+            {
+                _sb.Append((Char)b);
+            }
+            return _sb.ToString();
+        }
+
+        // LEB128, see PutVarUInt in record_writer.h.
+        internal static UInt64 ReadVarUInt(BinaryReader r)
+        {
+            UInt64 value = 0;
+            int shift = 0;
+            byte b;
+            do
+            {
+                b = r.ReadByte();
+                value |= (UInt64)(b & 0x7F) << shift;
+                shift += 7;
+            } while ((b & 0x80) != 0);
+            return value;
+        }
+
+        internal static Int64 ReadVarInt(BinaryReader r)
+        {
+            var value = ReadVarUInt(r);
+            return (Int64)(value >> 1) ^ -(Int64)(value & 1);
+        }
+
+        internal static string ReadName(BinaryReader r)
+        {
+            return ReadName(r, out _);
+        }
+
+        internal static string ReadName(BinaryReader r, out UInt16 id)
+        {
+            id = r.ReadUInt16();
+            if (id == kInlineName)
+                return ReadString(r);
+            return NameString(id);
+        }
+
+        internal static string NameString(UInt16 id)
+        {
+            return _names.TryGetValue(id, out var name) ? name : $"<name {id}>";
+        }
+
+        // Values that aren't in the table are shown as numbers.
+        internal static string EnumName(UInt64 enumType, Int32 value)
+        {
+            if (enumType < (UInt64)_enumTypes.Count && _enumTypes[(int)enumType].TryGetValue(value, out var name))
+                return name;
+            return value.ToString();
+        }
+
+        internal static string ReadResult(BinaryReader r)
+        {
+            return EnumName(kResultEnumType, (Int32)ReadVarInt(r));
+        }
+
+        internal static string ThreadName(UInt32 index)
+        {
+            return _threads.TryGetValue(index, out var thread) ? thread : $"Thread {index}";
+        }
+
+        private static DeltaState GetDeltaState(UInt32 threadIndex)
+        {
+            if (!_deltaStates.TryGetValue(threadIndex, out var delta))
+            {
+                delta = new DeltaState();
+                _deltaStates[threadIndex] = delta;
+            }
+            return delta;
+        }
+
+        private static void StartCall(UInt32 threadIndex, UInt16 sequence, bool keyframe)
+        {
+            var delta = GetDeltaState(threadIndex);
+            if (keyframe)
+            {
+                Array.Clear(delta.values, 0, kDeltaSlots);
+                delta.startTime = 0;
+                delta.frame = 0;
+                delta.valid = true;
+            }
+            else if ((UInt16)(sequence - delta.sequence) != 1)
+            {
+                delta.valid = false;
+            }
+            delta.sequence = sequence;
+            _currentDelta = delta;
+        }
+
+        // The slot is a Fibonacci hash of the name id down to 6 bits, same as DeltaSlot in trace_format.h.
+        private static UInt64 ReadDelta(BinaryReader r, UInt16 nameId, out bool valid)
+        {
+            var slot = (int)(unchecked(nameId * 2654435761u) >> 26);
+            var value = unchecked(_currentDelta.values[slot] + (UInt64)ReadVarInt(r));
+            _currentDelta.values[slot] = value;
+            valid = _currentDelta.valid;
+            return value;
+        }
+
+        private static void ReadThreadInfo(BinaryReader r)
+        {
+            var index = r.ReadUInt32();
+            var osThreadId = r.ReadUInt64();
+            var name = ReadString(r);
+            _threads[index] = name.Length > 0 ? $"{name} ({osThreadId})" : $"Thread {osThreadId}";
+        }
+
+        // The table is the player's name blob: NUL-terminated strings back to back, a name's id is its byte offset.
+        private static void ReadNameTable(BinaryReader r)
+        {
+            _names.Clear();
+            _threads.Clear();
+            _deltaStates.Clear();
+            _lastFrameEndStart = 0;
+            _lastPredictedDisplayTime = 0;
+            var blob = r.ReadBytes((int)r.ReadUInt32());
+            int start = 0;
+            for (int i = 0; i < blob.Length; ++i)
+            {
+                if (blob[i] != 0)
+                    continue;
+                _names[(UInt16)start] = Encoding.UTF8.GetString(blob, start, i - start);
+                start = i + 1;
+            }
+        }
+
+        // Every enum type in order: value count, type name, then each value and its name.
+        private static void ReadEnumTable(BinaryReader r)
+        {
+            _enumTypes.Clear();
+            var size = r.ReadUInt32();
+            var end = r.BaseStream.Position + size;
+            while (r.BaseStream.Position < end)
+            {
+                var count = ReadVarUInt(r);
+                ReadString(r);
+                var values = new Dictionary<Int32, string>();
+                for (UInt64 i = 0; i < count; ++i)
+                {
+                    var value = (Int32)ReadVarInt(r);
+                    values[value] = ReadString(r);
+                }
+                _enumTypes.Add(values);
+            }
+        }
+
+        // Every struct in id order: name, field count, then each field's name, kind and enum type or struct id.
+        private static void ReadSchemaTable(BinaryReader r)
+        {
+            _structs.Clear();
+            var size = r.ReadUInt32();
+            var end = r.BaseStream.Position + size;
+            while (r.BaseStream.Position < end)
+            {
+                var schema = new StructSchema { nameId = r.ReadUInt16() };
+                var count = ReadVarUInt(r);
+                for (UInt64 i = 0; i < count; ++i)
+                {
+                    var field = new SchemaField { nameId = r.ReadUInt16(), kind = (FieldKind)r.ReadByte() };
+                    if (field.kind == FieldKind.kFieldEnum || field.kind == FieldKind.kFieldStruct)
+                        field.type = (UInt32)ReadVarUInt(r);
+                    schema.fields.Add(field);
+                }
+                _structs.Add(schema);
+            }
+        }
+
+        internal static void OnMessageEvent(MessageEventArgs args)
+        {
+            if (args == null || args.data == null)
+                return;
+            _lastPayloadSize = (UInt32)args.data.Length;
+            _frameCount = 0;
+            _droppedCalls = 0;
+            _droppedBytes = 0;
+            try
+            {
+                using (MemoryStream ms = new MemoryStream(args.data))
+                {
+                    using (BinaryReader r = new BinaryReader(ms, Encoding.UTF8))
+                    {
+                        while (r.BaseStream.Position != r.BaseStream.Length)
+                        {
+                            var command = (Command)r.ReadByte();
+                            switch (command)
+                            {
+                                case Command.kStartFunctionCall:
+                                case Command.kStartKeyframeCall:
+                                    var threadIndex = (UInt32)ReadVarUInt(r);
+                                    StartCall(threadIndex, r.ReadUInt16(), command == Command.kStartKeyframeCall);
+                                    var funcName = ReadName(r);
+                                    var funcCall = new FunctionCall(ThreadName(threadIndex), funcName);
+                                    _functionCalls.Add(funcCall);
+                                    funcCall.Parse(r);
+
+                                    if (funcName == "xrBeginFrame")
+                                    {
+                                        ++_frameCount;
+                                    }
+                                    break;
+                                case Command.kCacheNotLargeEnough:
+                                    threadIndex = (UInt32)ReadVarUInt(r);
+                                    // The player's deltas moved on without this call's values, its next call is a keyframe.
+                                    GetDeltaState(threadIndex).valid = false;
+                                    funcCall = new FunctionCall(ThreadName(threadIndex), ReadName(r));
+                                    _functionCalls.Add(funcCall);
+                                    var result = ReadResult(r);
+                                    funcCall.SetTiming(ReadVarUInt(r), ReadVarUInt(r), (UInt32)ReadVarUInt(r));
+                                    funcCall.displayName += " = " + result + " (cache not large enough)" + funcCall.timingText;
+                                    break;
+                                case Command.kFrameSummary:
+                                    _functionCalls.Add(new FrameSummary(r));
+                                    break;
+                                case Command.kOverheadReport:
+                                    _functionCalls.Add(new OverheadReport(r));
+                                    break;
+                                case Command.kNameTable:
+                                    ReadNameTable(r);
+                                    break;
+                                case Command.kEnumTable:
+                                    ReadEnumTable(r);
+                                    break;
+                                case Command.kSchemaTable:
+                                    ReadSchemaTable(r);
+                                    break;
+                                case Command.kThreadInfo:
+                                    ReadThreadInfo(r);
+                                    break;
+                                case Command.kDroppedData:
+                                    _droppedCalls = r.ReadUInt64();
+                                    _droppedBytes = r.ReadUInt64();
+                                    _functionCalls.Add(new FunctionCall("", $"{_droppedCalls} calls dropped ({_droppedBytes} bytes), cache not large enough"));
+                                    break;
+                                default:
+                                    throw new ArgumentOutOfRangeException();
+                            }
+                        }
+                    }
+                }
+            }
+            catch (Exception e)
+            {
+                Console.WriteLine(e);
+            }
+
+            _doneCallback?.Invoke();
+        }
+
+        internal class DebugEvent : TreeViewItem
+        {
+            private static int idCounter = 1;
+            private List<DebugEvent> childrenEvents = new List<DebugEvent>();
+
+            protected DebugEvent(string displayName)
+            : base(idCounter++, 0, displayName)
+            {
+            }
+
+            public virtual string GetValue()
+            {
+                return "";
+            }
+
+            public void Parse(BinaryReader r)
+            {
+                DebugEvent parsedChild = null;
+                bool endEvent = false;
+
+                do
+                {
+                    if (parsedChild != null)
+                    {
+                        AddChildEvent(parsedChild);
+                        parsedChild.Parse(r);
+                        parsedChild = null;
+                    }
+
+                    var command = (Command) r.ReadByte();
+                    switch (command)
+                    {
+                        case Command.kStartStruct:
+                            parsedChild = new StructDebugEvent(ReadName(r), ReadName(r));
+                            break;
+                        case Command.kStruct:
+                        {
+                            var name = ReadName(r);
+                            var structId = ReadVarUInt(r);
+                            if (structId >= (UInt64)_structs.Count)
+                                throw new ArgumentOutOfRangeException();
+                            var schema = _structs[(int)structId];
+                            var child = new StructDebugEvent(name, NameString(schema.nameId));
+                            AddChildEvent(child);
+                            child.ParseFields(r, schema);
+                            break;
+                        }
+                        case Command.kFloat:
+                            AddChildEvent(new FloatDebugEvent(ReadName(r), r.ReadSingle()));
+                            break;
+                        case Command.kString:
+                            AddChildEvent(new StringDebugEvent(ReadName(r), ReadString(r)));
+                            break;
+                        case Command.kInt32:
+                            AddChildEvent(new Int32DebugEvent(ReadName(r), (Int32)ReadVarInt(r)));
+                            break;
+                        case Command.kInt64:
+                        {
+                            var name = ReadName(r, out var nameId);
+                            var value = ReadDelta(r, nameId, out var valid);
+                            AddChildEvent(valid ? new Int64DebugEvent(name, (Int64)value) : (DebugEvent)new StringDebugEvent(name, "<lost>"));
+                            break;
+                        }
+                        case Command.kUInt32:
+                            AddChildEvent(new UInt32DebugEvent(ReadName(r), (UInt32)ReadVarUInt(r)));
+                            break;
+                        case Command.kUInt64:
+                        {
+                            var name = ReadName(r, out var nameId);
+                            var value = ReadDelta(r, nameId, out var valid);
+                            AddChildEvent(valid ? new UInt64DebugEvent(name, value) : (DebugEvent)new StringDebugEvent(name, "<lost>"));
+                            break;
+                        }
+                        case Command.kEnum:
+                        {
+                            var name = ReadName(r);
+                            var enumType = ReadVarUInt(r);
+                            AddChildEvent(new StringDebugEvent(name, EnumName(enumType, (Int32)ReadVarInt(r))));
+                            break;
+                        }
+                        case Command.kEndStruct:
+                        case Command.kEndField:
+                            endEvent = true;
+                            break;
+                        case Command.kCallOutputs:
+                        {
+                            // Everything so far was the call's inputs, see recorded_inputs.h.  The outputs that follow
+                            // go where a call's values always are.
+                            var inputs = new StructDebugEvent("inputs", "before the call");
+                            foreach (var child in childrenEvents)
+                                inputs.AddChildEvent(child);
+                            childrenEvents.Clear();
+                            children?.Clear();
+                            AddChildEvent(inputs);
+                            break;
+                        }
+                        case Command.kEndFunctionCall:
+                            var result = ReadResult(r);
+                            _currentDelta.startTime += ReadVarUInt(r);
+                            var startTime = _currentDelta.startTime;
+                            var duration = ReadVarUInt(r);
+                            _currentDelta.frame += (UInt32)ReadVarUInt(r);
+                            displayName += " = " + result;
+                            if (this is FunctionCall funcCall)
+                            {
+                                funcCall.SetTiming(startTime, duration, _currentDelta.frame);
+                                displayName += funcCall.timingText;
+                            }
+                            endEvent = true;
+                            break;
+                        default:
+                            throw new ArgumentOutOfRangeException();
+                    }
+                } while (!endEvent && r.BaseStream.Position != r.BaseStream.Length);
+            }
+
+            // A kStruct's fields, packed without names or tags as the schema says.  Dynamic fields are commands up to
+            // kEndField, parsed into this event like the fields of a kStartStruct.
+            private void ParseFields(BinaryReader r, StructSchema schema)
+            {
+                foreach (var field in schema.fields)
+                {
+                    var name = NameString(field.nameId);
+                    switch (field.kind)
+                    {
+                        case FieldKind.kFieldFloat:
+                            AddChildEvent(new FloatDebugEvent(name, r.ReadSingle()));
+                            break;
+                        case FieldKind.kFieldInt32:
+                            AddChildEvent(new Int32DebugEvent(name, (Int32)ReadVarInt(r)));
+                            break;
+                        case FieldKind.kFieldUInt32:
+                            AddChildEvent(new UInt32DebugEvent(name, (UInt32)ReadVarUInt(r)));
+                            break;
+                        case FieldKind.kFieldInt64:
+                        {
+                            var value = ReadDelta(r, field.nameId, out var valid);
+                            AddChildEvent(valid ? new Int64DebugEvent(name, (Int64)value) : (DebugEvent)new StringDebugEvent(name, "<lost>"));
+                            break;
+                        }
+                        case FieldKind.kFieldUInt64:
+                        {
+                            var value = ReadDelta(r, field.nameId, out var valid);
+                            AddChildEvent(valid ? new UInt64DebugEvent(name, value) : (DebugEvent)new StringDebugEvent(name, "<lost>"));
+                            break;
+                        }
+                        case FieldKind.kFieldEnum:
+                            AddChildEvent(new StringDebugEvent(name, EnumName(field.type, (Int32)ReadVarInt(r))));
+                            break;
+                        case FieldKind.kFieldString:
+                            AddChildEvent(new StringDebugEvent(name, ReadString(r)));
+                            break;
+                        case FieldKind.kFieldStruct:
+                        {
+                            if (field.type >= (UInt32)_structs.Count)
+                                throw new ArgumentOutOfRangeException();
+                            var nested = _structs[(int)field.type];
+                            var child = new StructDebugEvent(name, NameString(nested.nameId));
+                            AddChildEvent(child);
+                            child.ParseFields(r, nested);
+                            break;
+                        }
+                        case FieldKind.kFieldNext:
+                            // An empty chain shows as the null pointer, the way other pointers are sent.
+                            if (r.ReadByte() == 0)
+                                AddChildEvent(new UInt64DebugEvent(name, 0));
+                            else
+                                Parse(r);
+                            break;
+                        case FieldKind.kFieldDynamic:
+                            Parse(r);
+                            break;
+                        default:
+                            throw new ArgumentOutOfRangeException();
+                    }
+                }
+            }
+
+//            public IEnumerable<DebugEvent> GetChildren()
+//            {
+//                return childrenEvents;
+//            }
+
+            internal void AddChildEvent(DebugEvent evt)
+            {
+                childrenEvents.Add(evt);
+                AddChild(evt);
+            }
+        }
+
+        internal class FunctionCall : DebugEvent
+        {
+            public string threadId { get; }
+            public string returnVal { get; set; }
+
+            // Nanoseconds, startTime is relative to the start of the capture session.
+            // Only the call into the runtime is timed, not the debugger's own serialization.
+            public UInt64 startTime { get; private set; }
+            public UInt64 duration { get; private set; }
+            // Calls belong to the frame the next xrEndFrame ends.
+            public UInt32 frame { get; private set; }
+
+            public string timingText => $" ({duration / 1000.0:F1} us @ {startTime / 1000000000.0:F6} s, frame {frame})";
+
+            public void SetTiming(UInt64 start, UInt64 dur, UInt32 frameIndex)
+            {
+                startTime = start;
+                duration = dur;
+                frame = frameIndex;
+            }
+
+            public FunctionCall(string threadId, string displayName)
+            : base(displayName)
+            {
+                this.threadId = threadId;
+            }
+        }
+
+        // Sent by xrEndFrame, see frame_stats.h.  Display times are the runtime's XrTime, the rest is in the session's
+        // clock like call start times, so the two are compared by how far apart consecutive frames are.
+        internal class FrameSummary : FunctionCall
+        {
+            public FrameSummary(BinaryReader r)
+            : base("", "")
+            {
+                var frameIndex = (UInt32)ReadVarUInt(r);
+                var predictedDisplayTime = ReadVarInt(r);
+                var predictedDisplayPeriod = ReadVarUInt(r);
+                var submittedOffset = ReadVarInt(r);
+                var waitStart = ReadVarUInt(r);
+                var waitDuration = ReadVarUInt(r);
+                var beginStart = ReadVarUInt(r);
+                var endStart = ReadVarUInt(r);
+                var endDuration = ReadVarUInt(r);
+                SetTiming(endStart, endDuration, frameIndex);
+
+                var interval = _lastFrameEndStart != 0 && endStart > _lastFrameEndStart ? endStart - _lastFrameEndStart : 0;
+                var predictedInterval = _lastPredictedDisplayTime != 0 ? predictedDisplayTime - _lastPredictedDisplayTime : 0;
+                _lastFrameEndStart = endStart;
+                _lastPredictedDisplayTime = predictedDisplayTime;
+
+                displayName = $"Frame {frameIndex} summary ({Milliseconds(interval)} since the last frame was submitted, {Milliseconds(predictedInterval)} between predicted display times)";
+                AddChildEvent(new Int64DebugEvent("predictedDisplayTime", predictedDisplayTime));
+                AddChildEvent(new StringDebugEvent("predictedDisplayPeriod", Milliseconds(predictedDisplayPeriod)));
+                AddChildEvent(new Int64DebugEvent("submittedDisplayTime", predictedDisplayTime + submittedOffset));
+
+                var timeline = new StructDebugEvent("timeline", "frame functions");
+                AddChildEvent(timeline);
+                timeline.AddChildEvent(new StringDebugEvent("xrWaitFrame", $"{Milliseconds(waitDuration)} @ {waitStart / 1000000000.0:F6} s"));
+                timeline.AddChildEvent(new StringDebugEvent("xrBeginFrame", $"{Milliseconds(beginStart - Math.Min(beginStart, waitStart + waitDuration))} after xrWaitFrame returned"));
+                timeline.AddChildEvent(new StringDebugEvent("xrEndFrame", $"{Milliseconds(endStart - Math.Min(endStart, beginStart))} after xrBeginFrame, {Milliseconds(endDuration)} in the runtime"));
+
+                var functions = new StructDebugEvent("runtime time", "per function");
+                AddChildEvent(functions);
+                var functionCount = ReadVarUInt(r);
+                for (UInt64 i = 0; i < functionCount; ++i)
+                {
+                    var funcName = ReadName(r);
+                    var calls = ReadVarUInt(r);
+                    var duration = ReadVarUInt(r);
+                    functions.AddChildEvent(new StringDebugEvent(funcName, $"{Milliseconds(duration)} in {calls} calls"));
+                }
+            }
+
+            private static string Milliseconds(Int64 ns)
+            {
+                return $"{ns / 1000000.0:F3} ms";
+            }
+
+            private static string Milliseconds(UInt64 ns)
+            {
+                return $"{ns / 1000000.0:F3} ms";
+            }
+        }
+
+        // Sent by xrEndFrame after its frame summary when the debugger's own time in the frame went over budget, see
+        // overhead_stats.h.  Times are added up over every thread.
+        internal class OverheadReport : FunctionCall
+        {
+            public OverheadReport(BinaryReader r)
+            : base("", "")
+            {
+                var frameIndex = (UInt32)ReadVarUInt(r);
+                var budget = ReadVarUInt(r);
+                var calls = ReadVarUInt(r);
+                var runtimeTime = ReadVarUInt(r);
+                var overhead = ReadVarUInt(r);
+                var drainTime = ReadVarUInt(r);
+                var lockWaitTime = ReadVarUInt(r);
+                SetTiming(0, 0, frameIndex);
+
+                displayName = $"Frame {frameIndex} debugger overhead {Microseconds(overhead)}, over the {Microseconds(budget)} budget";
+                AddChildEvent(new UInt64DebugEvent("calls", calls));
+                AddChildEvent(new StringDebugEvent("serialization", Microseconds(overhead - Math.Min(overhead, drainTime + lockWaitTime))));
+                AddChildEvent(new StringDebugEvent("drains", Microseconds(drainTime)));
+                AddChildEvent(new StringDebugEvent("lock waits", Microseconds(lockWaitTime)));
+                AddChildEvent(new StringDebugEvent("runtime", Microseconds(runtimeTime)));
+            }
+
+            private static string Microseconds(UInt64 ns)
+            {
+                return $"{ns / 1000.0:F1} us";
+            }
+        }
+
+        internal class StructDebugEvent : DebugEvent
+        {
+            public StructDebugEvent(string fieldname, string structname)
+                : base($"{fieldname} = {structname}")
+            {
+
+            }
+        }
+
+        internal class FloatDebugEvent : DebugEvent
+        {
+            public float value { get; }
+            public FloatDebugEvent(string displayName, float val)
+                : base(displayName + " = " + val)
+            {
+                this.value = val;
+            }
+
+            public override string GetValue()
+            {
+                return $"{value}";
+            }
+        }
+
+        internal class StringDebugEvent : DebugEvent
+        {
+            public string value { get; }
+            public StringDebugEvent(string displayName, string val)
+                : base(displayName + " = " + val)
+            {
+                this.value = val;
+            }
+
+            public override string GetValue()
+            {
+                return value;
+            }
+        }
+
+        internal class Int32DebugEvent : DebugEvent
+        {
+            public Int32 value { get; }
+            public Int32DebugEvent(string displayName, Int32 val)
+                : base(displayName + " = " + val)
+            {
+                this.value = val;
+            }
+
+            public override string GetValue()
+            {
+                return $"{value}";
+            }
+        }
+
+        internal class Int64DebugEvent : DebugEvent
+        {
+            public Int64 value { get; }
+            public Int64DebugEvent(string displayName, Int64 val)
+                : base(displayName + " = " + val)
+            {
+                this.value = val;
+            }
+
+            public override string GetValue()
+            {
+                return $"{value}";
+            }
+        }
+
+        internal class UInt32DebugEvent : DebugEvent
+        {
+            public UInt32 value { get; }
+            public UInt32DebugEvent(string displayName, UInt32 val)
+                : base(displayName + " = " + val)
+            {
+                this.value = val;
+            }
+
+            public override string GetValue()
+            {
+                return $"{value}";
+            }
+        }
+
+        internal class UInt64DebugEvent : DebugEvent
+        {
+            public UInt64 value { get; }
+            public UInt64DebugEvent(string displayName, UInt64 val)
+                : base(displayName + " = " + val)
+            {
+                this.value = val;
+            }
+
+            public override string GetValue()
+            {
+                return $"{value}";
+            }
+        }
+    }
+}
+#endif
\ No newline at end of file
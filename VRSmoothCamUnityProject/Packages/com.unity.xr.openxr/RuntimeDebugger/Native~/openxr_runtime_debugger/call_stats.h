@@ -0,0 +1,151 @@
+#pragma once
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Per-function aggregates for the statistics capture mode.
+// Each thread keeps its own ThreadStats and is the only one writing to it, the reader merges them in GetStatsSnapshot.
+// Latencies go into half-octave buckets: two buckets per power of two nanoseconds, the last one catches everything over ~2s.
+static const uint32_t kLatencyBuckets = 64;
+
+// Also serialize 1 in this many calls per function, without sending it, to estimate what full capture would produce.
+static const uint32_t kMeasureInterval = 64;
+
+struct FuncStats
+{
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> minDuration;
+    std::atomic<uint64_t> maxDuration;
+    std::atomic<uint64_t> totalDuration;
+    std::atomic<uint64_t> measuredCalls;
+    std::atomic<uint64_t> measuredBytes;
+    std::atomic<uint32_t> histogram[kLatencyBuckets];
+};
+
+// Keep every function's counters on their own cache lines.
+struct PaddedFuncStats : FuncStats
+{
+    uint8_t padding[64 - sizeof(FuncStats) % 64];
+};
+
+struct ThreadStats
+{
+    // Stats from an older generation are stale, the owning thread clears them on its next call.
+    std::atomic<uint32_t> generation;
+    uint8_t padding[60];
+
+    PaddedFuncStats funcs[kFuncCount];
+};
+
+// Bumped by ResetStats.
+static std::atomic<uint32_t> s_StatsGeneration{1};
+
+static uint32_t LatencyBucket(uint64_t duration)
+{
+    if (duration < 2)
+        return (uint32_t)duration;
+    if (duration > 0xFFFFFFFF)
+        return kLatencyBuckets - 1;
+
+    uint32_t value = (uint32_t)duration;
+#if defined(_MSC_VER)
+    unsigned long highBit;
+    _BitScanReverse(&highBit, value);
+#else
+    uint32_t highBit = 31 - __builtin_clz(value);
+#endif
+    uint32_t bucket = highBit * 2 + ((value >> (highBit - 1)) & 1);
+    return bucket < kLatencyBuckets ? bucket : kLatencyBuckets - 1;
+}
+
+static uint64_t LatencyBucketStart(uint32_t bucket)
+{
+    if (bucket < 2)
+        return bucket;
+    uint32_t highBit = bucket / 2;
+    return (1ull << highBit) + (bucket & 1) * (1ull << (highBit - 1));
+}
+
+// Only called by the owning thread.
+static FuncStats& GetFuncStats(FuncId id)
+{
+    ThreadContext* context = GetThreadContext();
+    ThreadStats* stats = context->stats.load(std::memory_order_relaxed);
+    if (stats == nullptr)
+    {
+        stats = new ThreadStats();
+        TrackMemory(sizeof(ThreadStats));
+        context->stats.store(stats, std::memory_order_release);
+    }
+
+    uint32_t generation = s_StatsGeneration.load(std::memory_order_relaxed);
+    if (stats->generation.load(std::memory_order_relaxed) != generation)
+    {
+        for (auto& funcStats : stats->funcs)
+        {
+            funcStats.calls.store(0, std::memory_order_relaxed);
+            funcStats.errors.store(0, std::memory_order_relaxed);
+            funcStats.minDuration.store(0, std::memory_order_relaxed);
+            funcStats.maxDuration.store(0, std::memory_order_relaxed);
+            funcStats.totalDuration.store(0, std::memory_order_relaxed);
+            funcStats.measuredCalls.store(0, std::memory_order_relaxed);
+            funcStats.measuredBytes.store(0, std::memory_order_relaxed);
+            for (auto& count : funcStats.histogram)
+                count.store(0, std::memory_order_relaxed);
+        }
+        stats->generation.store(generation, std::memory_order_release);
+    }
+
+    return stats->funcs[id];
+}
+
+// Single writer, so load + store instead of the more expensive fetch_add.
+template <typename T>
+static void Increment(std::atomic<T>& counter, T amount = 1)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+static void RecordCallStats(FuncId id, XrResult result, uint64_t duration)
+{
+    FuncStats& stats = GetFuncStats(id);
+
+    uint64_t calls = stats.calls.load(std::memory_order_relaxed);
+    if (calls == 0 || duration < stats.minDuration.load(std::memory_order_relaxed))
+        stats.minDuration.store(duration, std::memory_order_relaxed);
+    if (duration > stats.maxDuration.load(std::memory_order_relaxed))
+        stats.maxDuration.store(duration, std::memory_order_relaxed);
+    stats.calls.store(calls + 1, std::memory_order_relaxed);
+
+    if (XR_FAILED(result))
+        Increment<uint64_t>(stats.errors);
+    Increment<uint64_t>(stats.totalDuration, duration);
+    Increment<uint32_t>(stats.histogram[LatencyBucket(duration)]);
+}
+
+static void RecordMeasuredBytes(ThreadContext* context, uint32_t bytes)
+{
+    FuncStats& stats = GetFuncStats(context->measureFunc);
+    Increment<uint64_t>(stats.measuredCalls);
+    Increment<uint64_t>(stats.measuredBytes, bytes);
+}
+
+// Percentile from a merged histogram, reported as the middle of the bucket it falls in.
+static uint64_t HistogramPercentile(const uint64_t (&histogram)[kLatencyBuckets], uint64_t calls, uint32_t percent)
+{
+    uint64_t target = (calls * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (uint32_t bucket = 0; bucket < kLatencyBuckets; ++bucket)
+    {
+        seen += histogram[bucket];
+        if (seen >= target && histogram[bucket] != 0)
+        {
+            if (bucket == kLatencyBuckets - 1)
+                return LatencyBucketStart(bucket);
+            return (LatencyBucketStart(bucket) + LatencyBucketStart(bucket + 1)) / 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utility>
+
+// Single-producer / single-consumer arena the arguments of deferred calls are copied into, see deferred_calls.h.
+// The owning thread copies a call into one contiguous span and hands it over through its queue, whoever drains the
+// queue formats it and releases everything up to the end of that span.  Spans are released in the order they were
+// taken, so the arena is a ring: a span that would be larger at the start of the buffer than before its end starts
+// over at the beginning, and the bytes it skipped are released with it.
+// Nothing here blocks or allocates after Create: once a span is full, every allocation fails and overflowed is set.
+struct CaptureArena
+{
+    uint8_t* data;
+    uint32_t capacity;
+
+    // Positions grow forever and wrap at 2^32, capacity is a power of two so masking still works after the wrap.
+    uint32_t head;
+    uint32_t cachedTail;
+
+    // The span being filled, from Begin.  skipped bytes before it belong to it.
+    uint8_t* start;
+    uint8_t* pos;
+    uint8_t* end;
+    uint32_t skipped;
+    bool overflowed;
+
+    // Keep the consumer's index off the producer's cache line.
+    uint8_t padding[64];
+
+    std::atomic<uint32_t> tail;
+
+    // Room for minSize bytes, rounded up to a power of two.
+    static uint32_t CapacityFor(uint32_t minSize)
+    {
+        uint32_t size = 64;
+        while (size < minSize)
+            size <<= 1;
+        return size;
+    }
+
+    void Create(uint32_t minSize)
+    {
+        capacity = CapacityFor(minSize);
+        data = (uint8_t*)malloc(capacity);
+        head = 0;
+        cachedTail = 0;
+        tail.store(0, std::memory_order_relaxed);
+        start = pos = end = data;
+        skipped = 0;
+        overflowed = false;
+    }
+
+    // Producer: start a span in the larger of the free space before the end of the buffer and at its start.
+    void Begin()
+    {
+        // Not created, every allocation fails.
+        if (data == nullptr)
+        {
+            start = pos = end = nullptr;
+            skipped = 0;
+            overflowed = true;
+            return;
+        }
+
+        // The consumer only ever frees more, a stale tail just underestimates.
+        if (head - cachedTail > capacity / 2)
+            cachedTail = tail.load(std::memory_order_acquire);
+
+        uint32_t free = capacity - (head - cachedTail);
+        uint32_t offset = head & (capacity - 1);
+        uint32_t toEnd = capacity - offset;
+        uint32_t size = free < toEnd ? free : toEnd;
+        skipped = 0;
+        if (free > toEnd && free - toEnd > toEnd)
+        {
+            skipped = toEnd;
+            offset = 0;
+            size = free - toEnd;
+        }
+
+        start = data + offset;
+        pos = start;
+        end = start + size;
+        overflowed = false;
+    }
+
+    // Producer: size bytes in the current span, or nullptr once it's full.
+    void* Alloc(size_t size, size_t alignment)
+    {
+        uintptr_t p = ((uintptr_t)pos + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        if (overflowed || p + size > (uintptr_t)end)
+        {
+            overflowed = true;
+            return nullptr;
+        }
+        pos = (uint8_t*)(p + size);
+        return (void*)p;
+    }
+
+    // Producer: a copy of count Ts, or nullptr once the span is full.
+    template <typename T>
+    T* Copy(const T* src, size_t count)
+    {
+        T* dst = (T*)Alloc(sizeof(T) * count, alignof(T));
+        if (dst != nullptr)
+            memcpy((void*)dst, src, sizeof(T) * count);
+        return dst;
+    }
+
+    // Producer: a T constructed from args, or nullptr once the span is full.
+    template <typename T, typename... Args>
+    T* New(Args&&... args)
+    {
+        void* p = Alloc(sizeof(T), alignof(T));
+        return p != nullptr ? new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Position just past the current span, what the consumer releases up to once it's done with it.
+    uint32_t SpanEnd() const
+    {
+        return head + skipped + (uint32_t)(pos - start);
+    }
+
+    // Producer: keep the current span, once it's been handed to the consumer.  Spans that aren't kept are reused.
+    void Commit(uint32_t spanEnd)
+    {
+        head = spanEnd;
+    }
+
+    uint32_t UsedBytes() const
+    {
+        return head - tail.load(std::memory_order_relaxed);
+    }
+
+    // Consumer: everything before spanEnd can be reused.
+    void Release(uint32_t spanEnd)
+    {
+        tail.store(spanEnd, std::memory_order_release);
+    }
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+// Which calls get serialized.
+// Dormant turns capture off completely, a call then costs one relaxed load before being forwarded.
+// Otherwise each function has a sample rate: 0 never captures, 1 captures every call, N captures 1 in N calls (per thread).
+// Calls that aren't captured are still counted, see GetFunctionCallCounts.
+// In statistics mode nothing is sent: every call is timed into call_stats.h and sample rates don't apply.
+static std::atomic<bool> s_CaptureDormant{false};
+
+enum CaptureMode
+{
+    kCaptureModeFull,
+    kCaptureModeStatistics,
+};
+
+static std::atomic<uint32_t> s_CaptureMode{kCaptureModeFull};
+
+// What a hook does with a call, from BeginCall.
+enum CallAction
+{
+    // Straight to the runtime.
+    kForwardCall,
+    // Full capture.
+    kSerializeCall,
+    // Statistics only.
+    kTimeCall,
+    // Statistics, plus serialize it to measure the size and throw it away.
+    kMeasureCall,
+};
+
+static std::atomic<uint32_t> s_SampleRates[kFuncCount];
+
+static const uint32_t kUnknownFunction = 0xFFFFFFFF;
+
+struct SampleRateInit
+{
+    SampleRateInit()
+    {
+        for (auto& rate : s_SampleRates)
+            rate.store(1, std::memory_order_relaxed);
+    }
+};
+static SampleRateInit s_SampleRateInit;
+
+static CallAction BeginCall(FuncId id)
+{
+    if (s_CaptureDormant.load(std::memory_order_relaxed))
+        return kForwardCall;
+
+    // Only this thread writes its counters, so plain loads and stores are enough.
+    ThreadContext* context = GetThreadContext();
+    uint64_t calls = context->callCounts[id].load(std::memory_order_relaxed);
+    context->callCounts[id].store(calls + 1, std::memory_order_relaxed);
+
+    if (s_CaptureMode.load(std::memory_order_relaxed) == kCaptureModeStatistics)
+    {
+        if (calls % kMeasureInterval != 0)
+            return kTimeCall;
+        context->measuring = true;
+        context->measureFunc = id;
+        return kMeasureCall;
+    }
+
+    uint32_t rate = s_SampleRates[id].load(std::memory_order_relaxed);
+    if (rate == 0 || (rate != 1 && calls % rate != 0))
+        return kForwardCall;
+
+    uint64_t captured = context->capturedCounts[id].load(std::memory_order_relaxed);
+    context->capturedCounts[id].store(captured + 1, std::memory_order_relaxed);
+    return kSerializeCall;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT SetCaptureDormant(bool dormant)
+{
+    s_CaptureDormant = dormant;
+}
+
+// mode is a CaptureMode.
+extern "C" bool UNITY_INTERFACE_EXPORT SetCaptureMode(uint32_t mode)
+{
+    if (mode != kCaptureModeFull && mode != kCaptureModeStatistics)
+        return false;
+    s_CaptureMode = mode;
+    return true;
+}
+
+// Returns kUnknownFunction if name isn't a hooked function.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT GetFunctionId(const char* name)
+{
+    if (name == nullptr)
+        return kUnknownFunction;
+
+    for (uint32_t id = 0; id < kFuncCount; ++id)
+    {
+        if (strcmp(s_FuncNames[id], name) == 0)
+            return id;
+    }
+    return kUnknownFunction;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT SetFunctionSampleRate(uint32_t id, uint32_t rate)
+{
+    if (id >= kFuncCount)
+        return false;
+    s_SampleRates[id] = rate;
+    return true;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT SetAllFunctionsSampleRate(uint32_t rate)
+{
+    for (auto& sampleRate : s_SampleRates)
+        sampleRate = rate;
+}
+
+// Totals across all threads.  calls counts every call made while not dormant, captured the ones that were sent in full capture.
+extern "C" bool UNITY_INTERFACE_EXPORT GetFunctionCallCounts(uint32_t id, uint64_t* calls, uint64_t* captured)
+{
+    if (id >= kFuncCount)
+        return false;
+
+    *calls = 0;
+    *captured = 0;
+    for (ThreadContext* context = s_ThreadContexts.load(std::memory_order_acquire); context != nullptr; context = context->nextContext)
+    {
+        *calls += context->callCounts[id].load(std::memory_order_relaxed);
+        *captured += context->capturedCounts[id].load(std::memory_order_relaxed);
+    }
+    return true;
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <condition_variable>
+#include <thread>
+#include <tuple>
+
+// With deferred formatting on, a captured call isn't serialized on the thread that made it.  The hook copies the
+// call's arguments, and everything they point to that the Send path reads, into the stream's CaptureArena
+// (serialize_capture.h) and queues a DeferredRef in its place, so it stays in order with the thread's other calls.
+// Whoever drains the queue, normally the formatter thread below, runs the same SendToCSharp code on the copy.
+// Calls whose arguments don't fit in the free part of the arena are serialized on the calling thread as before.
+//
+// Deferred calls are delta encoded with the stream's formatDelta instead of delta.  Sequence numbers still come from
+// the calling thread, and every switch between the two sends a keyframe, so the decoder sees one stream.
+
+static const uint32_t kFormatterIntervalMs = 2;
+
+static std::atomic<bool> s_DeferFormatting{false};
+
+// A queue record starting with this byte is a DeferredRef, no command uses it.
+static const uint8_t kDeferredCallTag = 0xFE;
+
+// Stored in the arena after the call's arguments.
+struct DeferredCall
+{
+    // Format_xrFoo from serialize_funcs.h, which sends args.
+    void (*format)(const void* args);
+    const void* args;
+    const char* funcName;
+    uint64_t startTime;
+    uint64_t duration;
+    XrResult result;
+    uint32_t frame;
+    uint16_t sequence;
+    bool keyframe;
+};
+
+struct DeferredRef
+{
+    uint8_t tag;
+    const DeferredCall* call;
+    // Released once the call is formatted.
+    uint32_t spanEnd;
+};
+
+// The argument types of an OpenXR function, as the tuple Capture_xrFoo stores them in.
+template <typename Func>
+struct FuncArgs;
+
+template <typename... Params>
+struct FuncArgs<XrResult(XRAPI_PTR*)(Params...)>
+{
+    typedef std::tuple<Params...> type;
+};
+
+template <size_t... Indices>
+struct ArgIndices
+{
+};
+
+template <size_t Count, size_t... Indices>
+struct MakeArgIndices : MakeArgIndices<Count - 1, Count - 1, Indices...>
+{
+};
+
+template <size_t... Indices>
+struct MakeArgIndices<0, Indices...>
+{
+    typedef ArgIndices<Indices...> type;
+};
+
+template <typename... Params, size_t... Indices>
+static void CallWithArgs(void (*send)(Params...), const std::tuple<Params...>& args, ArgIndices<Indices...>)
+{
+    send(std::get<Indices>(args)...);
+}
+
+template <typename... Params>
+static void CallWithArgs(void (*send)(Params...), const std::tuple<Params...>& args)
+{
+    CallWithArgs(send, args, typename MakeArgIndices<sizeof...(Params)>::type());
+}
+
+static std::thread s_FormatterThread;
+static std::mutex s_FormatterControlMutex;
+static std::mutex s_FormatterMutex;
+static std::condition_variable s_FormatterCondition;
+static bool s_FormatterStop = false;
+
+// Deferred calls are formatted here, one at a time.  Protected by s_DataMutex.
+static RecordWriter s_FormatRecord = {};
+
+static bool DeferringCalls()
+{
+    return s_DeferFormatting.load(std::memory_order_relaxed);
+}
+
+// The calling thread's stream with an arena span started, for Capture_xrFoo.  Every call goes on to EndDeferredCall.
+static CaptureArena& BeginDeferredCall()
+{
+    CallStream* stream = BeginStreamCall();
+    CaptureArena& arena = stream->capture;
+    if (arena.data == nullptr)
+    {
+        // Counted against the budget like the stream's other buffers, a stream over it keeps formatting its own calls.
+        uint32_t size = s_PerThreadCacheSize;
+        if (stream->shared || s_StreamBytes.load(std::memory_order_relaxed) + size <= s_ThreadMemoryBudget)
+        {
+            arena.Create(size);
+            TrackMemory(arena.capacity);
+            if (!stream->shared)
+                s_StreamBytes.fetch_add(arena.capacity, std::memory_order_relaxed);
+        }
+    }
+    arena.Begin();
+    return arena;
+}
+
+static bool PublishDeferredCall(CallStream* stream, const DeferredCall* call)
+{
+    DeferredRef ref;
+    memset(&ref, 0, sizeof(ref));
+    ref.tag = kDeferredCallTag;
+    ref.call = call;
+    ref.spanEnd = stream->capture.SpanEnd();
+
+    // Draining here would format on the calling thread, drop instead like any other record that doesn't fit.
+    if (!stream->queue.TryReserve(sizeof(ref)))
+        return false;
+
+    stream->queue.Write((const uint8_t*)&ref, sizeof(ref));
+    stream->queue.Publish();
+    stream->capture.Commit(ref.spanEnd);
+    return true;
+}
+
+// args is what Capture_xrFoo returned, nullptr if the arena was full.
+// Returns false if the call wasn't deferred, it then has to be serialized with StartFunctionCall.
+static bool EndDeferredCall(const char* funcName, void (*format)(const void*), const void* args, XrResult result, uint64_t startTime, uint64_t duration, uint32_t frame)
+{
+    CallStream* stream = s_CallStream;
+    CaptureArena& arena = stream->capture;
+    DeferredCall* call = args != nullptr ? (DeferredCall*)arena.Alloc(sizeof(DeferredCall), alignof(DeferredCall)) : nullptr;
+    if (call != nullptr)
+    {
+        // The formatter picks up the delta state wherever it left it, unless calls were formatted here in between.
+        DeltaState& delta = stream->delta;
+        call->format = format;
+        call->args = args;
+        call->funcName = funcName;
+        call->startTime = startTime;
+        call->duration = duration;
+        call->result = result;
+        call->frame = frame;
+        call->sequence = ++delta.sequence;
+        call->keyframe = delta.forceKeyframe || !stream->lastCallDeferred;
+
+        if (PublishDeferredCall(stream, call))
+        {
+            delta.forceKeyframe = false;
+            stream->lastCallDeferred = true;
+        }
+        else
+        {
+            delta.forceKeyframe = true;
+            stream->queue.droppedRecords.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Don't wait for the next interval when the arena or queue is filling up.
+        if (arena.UsedBytes() > arena.capacity / 2 || stream->queue.UsedBytes() > stream->queue.capacity / 2)
+            RequestDrain();
+    }
+
+    if (stream->shared)
+        s_OverflowMutex.unlock();
+    return call != nullptr;
+}
+
+static bool IsDeferredCall(const uint8_t* first, uint32_t firstSize, uint32_t secondSize)
+{
+    return firstSize + secondSize == sizeof(DeferredRef) && first[0] == kDeferredCallTag;
+}
+
+// Must be called with s_DataMutex held, from DrainThreadQueues.  Returns false if the record isn't a DeferredRef.
+static bool DrainDeferredCall(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize)
+{
+    if (!IsDeferredCall(first, firstSize, secondSize))
+        return false;
+
+    // The queue may have split it at the wrap point.
+    DeferredRef ref;
+    memcpy(&ref, first, firstSize);
+    memcpy((uint8_t*)&ref + firstSize, second, secondSize);
+    const DeferredCall& call = *ref.call;
+
+    RecordWriter& record = s_FormatRecord;
+    if (record.fixedCapacity != s_PerThreadCacheSize)
+    {
+        TrackMemory(-(int64_t)record.fixedCapacity);
+        record.Destroy();
+        record.Create(s_PerThreadCacheSize);
+        TrackMemory(record.fixedCapacity);
+    }
+
+    DeltaState& delta = stream->formatDelta;
+    if (call.keyframe)
+        delta.forceKeyframe = true;
+
+    // The drain may run on a calling thread that's between calls of its own.
+    RecordWriter* callerRecord = s_Record;
+    DeltaState* callerDelta = s_Delta;
+    s_Record = &record;
+    s_Delta = &delta;
+
+    WriteCallStart(record, delta, stream->threadIndex, call.sequence, call.funcName);
+    call.format(call.args);
+    WriteCallEnd(record, delta, call.result, call.startTime, call.duration, call.frame);
+    if (record.overflowed)
+        WriteCacheNotLargeEnough(record, delta, stream->threadIndex, call.funcName, call.result, call.startTime, call.duration, call.frame);
+    if (!record.overflowed)
+        DrainRecord(stream, record.base, record.Size(), record.pos, 0);
+    else
+        stream->queue.droppedRecords.fetch_add(1, std::memory_order_relaxed);
+    record.Reset();
+
+    s_Record = callerRecord;
+    s_Delta = callerDelta;
+    stream->capture.Release(ref.spanEnd);
+    return true;
+}
+
+static void FormatterThread()
+{
+    std::unique_lock<std::mutex> lock(s_FormatterMutex);
+    while (!s_FormatterStop)
+    {
+        s_FormatterCondition.wait_for(lock, std::chrono::milliseconds(kFormatterIntervalMs));
+        if (s_FormatterStop)
+            break;
+
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> dataLock(s_DataMutex);
+            DrainThreadQueues();
+        }
+        lock.lock();
+    }
+}
+
+// For calling threads whose queue is filling up.  While the formatter thread runs it does every drain, so a calling
+// thread never formats a deferred call or waits on one being formatted, it only wakes the formatter.
+static void RequestDrain()
+{
+    if (DeferringCalls())
+        s_FormatterCondition.notify_one();
+    else
+        TryDrainThreadQueues();
+}
+
+// Must be called with s_FormatterControlMutex held.
+static void StopFormatter()
+{
+    s_DeferFormatting = false;
+    if (!s_FormatterThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(s_FormatterMutex);
+        s_FormatterStop = true;
+    }
+    s_FormatterCondition.notify_one();
+    s_FormatterThread.join();
+}
+
+// The formatter thread has to be joined before static destruction.
+struct FormatterShutdown
+{
+    ~FormatterShutdown()
+    {
+        std::lock_guard<std::mutex> lock(s_FormatterControlMutex);
+        StopFormatter();
+    }
+};
+static FormatterShutdown s_FormatterShutdown;
+
+// Moves serializing captured calls off the calling threads onto a background thread.  Calls already deferred are
+// formatted by the next drain either way.
+extern "C" void UNITY_INTERFACE_EXPORT SetDeferredFormatting(bool deferred)
+{
+    std::lock_guard<std::mutex> lock(s_FormatterControlMutex);
+    if (!deferred)
+    {
+        StopFormatter();
+        // Calling threads don't format deferred calls, so do the ones still queued before they hold anything up.
+        std::lock_guard<std::mutex> dataLock(s_DataMutex);
+        DrainThreadQueues();
+        return;
+    }
+
+    if (!s_FormatterThread.joinable())
+    {
+        s_FormatterStop = false;
+        s_FormatterThread = std::thread(FormatterThread);
+    }
+    s_DeferFormatting = true;
+}
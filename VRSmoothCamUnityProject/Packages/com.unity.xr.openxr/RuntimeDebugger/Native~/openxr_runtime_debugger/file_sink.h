@@ -0,0 +1,377 @@
+#pragma once
+
+// Streams every drained call record into memory-mapped trace files, for long sessions without the editor attached.
+// Drains copy records straight into the mapped file, they never make a syscall.  A background thread does
+// everything else: drains the queues when nobody else has, msyncs, maps the next file ahead of time and
+// finalizes full ones.  If the next file isn't ready when the current one fills, records are dropped and counted.
+//
+// A trace file is a TraceFileHeader (trace_format.h) followed by the same command stream GetDataForRead returns, starting
+// with kNameTable, kEnumTable and kSchemaTable and with a kThreadInfo before each thread's first record in that file, so every file can
+// be read on its own.  header.dataSize only ever covers whole records, so a file cut short by a crash is still
+// readable up to it.
+//
+// Only implemented for platforms with mmap.
+
+#if !defined(_WIN32)
+
+#include <condition_variable>
+#include <cstdio>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+static const uint32_t kFileSinkFlushIntervalMs = 100;
+
+struct TraceSegment
+{
+    int fd = -1;
+    uint8_t* base = nullptr;
+    uint32_t size = 0;
+    uint32_t used = 0;
+    uint64_t sequence = 0;
+    std::string path;
+};
+
+// Protected by s_DataMutex, except where noted.
+static bool s_FileSinkActive = false;
+static TraceSegment s_FileSegment;
+// Mapped ahead of time by the flusher, swapped in by whoever fills s_FileSegment.
+static TraceSegment s_NextFileSegment;
+// Full segment waiting for the flusher to finalize it.
+static TraceSegment s_RetiredFileSegment;
+static std::atomic<uint64_t> s_FileSinkDroppedRecords{0};
+
+// Only touched by StartFileSink, StopFileSink and the flusher thread.
+static std::string s_FileSinkDirectory;
+static uint32_t s_FileSinkFileSize = 0;
+static uint32_t s_FileSinkMaxFiles = 0;
+static uint64_t s_FileSinkNextSequence = 1;
+static std::thread s_FileSinkThread;
+static std::mutex s_FileSinkStopMutex;
+static std::condition_variable s_FileSinkStopCondition;
+static bool s_FileSinkStop = false;
+
+static std::string TraceFilePath(uint64_t sequence)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "/openxr_trace_%d_%06llu.oxrt", (int)getpid(), (unsigned long long)sequence);
+    return s_FileSinkDirectory + name;
+}
+
+static TraceFileHeader* SegmentHeader(const TraceSegment& segment)
+{
+    return (TraceFileHeader*)segment.base;
+}
+
+static void AppendToSegment(TraceSegment& segment, const void* data, uint32_t size)
+{
+    memcpy(segment.base + segment.used, data, size);
+    segment.used += size;
+}
+
+template <typename T>
+static void AppendToSegment(TraceSegment& segment, T t)
+{
+    AppendToSegment(segment, &t, sizeof(T));
+}
+
+// Flusher thread or StartFileSink.
+static bool CreateSegment(TraceSegment& segment)
+{
+    segment.sequence = s_FileSinkNextSequence++;
+    segment.path = TraceFilePath(segment.sequence);
+    segment.size = s_FileSinkFileSize;
+    segment.used = 0;
+
+    segment.fd = open(segment.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (segment.fd < 0)
+        return false;
+
+    // Populating here, on the flusher, keeps page faults off the threads that fill the file later.
+    int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+    flags |= MAP_POPULATE;
+#endif
+    void* base = MAP_FAILED;
+    if (ftruncate(segment.fd, segment.size) == 0)
+        base = mmap(nullptr, segment.size, PROT_READ | PROT_WRITE, flags, segment.fd, 0);
+    if (base == MAP_FAILED)
+    {
+        close(segment.fd);
+        unlink(segment.path.c_str());
+        segment = TraceSegment();
+        return false;
+    }
+    segment.base = (uint8_t*)base;
+
+    TraceFileHeader header{};
+    memcpy(header.magic, kTraceFileMagic, sizeof(header.magic));
+    header.version = kTraceFileVersion;
+    header.headerSize = sizeof(TraceFileHeader);
+    header.sequence = segment.sequence;
+    AppendToSegment(segment, header);
+
+    AppendToSegment(segment, kNameTable);
+    AppendToSegment(segment, (uint32_t)sizeof(NameBlob));
+    AppendToSegment(segment, &s_Names, sizeof(NameBlob));
+    const std::vector<uint8_t>& enumTable = EnumTable();
+    AppendToSegment(segment, kEnumTable);
+    AppendToSegment(segment, (uint32_t)enumTable.size());
+    AppendToSegment(segment, enumTable.data(), (uint32_t)enumTable.size());
+    const std::vector<uint8_t>& schemaTable = SchemaTable();
+    AppendToSegment(segment, kSchemaTable);
+    AppendToSegment(segment, (uint32_t)schemaTable.size());
+    AppendToSegment(segment, schemaTable.data(), (uint32_t)schemaTable.size());
+    SegmentHeader(segment)->dataSize = segment.used - sizeof(TraceFileHeader);
+    return true;
+}
+
+// Flusher thread or StopFileSink.  Truncates the file to what was written.
+static void FinalizeSegment(TraceSegment& segment)
+{
+    if (segment.base == nullptr)
+        return;
+
+    msync(segment.base, segment.used, MS_SYNC);
+    munmap(segment.base, segment.size);
+    // If this fails the file keeps its full size, the header's dataSize still says where the records end.
+    int truncated = ftruncate(segment.fd, segment.used);
+    (void)truncated;
+    close(segment.fd);
+
+    if (s_FileSinkMaxFiles != 0 && segment.sequence > s_FileSinkMaxFiles)
+        unlink(TraceFilePath(segment.sequence - s_FileSinkMaxFiles).c_str());
+
+    segment = TraceSegment();
+}
+
+// For a segment that was mapped ahead but never written to, or that StartFileSink couldn't use.
+static void DiscardSegment(TraceSegment& segment)
+{
+    if (segment.base == nullptr)
+        return;
+
+    munmap(segment.base, segment.size);
+    close(segment.fd);
+    unlink(segment.path.c_str());
+    segment = TraceSegment();
+}
+
+// Must be called with s_DataMutex held.
+static bool RotateFileSegment()
+{
+    if (s_NextFileSegment.base == nullptr || s_RetiredFileSegment.base != nullptr)
+        return false;
+
+    s_RetiredFileSegment = std::move(s_FileSegment);
+    s_FileSegment = std::move(s_NextFileSegment);
+    s_NextFileSegment = TraceSegment();
+
+    // The new file has to decode on its own.
+    s_KeyframeGeneration.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// The kThreadInfo record that goes before the stream's first record in each file, 0 if it's already there.
+static uint32_t ThreadInfoSize(CallStream* stream)
+{
+    if (stream->fileSequence == s_FileSegment.sequence)
+        return 0;
+    return sizeof(Command) + sizeof(stream->threadIndex) + sizeof(stream->osThreadId) + (uint32_t)strlen(stream->threadName) + 1;
+}
+
+// Must be called with s_DataMutex held, from DrainThreadQueues.
+static void WriteToFileSink(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize)
+{
+    if (!s_FileSinkActive)
+        return;
+
+    uint32_t recordSize = firstSize + secondSize;
+    uint32_t threadInfoSize = ThreadInfoSize(stream);
+    if (s_FileSegment.used + threadInfoSize + recordSize > s_FileSegment.size)
+    {
+        threadInfoSize = 0;
+        if (RotateFileSegment())
+            threadInfoSize = ThreadInfoSize(stream);
+        if (threadInfoSize == 0 || s_FileSegment.used + threadInfoSize + recordSize > s_FileSegment.size)
+        {
+            s_FileSinkDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    if (threadInfoSize != 0)
+    {
+        stream->fileSequence = s_FileSegment.sequence;
+        AppendToSegment(s_FileSegment, kThreadInfo);
+        AppendToSegment(s_FileSegment, stream->threadIndex);
+        AppendToSegment(s_FileSegment, stream->osThreadId);
+        AppendToSegment(s_FileSegment, stream->threadName, (uint32_t)strlen(stream->threadName) + 1);
+    }
+
+    AppendToSegment(s_FileSegment, first, firstSize);
+    AppendToSegment(s_FileSegment, second, secondSize);
+    SegmentHeader(s_FileSegment)->dataSize = s_FileSegment.used - sizeof(TraceFileHeader);
+}
+
+static void FileSinkThread()
+{
+    std::unique_lock<std::mutex> stopLock(s_FileSinkStopMutex);
+    while (!s_FileSinkStopCondition.wait_for(stopLock, std::chrono::milliseconds(kFileSinkFlushIntervalMs), [] { return s_FileSinkStop; }))
+    {
+        TraceSegment retired;
+        uint8_t* flushBase = nullptr;
+        uint32_t flushSize = 0;
+        bool needNext = false;
+        {
+            std::lock_guard<std::mutex> lock(s_DataMutex);
+            DrainThreadQueues();
+            retired = std::move(s_RetiredFileSegment);
+            s_RetiredFileSegment = TraceSegment();
+            flushBase = s_FileSegment.base;
+            flushSize = s_FileSegment.used;
+            needNext = s_NextFileSegment.base == nullptr;
+        }
+
+        // Pages past flushSize may still be written to meanwhile, that's fine for MS_ASYNC.
+        if (flushBase != nullptr)
+            msync(flushBase, flushSize, MS_ASYNC);
+        FinalizeSegment(retired);
+
+        if (needNext)
+        {
+            TraceSegment next;
+            if (CreateSegment(next))
+            {
+                std::lock_guard<std::mutex> lock(s_DataMutex);
+                s_NextFileSegment = std::move(next);
+            }
+        }
+    }
+}
+
+static void StopFileSinkInternal()
+{
+    if (!s_FileSinkThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> stopLock(s_FileSinkStopMutex);
+        s_FileSinkStop = true;
+    }
+    s_FileSinkStopCondition.notify_one();
+    s_FileSinkThread.join();
+
+    std::lock_guard<std::mutex> lock(s_DataMutex);
+    DrainThreadQueues();
+    s_FileSinkActive = false;
+    FinalizeSegment(s_RetiredFileSegment);
+    FinalizeSegment(s_FileSegment);
+    if (s_NextFileSegment.base != nullptr)
+        s_FileSinkNextSequence = s_NextFileSegment.sequence;
+    DiscardSegment(s_NextFileSegment);
+}
+
+// The flusher thread has to be joined before static destruction.
+struct FileSinkShutdown
+{
+    ~FileSinkShutdown()
+    {
+        StopFileSinkInternal();
+    }
+};
+static FileSinkShutdown s_FileSinkShutdown;
+
+// Starts writing trace files to directory, rotating every fileSize bytes and keeping the last maxFiles (0 keeps all).
+// Restarts the sink if it was already running.
+extern "C" bool UNITY_INTERFACE_EXPORT StartFileSink(const char* directory, uint32_t fileSize, uint32_t maxFiles)
+{
+    StopFileSinkInternal();
+
+    if (directory == nullptr)
+        return false;
+
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0)
+        pageSize = 4096;
+    uint32_t minSize = sizeof(TraceFileHeader) + 3 * (sizeof(Command) + sizeof(uint32_t)) + sizeof(NameBlob) + (uint32_t)EnumTable().size() + (uint32_t)SchemaTable().size() + (uint32_t)pageSize;
+    if (fileSize < minSize)
+        fileSize = minSize;
+    fileSize = (uint32_t)((fileSize + pageSize - 1) / pageSize * pageSize);
+
+    s_FileSinkDirectory = directory;
+    s_FileSinkFileSize = fileSize;
+    s_FileSinkMaxFiles = maxFiles;
+    s_FileSinkStop = false;
+
+    TraceSegment first;
+    TraceSegment next;
+    if (!CreateSegment(first) || !CreateSegment(next))
+    {
+        // Finalizing would leave a file with only the tables in it, and with maxFiles unlink an older one.
+        DiscardSegment(first);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_DataMutex);
+        s_FileSegment = std::move(first);
+        s_NextFileSegment = std::move(next);
+        s_FileSinkActive = true;
+    }
+
+    s_FileSinkThread = std::thread(FileSinkThread);
+    return true;
+}
+
+// Writes out everything captured so far and closes the current file.
+extern "C" void UNITY_INTERFACE_EXPORT StopFileSink()
+{
+    StopFileSinkInternal();
+}
+
+#else
+
+static void WriteToFileSink(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize)
+{
+}
+
+static std::atomic<uint64_t> s_FileSinkDroppedRecords{0};
+
+extern "C" bool UNITY_INTERFACE_EXPORT StartFileSink(const char* directory, uint32_t fileSize, uint32_t maxFiles)
+{
+    return false;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT StopFileSink()
+{
+}
+
+#endif
+
+// Records that didn't make it into a trace file because the next file wasn't ready yet.
+extern "C" uint64_t UNITY_INTERFACE_EXPORT GetFileSinkDroppedRecords()
+{
+    return s_FileSinkDroppedRecords.load();
+}
+
+// Lets soak runs capture to file without any code, set OPENXR_RUNTIME_DEBUGGER_TRACE_DIR before starting the player.
+static void StartFileSinkFromEnvironment()
+{
+    static bool started = false;
+    if (started)
+        return;
+    started = true;
+
+    const char* directory = getenv("OPENXR_RUNTIME_DEBUGGER_TRACE_DIR");
+    if (directory == nullptr || directory[0] == 0)
+        return;
+
+    const char* fileSize = getenv("OPENXR_RUNTIME_DEBUGGER_TRACE_FILE_SIZE");
+    const char* maxFiles = getenv("OPENXR_RUNTIME_DEBUGGER_TRACE_MAX_FILES");
+    StartFileSink(directory,
+        fileSize != nullptr ? (uint32_t)strtoul(fileSize, nullptr, 10) : 64 * 1024 * 1024,
+        maxFiles != nullptr ? (uint32_t)strtoul(maxFiles, nullptr, 10) : 0);
+}
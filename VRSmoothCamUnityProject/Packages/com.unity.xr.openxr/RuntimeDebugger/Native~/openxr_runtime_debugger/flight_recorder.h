@@ -0,0 +1,415 @@
+#pragma once
+
+// Flight recorder: the main store keeps overwriting its oldest calls as always, and a trigger freezes a copy of it,
+// so the calls leading up to a problem are kept without the editor attached.  Triggers are any call failing, a given
+// function failing, or a frame taking too long from its xrWaitFrame to the end of its xrEndFrame.
+//
+// The hook that hits a trigger only marks the freeze pending and wakes the flight recorder thread, which drains with
+// s_DataMutex held and makes the copy, so the triggering call is in it and calling threads never copy or wait.  Any
+// other full drain that gets there first makes it instead.
+// The snapshot is the same command stream GetDataForRead returns: the name, enum and schema tables, a kThreadInfo for
+// every thread, then the newest calls that fit.  It only has the calls the reader hasn't taken yet, and threads
+// resume decoding at their next keyframe.
+// The snapshot buffer and the thread are started by StartFlightRecorder.  A snapshot is held until
+// RearmFlightRecorder, later triggers are only counted.  With a directory, the thread also writes every snapshot there
+// as a trace file, and the recorder rearms once it's written.
+// Only captured calls trigger, and xrGetInstanceProcAddr never does: apps probe for extensions with it.
+
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <thread>
+
+enum FreezeTrigger
+{
+    kFreezeNone,
+    kFreezeOnError,
+    kFreezeOnFunctionFailure,
+    kFreezeOnFrameInterval,
+};
+
+// Why the held snapshot was frozen.
+struct FreezeCause
+{
+    uint32_t trigger;
+    uint32_t functionId;
+    int32_t result;
+    uint32_t frame;
+    // GetTimestamp when the triggering call ended.
+    uint64_t time;
+    // kFreezeOnFrameInterval only, xrWaitFrame start to xrEndFrame end in nanoseconds.
+    uint64_t frameInterval;
+};
+
+static std::atomic<bool> s_FlightRecorderActive{false};
+static std::atomic<bool> s_FreezeOnError{false};
+static std::atomic<bool> s_FreezeOnFailure[kFuncCount];
+static std::atomic<uint64_t> s_FreezeFrameInterval{0};
+
+// Cleared by the trigger that claims the next snapshot, set again by RearmFlightRecorder or the snapshot writer.
+static std::atomic<bool> s_FlightRecorderArmed{false};
+// s_PendingCause is written before this is set and read after it's seen.
+static std::atomic<bool> s_FreezePending{false};
+static FreezeCause s_PendingCause;
+static std::atomic<uint64_t> s_Snapshots{0};
+static std::atomic<uint64_t> s_MissedTriggers{0};
+
+// Protected by s_SnapshotMutex.  Lock order: s_DataMutex first, then s_SnapshotMutex.
+static std::mutex s_SnapshotMutex;
+static uint8_t* s_Snapshot = nullptr;
+static uint32_t s_SnapshotCapacity = 0;
+static uint32_t s_SnapshotSize = 0;
+static FreezeCause s_SnapshotCause = {};
+
+// How long the flight recorder thread waits before trying again when a reader has the last snapshot.
+static const uint32_t kFreezeRetryMs = 1;
+
+// Only touched by StartFlightRecorder, StopFlightRecorder and the flight recorder thread, except where noted.
+static std::string s_SnapshotDirectory;
+static std::thread s_FlightRecorderThread;
+// Protects s_SnapshotUnwritten and s_FlightRecorderStop, and is what Freeze wakes the thread with.
+static std::mutex s_FlightRecorderMutex;
+static std::condition_variable s_FlightRecorderCondition;
+static bool s_SnapshotUnwritten = false;
+static bool s_FlightRecorderStop = false;
+static std::atomic<uint64_t> s_SnapshotsWritten{0};
+static std::atomic<uint64_t> s_SnapshotWriteFailures{0};
+
+static void AppendToSnapshot(const void* data, uint32_t size)
+{
+    memcpy(s_Snapshot + s_SnapshotSize, data, size);
+    s_SnapshotSize += size;
+}
+
+template <typename T>
+static void AppendToSnapshot(T t)
+{
+    AppendToSnapshot(&t, sizeof(T));
+}
+
+static void AppendTableToSnapshot(Command command, const void* table, uint32_t size)
+{
+    AppendToSnapshot(command);
+    AppendToSnapshot(size);
+    AppendToSnapshot(table, size);
+}
+
+// Room for calls on top of the tables in the smallest snapshot buffer.
+static const uint32_t kMinSnapshotCallBytes = 64 * 1024;
+
+static uint32_t SnapshotTablesSize()
+{
+    return 3 * (sizeof(Command) + sizeof(uint32_t)) + sizeof(NameBlob) + (uint32_t)EnumTable().size() + (uint32_t)SchemaTable().size();
+}
+
+// What the snapshot needs before any calls, s_StreamPoolMutex held.
+static uint32_t SnapshotMetadataSize()
+{
+    uint32_t size = SnapshotTablesSize();
+    for (CallStream* stream = s_CallStreams.load(std::memory_order_acquire); stream != nullptr; stream = stream->nextStream)
+        size += sizeof(Command) + sizeof(stream->threadIndex) + sizeof(stream->osThreadId) + (uint32_t)strlen(stream->threadName) + 1;
+    return size;
+}
+
+// Called at the end of every drain but the calling threads', with s_DataMutex held.
+static void FreezePendingSnapshot()
+{
+    if (!s_FreezePending.load(std::memory_order_acquire))
+        return;
+
+    // A reader or the file writer has the last snapshot, the next drain tries again.
+    std::unique_lock<std::mutex> snapshotLock(s_SnapshotMutex, std::try_to_lock);
+    if (!snapshotLock.owns_lock())
+        return;
+    s_FreezePending.store(false, std::memory_order_relaxed);
+    if (s_Snapshot == nullptr)
+        return;
+
+    s_SnapshotSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_StreamPoolMutex);
+        // Only with a lot of threads, the trigger is missed rather than leaving the recorder disarmed.
+        if (SnapshotMetadataSize() > s_SnapshotCapacity)
+        {
+            s_MissedTriggers.fetch_add(1, std::memory_order_relaxed);
+            s_FlightRecorderArmed.store(true);
+            return;
+        }
+
+        AppendTableToSnapshot(kNameTable, &s_Names, sizeof(NameBlob));
+        const std::vector<uint8_t>& enumTable = EnumTable();
+        AppendTableToSnapshot(kEnumTable, enumTable.data(), (uint32_t)enumTable.size());
+        const std::vector<uint8_t>& schemaTable = SchemaTable();
+        AppendTableToSnapshot(kSchemaTable, schemaTable.data(), (uint32_t)schemaTable.size());
+        for (CallStream* stream = s_CallStreams.load(std::memory_order_acquire); stream != nullptr; stream = stream->nextStream)
+        {
+            AppendToSnapshot(kThreadInfo);
+            AppendToSnapshot(stream->threadIndex);
+            AppendToSnapshot(stream->osThreadId);
+            AppendToSnapshot(stream->threadName, (uint32_t)strlen(stream->threadName) + 1);
+        }
+    }
+    s_SnapshotSize += s_WriteStore->CopyNewest(s_Snapshot + s_SnapshotSize, s_SnapshotCapacity - s_SnapshotSize);
+    s_SnapshotCause = s_PendingCause;
+    s_Snapshots.fetch_add(1, std::memory_order_relaxed);
+
+    if (!s_SnapshotDirectory.empty())
+    {
+        std::lock_guard<std::mutex> lock(s_FlightRecorderMutex);
+        s_SnapshotUnwritten = true;
+        s_FlightRecorderCondition.notify_one();
+    }
+}
+
+static void Freeze(const FreezeCause& cause)
+{
+    bool armed = true;
+    if (!s_FlightRecorderArmed.compare_exchange_strong(armed, false))
+    {
+        s_MissedTriggers.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    s_PendingCause = cause;
+    s_FreezePending.store(true, std::memory_order_release);
+    // Only held by the thread while it checks what to do next, so the wakeup isn't lost.
+    {
+        std::lock_guard<std::mutex> lock(s_FlightRecorderMutex);
+    }
+    s_FlightRecorderCondition.notify_one();
+}
+
+// Called by every hook once its call has been sent.
+static void CheckFreezeTriggers(FuncId id, XrResult result, uint32_t frame, uint64_t startTime, uint64_t duration)
+{
+    if (!s_FlightRecorderActive.load(std::memory_order_relaxed))
+        return;
+
+    FreezeCause cause = {kFreezeNone, id, result, frame, startTime + duration, 0};
+    if (XR_FAILED(result) && s_FreezeOnError.load(std::memory_order_relaxed))
+        cause.trigger = kFreezeOnError;
+    else if (XR_FAILED(result) && s_FreezeOnFailure[id].load(std::memory_order_relaxed))
+        cause.trigger = kFreezeOnFunctionFailure;
+
+    uint64_t threshold = s_FreezeFrameInterval.load(std::memory_order_relaxed);
+    if (cause.trigger == kFreezeNone && id == kFunc_xrEndFrame && threshold != 0)
+    {
+        uint64_t waitStart;
+        {
+            std::lock_guard<std::mutex> lock(s_FrameMutex);
+            waitStart = s_CurrentFrame.waitStart;
+        }
+        if (waitStart != 0 && cause.time - waitStart > threshold)
+        {
+            cause.trigger = kFreezeOnFrameInterval;
+            cause.frameInterval = cause.time - waitStart;
+        }
+    }
+
+    if (cause.trigger != kFreezeNone)
+        Freeze(cause);
+}
+
+static bool WriteSnapshotFile(uint64_t sequence)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "/openxr_snapshot_%lld_%06llu.oxrt", (long long)time(nullptr), (unsigned long long)sequence);
+    std::string path = s_SnapshotDirectory + name;
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+        return false;
+
+    TraceFileHeader header{};
+    memcpy(header.magic, kTraceFileMagic, sizeof(header.magic));
+    header.version = kTraceFileVersion;
+    header.headerSize = sizeof(TraceFileHeader);
+    header.sequence = sequence;
+    header.dataSize = s_SnapshotSize;
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(s_Snapshot, 1, s_SnapshotSize, file) == s_SnapshotSize;
+    return fclose(file) == 0 && written;
+}
+
+// Freezes pending snapshots with a full drain, and writes them out when there's a directory.
+static void FlightRecorderThread()
+{
+    std::unique_lock<std::mutex> recorderLock(s_FlightRecorderMutex);
+    for (;;)
+    {
+        s_FlightRecorderCondition.wait(recorderLock, [] { return s_FreezePending.load(std::memory_order_acquire) || s_SnapshotUnwritten || s_FlightRecorderStop; });
+        if (s_FlightRecorderStop)
+            return;
+
+        if (s_FreezePending.load(std::memory_order_acquire))
+        {
+            recorderLock.unlock();
+            {
+                std::lock_guard<std::mutex> dataLock(s_DataMutex);
+                DrainThreadQueues();
+            }
+            recorderLock.lock();
+
+            // Someone has s_SnapshotMutex, retry shortly rather than wait for the next trigger.
+            if (s_FreezePending.load(std::memory_order_acquire) && !s_SnapshotUnwritten)
+            {
+                s_FlightRecorderCondition.wait_for(recorderLock, std::chrono::milliseconds(kFreezeRetryMs));
+                continue;
+            }
+        }
+
+        if (!s_SnapshotUnwritten)
+            continue;
+        s_SnapshotUnwritten = false;
+        recorderLock.unlock();
+
+        {
+            std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+            if (WriteSnapshotFile(s_Snapshots.load(std::memory_order_relaxed)))
+                s_SnapshotsWritten.fetch_add(1, std::memory_order_relaxed);
+            else
+                s_SnapshotWriteFailures.fetch_add(1, std::memory_order_relaxed);
+        }
+        s_FlightRecorderArmed.store(true);
+
+        recorderLock.lock();
+    }
+}
+
+static void StopFlightRecorderInternal()
+{
+    s_FlightRecorderActive = false;
+    if (s_FlightRecorderThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(s_FlightRecorderMutex);
+            s_FlightRecorderStop = true;
+        }
+        s_FlightRecorderCondition.notify_one();
+        s_FlightRecorderThread.join();
+    }
+
+    std::lock_guard<std::mutex> dataLock(s_DataMutex);
+    std::lock_guard<std::mutex> snapshotLock(s_SnapshotMutex);
+    s_FreezePending = false;
+    s_FlightRecorderArmed = false;
+    if (s_Snapshot != nullptr)
+    {
+        TrackMemory(-(int64_t)s_SnapshotCapacity);
+        free(s_Snapshot);
+        s_Snapshot = nullptr;
+    }
+    s_SnapshotCapacity = 0;
+    s_SnapshotSize = 0;
+    s_SnapshotCause = {};
+}
+
+// The flight recorder thread has to be joined before static destruction.
+struct FlightRecorderShutdown
+{
+    ~FlightRecorderShutdown()
+    {
+        StopFlightRecorderInternal();
+    }
+};
+static FlightRecorderShutdown s_FlightRecorderShutdown;
+
+// Allocates snapshotSize bytes for snapshots, at least enough for the tables and some calls, and arms the recorder.  directory may be nullptr to only keep snapshots in
+// memory, otherwise every snapshot is also written to it.  Triggers are kept from one start to the next.
+// Restarts the recorder if it was already running, dropping the snapshot it held.
+extern "C" bool UNITY_INTERFACE_EXPORT StartFlightRecorder(uint32_t snapshotSize, const char* directory)
+{
+    StopFlightRecorderInternal();
+
+    snapshotSize = std::max(snapshotSize, SnapshotTablesSize() + kMinSnapshotCallBytes);
+    {
+        std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+        s_Snapshot = (uint8_t*)malloc(snapshotSize);
+        if (s_Snapshot == nullptr)
+            return false;
+        s_SnapshotCapacity = snapshotSize;
+        TrackMemory(snapshotSize);
+    }
+
+    s_SnapshotDirectory = directory != nullptr ? directory : "";
+    s_SnapshotUnwritten = false;
+    s_FlightRecorderStop = false;
+    s_FlightRecorderThread = std::thread(FlightRecorderThread);
+
+    s_FlightRecorderArmed = true;
+    s_FlightRecorderActive = true;
+    return true;
+}
+
+// Frees the snapshot buffer, the snapshot it held is lost.
+extern "C" void UNITY_INTERFACE_EXPORT StopFlightRecorder()
+{
+    StopFlightRecorderInternal();
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT SetFreezeOnError(bool freeze)
+{
+    s_FreezeOnError = freeze;
+}
+
+// id is from GetFunctionId.
+extern "C" bool UNITY_INTERFACE_EXPORT SetFreezeOnFunctionFailure(uint32_t id, bool freeze)
+{
+    if (id >= kFuncCount)
+        return false;
+    s_FreezeOnFailure[id] = freeze;
+    return true;
+}
+
+// 0 turns the trigger off.
+extern "C" void UNITY_INTERFACE_EXPORT SetFreezeOnFrameInterval(uint64_t nanoseconds)
+{
+    s_FreezeFrameInterval = nanoseconds;
+}
+
+// Lets the next trigger freeze a new snapshot, replacing the one held.
+extern "C" void UNITY_INTERFACE_EXPORT RearmFlightRecorder()
+{
+    if (s_FlightRecorderActive)
+        s_FlightRecorderArmed = true;
+}
+
+// Holds the snapshot until EndSnapshotAccess, it's read in one span.  Returns false and holds nothing if no snapshot
+// was frozen since the recorder started.
+extern "C" bool UNITY_INTERFACE_EXPORT StartSnapshotAccess(uint8_t** ptr, uint32_t* size, FreezeCause* cause)
+{
+    s_SnapshotMutex.lock();
+    if (s_SnapshotCause.trigger == kFreezeNone)
+    {
+        s_SnapshotMutex.unlock();
+        return false;
+    }
+    *ptr = s_Snapshot;
+    *size = s_SnapshotSize;
+    *cause = s_SnapshotCause;
+    return true;
+}
+
+// Only after StartSnapshotAccess returned true.
+extern "C" void UNITY_INTERFACE_EXPORT EndSnapshotAccess()
+{
+    s_SnapshotMutex.unlock();
+}
+
+struct FlightRecorderStats
+{
+    uint64_t snapshots;
+    // Triggers hit while a snapshot was held.
+    uint64_t missedTriggers;
+    uint64_t snapshotsWritten;
+    uint64_t writeFailures;
+    uint32_t armed;
+    uint32_t snapshotCapacity;
+};
+
+extern "C" void UNITY_INTERFACE_EXPORT GetFlightRecorderStats(FlightRecorderStats* stats)
+{
+    stats->snapshots = s_Snapshots.load(std::memory_order_relaxed);
+    stats->missedTriggers = s_MissedTriggers.load(std::memory_order_relaxed);
+    stats->snapshotsWritten = s_SnapshotsWritten.load(std::memory_order_relaxed);
+    stats->writeFailures = s_SnapshotWriteFailures.load(std::memory_order_relaxed);
+    stats->armed = s_FlightRecorderArmed.load() ? 1 : 0;
+    stats->snapshotCapacity = s_SnapshotCapacity;
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+// Frame scoped timing.  Every xrEndFrame ends a frame, and every call after it, on any thread, belongs to the next
+// one, up to and including that frame's xrEndFrame.  So a frame has its xrWaitFrame and xrBeginFrame and everything
+// the app called in between, except that an app waiting for the next frame before submitting this one has the wait
+// counted in this frame.
+// Captured calls carry their frame, and xrEndFrame sends a kFrameSummary for the frame it ends, see trace_format.h:
+// when its xrWaitFrame, xrBeginFrame and xrEndFrame were called, the display time the runtime predicted against the
+// one the frame was submitted for, and each function's time in the runtime.
+// Only captured calls are tracked: a function sampled out of full capture is missing from the summaries, and frames
+// aren't counted while xrEndFrame is sampled out.  Statistics mode counts frames but sends no summaries.
+
+// Frames ended so far, the index of the current one.
+static std::atomic<uint32_t> s_FrameIndex{0};
+
+// Calls and time in the runtime per function for one frame, on one thread.
+// Only the owning thread writes them, xrEndFrame adds up every thread's in SendFrameSummary.
+struct FrameTimes
+{
+    // Times from an older frame are stale, the owning thread clears them on its next call.
+    std::atomic<uint32_t> frame;
+    std::atomic<uint32_t> calls[kFuncCount];
+    std::atomic<uint64_t> durations[kFuncCount];
+};
+
+// The frame's xrWaitFrame and xrBeginFrame.  Times are from GetTimestamp.
+struct FrameTimeline
+{
+    // From the last xrWaitFrame to succeed before the frame's xrBeginFrame.
+    XrTime predictedDisplayTime;
+    XrDuration predictedDisplayPeriod;
+    uint64_t waitStart;
+    uint64_t waitDuration;
+
+    uint64_t beginStart;
+};
+
+// Only taken by the frame functions, which may be called from different threads.
+static std::mutex s_FrameMutex;
+static FrameTimeline s_WaitedFrame = {};
+static FrameTimeline s_CurrentFrame = {};
+
+// The frame a call starting now belongs to.  xrEndFrame moves everyone after it on to the next one.
+static uint32_t CurrentFrame(FuncId id)
+{
+    if (id == kFunc_xrEndFrame)
+        return s_FrameIndex.fetch_add(1, std::memory_order_relaxed);
+    return s_FrameIndex.load(std::memory_order_relaxed);
+}
+
+// Only called by the owning thread.
+static void RecordFrameTime(FuncId id, uint32_t frame, uint64_t duration)
+{
+    ThreadContext* context = GetThreadContext();
+    FrameTimes* times = context->frameTimes.load(std::memory_order_relaxed);
+    if (times == nullptr)
+    {
+        times = new FrameTimes();
+        TrackMemory(sizeof(FrameTimes));
+        context->frameTimes.store(times, std::memory_order_release);
+    }
+
+    if (times->frame.load(std::memory_order_relaxed) != frame)
+    {
+        for (auto& calls : times->calls)
+            calls.store(0, std::memory_order_relaxed);
+        for (auto& funcDuration : times->durations)
+            funcDuration.store(0, std::memory_order_relaxed);
+        times->frame.store(frame, std::memory_order_release);
+    }
+
+    Increment<uint32_t>(times->calls[id]);
+    Increment<uint64_t>(times->durations[id], duration);
+}
+
+// Doesn't stop the other threads, so calls they make while it runs may or may not be counted.
+static void SendFrameSummary(uint32_t frame, XrTime submittedDisplayTime, uint64_t endStart, uint64_t endDuration)
+{
+    FrameTimeline timeline;
+    {
+        std::lock_guard<std::mutex> lock(s_FrameMutex);
+        timeline = s_CurrentFrame;
+    }
+
+    uint32_t calls[kFuncCount] = {};
+    uint64_t durations[kFuncCount] = {};
+    uint32_t functionCount = 0;
+    for (ThreadContext* context = s_ThreadContexts.load(std::memory_order_acquire); context != nullptr; context = context->nextContext)
+    {
+        FrameTimes* times = context->frameTimes.load(std::memory_order_acquire);
+        if (times == nullptr || times->frame.load(std::memory_order_acquire) != frame)
+            continue;
+
+        for (uint32_t id = 0; id < kFuncCount; ++id)
+        {
+            uint32_t funcCalls = times->calls[id].load(std::memory_order_relaxed);
+            if (funcCalls == 0)
+                continue;
+            if (calls[id] == 0)
+                ++functionCount;
+            calls[id] += funcCalls;
+            durations[id] += times->durations[id].load(std::memory_order_relaxed);
+        }
+    }
+
+    // A record of its own in the calling thread's stream, so it stays in order with the thread's calls.
+    CallStream* stream = BeginStreamCall();
+    RecordWriter& record = stream->record;
+    record.Reset();
+    uint8_t* p = record.Reserve(1 + kMaxVarUInt32Size + 2 * kMaxVarUInt64Size + 6 * kMaxVarUInt64Size + kMaxVarUInt32Size);
+    if (p != nullptr)
+    {
+        p = PutCommand(p, kFrameSummary);
+        p = PutVarUInt(p, frame);
+        p = PutVarInt(p, timeline.predictedDisplayTime);
+        p = PutVarUInt(p, (uint64_t)timeline.predictedDisplayPeriod);
+        p = PutVarInt(p, submittedDisplayTime - timeline.predictedDisplayTime);
+        p = PutVarUInt(p, timeline.waitStart);
+        p = PutVarUInt(p, timeline.waitDuration);
+        p = PutVarUInt(p, timeline.beginStart);
+        p = PutVarUInt(p, endStart);
+        p = PutVarUInt(p, endDuration);
+        record.Commit(PutVarUInt(p, functionCount));
+    }
+
+    for (uint32_t id = 0; id < kFuncCount; ++id)
+    {
+        if (calls[id] == 0)
+            continue;
+        EncodedName name = EncodeName(s_FuncNames[id]);
+        p = record.Reserve(name.size + kMaxVarUInt32Size + kMaxVarUInt64Size);
+        if (p == nullptr)
+            break;
+        p = PutName(p, name);
+        p = PutVarUInt(p, calls[id]);
+        record.Commit(PutVarUInt(p, durations[id]));
+    }
+
+    if (record.overflowed || !PublishRecord(stream))
+        stream->queue.droppedRecords.fetch_add(1, std::memory_order_relaxed);
+    if (record.Spilled())
+        record.Reset();
+    if (stream->shared)
+        s_OverflowMutex.unlock();
+}
+
+// Called by every hook for the calls it captures, after the call into the runtime.
+// The frame functions have their own overloads below.
+template <typename... Params>
+static void RecordFrameCall(FuncId id, uint32_t frame, XrResult /*result*/, uint64_t /*startTime*/, uint64_t duration, Params... /*params*/)
+{
+    RecordFrameTime(id, frame, duration);
+}
+
+static void RecordFrameCall(FuncId id, uint32_t frame, XrResult result, uint64_t startTime, uint64_t duration, XrSession /*session*/, const XrFrameWaitInfo* /*frameWaitInfo*/, XrFrameState* frameState)
+{
+    RecordFrameTime(id, frame, duration);
+    if (XR_FAILED(result) || frameState == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(s_FrameMutex);
+    s_WaitedFrame.predictedDisplayTime = frameState->predictedDisplayTime;
+    s_WaitedFrame.predictedDisplayPeriod = frameState->predictedDisplayPeriod;
+    s_WaitedFrame.waitStart = startTime;
+    s_WaitedFrame.waitDuration = duration;
+}
+
+static void RecordFrameCall(FuncId id, uint32_t frame, XrResult /*result*/, uint64_t startTime, uint64_t duration, XrSession /*session*/, const XrFrameBeginInfo* /*frameBeginInfo*/)
+{
+    RecordFrameTime(id, frame, duration);
+
+    std::lock_guard<std::mutex> lock(s_FrameMutex);
+    s_CurrentFrame = s_WaitedFrame;
+    s_CurrentFrame.beginStart = startTime;
+}
+
+static void RecordFrameCall(FuncId id, uint32_t frame, XrResult /*result*/, uint64_t startTime, uint64_t duration, XrSession /*session*/, const XrFrameEndInfo* frameEndInfo)
+{
+    RecordFrameTime(id, frame, duration);
+    SendFrameSummary(frame, frameEndInfo != nullptr ? frameEndInfo->displayTime : 0, startTime, duration);
+    SendOverheadReport(frame);
+}
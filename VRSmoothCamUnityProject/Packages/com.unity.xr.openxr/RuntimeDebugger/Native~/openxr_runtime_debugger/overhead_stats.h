@@ -0,0 +1,294 @@
+#pragma once
+
+// What the debugger costs the threads it intercepts.  With SetMeasureOverhead on, every hooked call that isn't
+// forwarded untouched is timed from BeginCall to return, and whatever isn't the call into the runtime is the
+// debugger's overhead: capture, serialization, statistics, and the two places a calling thread can end up waiting on
+// someone else.  It's off by default: the two extra timestamps can double what a call costs in statistics mode.
+// - Drains: calling threads drain every queue into the main store when theirs fills up, with s_DataMutex held.  They
+//   only ever try_lock it, so they don't wait, but a drain can take a while and is timed on its own.  Failed try_locks
+//   are counted as contended drains.  With deferred formatting on they leave it to the formatter thread instead.
+// - Lock waits: threads over the memory budget share the overflow stream and wait on s_OverflowMutex for each other.
+// Overhead includes both, what's left is serialization.  Drains and lock waits are rare and always timed.
+// xrGetInstanceProcAddr isn't counted.
+// Each thread keeps its own OverheadStats like ThreadStats, cleared by ResetStats.  With a budget set, xrEndFrame
+// adds up every thread's overhead for the frame and sends a kOverheadReport when it's over, see trace_format.h.
+
+struct OverheadStats
+{
+    // Stats from an older s_StatsGeneration are stale, the owning thread clears them on its next call.
+    std::atomic<uint32_t> generation;
+    // Of the thread's stream, 0xFFFFFFFF until its first measured call.
+    std::atomic<uint32_t> threadIndex;
+
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> runtimeTime;
+    std::atomic<uint64_t> overheadTime;
+    std::atomic<uint64_t> maxOverhead;
+    std::atomic<uint64_t> drains;
+    std::atomic<uint64_t> drainTime;
+    std::atomic<uint64_t> contendedDrains;
+    std::atomic<uint64_t> lockWaits;
+    std::atomic<uint64_t> lockWaitTime;
+    // Per call overhead and per wait lock wait, in the LatencyBucket buckets of call_stats.h.
+    std::atomic<uint32_t> overheadHistogram[kLatencyBuckets];
+    std::atomic<uint32_t> lockWaitHistogram[kLatencyBuckets];
+};
+
+static std::atomic<bool> s_MeasureOverhead{false};
+
+// Per frame overhead, in nanoseconds added up over all threads, over which xrEndFrame sends a kOverheadReport.
+// 0 sends none.
+static std::atomic<uint64_t> s_OverheadBudget{0};
+
+static OverheadStats* CreateOverheadStats()
+{
+    TrackMemory(sizeof(OverheadStats));
+    OverheadStats* stats = new OverheadStats();
+    stats->threadIndex.store(0xFFFFFFFF, std::memory_order_relaxed);
+    return stats;
+}
+
+// Only called by the owning thread.
+static OverheadStats& GetOverheadStats(ThreadContext* context)
+{
+    OverheadStats* stats = context->overhead.load(std::memory_order_relaxed);
+    uint32_t generation = s_StatsGeneration.load(std::memory_order_relaxed);
+    if (stats->generation.load(std::memory_order_relaxed) != generation)
+    {
+        stats->threadIndex.store(0xFFFFFFFF, std::memory_order_relaxed);
+        stats->calls.store(0, std::memory_order_relaxed);
+        stats->runtimeTime.store(0, std::memory_order_relaxed);
+        stats->overheadTime.store(0, std::memory_order_relaxed);
+        stats->maxOverhead.store(0, std::memory_order_relaxed);
+        stats->drains.store(0, std::memory_order_relaxed);
+        stats->drainTime.store(0, std::memory_order_relaxed);
+        stats->contendedDrains.store(0, std::memory_order_relaxed);
+        stats->lockWaits.store(0, std::memory_order_relaxed);
+        stats->lockWaitTime.store(0, std::memory_order_relaxed);
+        for (auto& count : stats->overheadHistogram)
+            count.store(0, std::memory_order_relaxed);
+        for (auto& count : stats->lockWaitHistogram)
+            count.store(0, std::memory_order_relaxed);
+        stats->generation.store(generation, std::memory_order_release);
+    }
+
+    return *stats;
+}
+
+static void RecordDrain(uint64_t drainTime, bool contended)
+{
+    if (s_ThreadContext == nullptr)
+        return;
+    OverheadStats& stats = GetOverheadStats(s_ThreadContext);
+    if (contended)
+    {
+        Increment<uint64_t>(stats.contendedDrains);
+        return;
+    }
+    Increment<uint64_t>(stats.drains);
+    Increment<uint64_t>(stats.drainTime, drainTime);
+}
+
+static void RecordLockWait(uint64_t waitTime)
+{
+    if (s_ThreadContext == nullptr)
+        return;
+    OverheadStats& stats = GetOverheadStats(s_ThreadContext);
+    Increment<uint64_t>(stats.lockWaits);
+    Increment<uint64_t>(stats.lockWaitTime, waitTime);
+    Increment<uint32_t>(stats.lockWaitHistogram[LatencyBucket(waitTime)]);
+}
+
+// Times a hook from where it's constructed to its return.  The hook sets runtime to its call's duration.
+struct OverheadScope
+{
+    bool measuring = s_MeasureOverhead.load(std::memory_order_relaxed);
+    uint64_t start = measuring ? GetTimestamp() : 0;
+    uint64_t runtime = 0;
+
+    ~OverheadScope()
+    {
+        if (!measuring)
+            return;
+        uint64_t overhead = GetTimestamp() - start - runtime;
+        ThreadContext* context = GetThreadContext();
+        OverheadStats& stats = GetOverheadStats(context);
+        if (context->stream != nullptr)
+            stats.threadIndex.store(context->stream->threadIndex, std::memory_order_relaxed);
+        Increment<uint64_t>(stats.calls);
+        Increment<uint64_t>(stats.runtimeTime, runtime);
+        Increment<uint64_t>(stats.overheadTime, overhead);
+        if (overhead > stats.maxOverhead.load(std::memory_order_relaxed))
+            stats.maxOverhead.store(overhead, std::memory_order_relaxed);
+        Increment<uint32_t>(stats.overheadHistogram[LatencyBucket(overhead)]);
+    }
+};
+
+// Every thread's totals added up.
+struct OverheadTotals
+{
+    uint64_t calls;
+    uint64_t runtimeTime;
+    uint64_t overheadTime;
+    uint64_t drainTime;
+    uint64_t lockWaitTime;
+};
+
+static OverheadTotals AddUpOverhead()
+{
+    uint32_t generation = s_StatsGeneration.load();
+    OverheadTotals totals = {};
+    for (ThreadContext* context = s_ThreadContexts.load(std::memory_order_acquire); context != nullptr; context = context->nextContext)
+    {
+        OverheadStats* stats = context->overhead.load(std::memory_order_acquire);
+        if (stats->generation.load(std::memory_order_acquire) != generation)
+            continue;
+        totals.calls += stats->calls.load(std::memory_order_relaxed);
+        totals.runtimeTime += stats->runtimeTime.load(std::memory_order_relaxed);
+        totals.overheadTime += stats->overheadTime.load(std::memory_order_relaxed);
+        totals.drainTime += stats->drainTime.load(std::memory_order_relaxed);
+        totals.lockWaitTime += stats->lockWaitTime.load(std::memory_order_relaxed);
+    }
+    return totals;
+}
+
+// Totals at the end of the last frame reported on, protected by s_OverheadReportMutex.
+static std::mutex s_OverheadReportMutex;
+static OverheadTotals s_LastFrameOverhead = {};
+static uint32_t s_LastOverheadFrame = 0xFFFFFFFF;
+
+// Called by xrEndFrame for the frame it ends, after its kFrameSummary.  Its own overhead goes to the next frame.
+// Doesn't stop the other threads, so calls they're in the middle of count towards whichever frame they end in.
+static void SendOverheadReport(uint32_t frame)
+{
+    uint64_t budget = s_OverheadBudget.load(std::memory_order_relaxed);
+    if (budget == 0)
+        return;
+
+    OverheadTotals totals = AddUpOverhead();
+    OverheadTotals last;
+    uint32_t lastFrame;
+    {
+        std::lock_guard<std::mutex> lock(s_OverheadReportMutex);
+        last = s_LastFrameOverhead;
+        lastFrame = s_LastOverheadFrame;
+        s_LastFrameOverhead = totals;
+        s_LastOverheadFrame = frame;
+    }
+
+    // Nothing to compare against for the first frame with a budget, or after ResetStats.
+    if (lastFrame + 1 != frame || totals.calls < last.calls || totals.overheadTime < last.overheadTime)
+        return;
+    uint64_t overhead = totals.overheadTime - last.overheadTime;
+    if (overhead <= budget)
+        return;
+
+    CallStream* stream = BeginStreamCall();
+    RecordWriter& record = stream->record;
+    record.Reset();
+    uint8_t* p = record.Reserve(1 + kMaxVarUInt32Size + 6 * kMaxVarUInt64Size);
+    if (p != nullptr)
+    {
+        p = PutCommand(p, kOverheadReport);
+        p = PutVarUInt(p, frame);
+        p = PutVarUInt(p, budget);
+        p = PutVarUInt(p, totals.calls - last.calls);
+        p = PutVarUInt(p, totals.runtimeTime - last.runtimeTime);
+        p = PutVarUInt(p, overhead);
+        p = PutVarUInt(p, totals.drainTime - last.drainTime);
+        record.Commit(PutVarUInt(p, totals.lockWaitTime - last.lockWaitTime));
+    }
+
+    if (record.overflowed || !PublishRecord(stream))
+        stream->queue.droppedRecords.fetch_add(1, std::memory_order_relaxed);
+    if (record.Spilled())
+        record.Reset();
+    if (stream->shared)
+        s_OverflowMutex.unlock();
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT SetMeasureOverhead(bool measure)
+{
+    s_MeasureOverhead = measure;
+}
+
+// Only reported while SetMeasureOverhead is on.  0 turns the reports off.
+extern "C" void UNITY_INTERFACE_EXPORT SetOverheadBudget(uint64_t nanosecondsPerFrame)
+{
+    s_OverheadBudget = nanosecondsPerFrame;
+}
+
+// One thread's overhead since the last ResetStats, times in nanoseconds.  The histograms are in the half-octave
+// buckets of GetStatsSnapshot: bucket 0 and 1 hold 0 and 1 ns, bucket b from 2 on starts at 2^(b/2) ns, plus half of
+// that if b is odd, and the last one holds everything over ~2s.
+struct ThreadOverheadSnapshot
+{
+    // threadIndex of the thread's kThreadInfo, 0xFFFFFFFF until it makes a measured call.  Contexts, and with them
+    // their statistics, are handed on to new threads when theirs exit.
+    uint32_t threadIndex;
+    uint32_t padding;
+    uint64_t calls;
+    uint64_t runtimeTime;
+    // Includes drainTime and lockWaitTime.
+    uint64_t overheadTime;
+    uint64_t maxOverhead;
+    uint64_t p50Overhead;
+    uint64_t p99Overhead;
+    uint64_t drains;
+    uint64_t drainTime;
+    uint64_t contendedDrains;
+    uint64_t lockWaits;
+    uint64_t lockWaitTime;
+    uint32_t overheadHistogram[kLatencyBuckets];
+    uint32_t lockWaitHistogram[kLatencyBuckets];
+};
+
+// Upper bound on what GetOverheadSnapshot can return, until another thread makes its first call.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT GetThreadCount()
+{
+    uint32_t count = 0;
+    for (ThreadContext* context = s_ThreadContexts.load(std::memory_order_acquire); context != nullptr; context = context->nextContext)
+        ++count;
+    return count;
+}
+
+// Fills snapshots with every thread that made a measured call, drained or waited since the last ResetStats, returns how
+// many were written.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT GetOverheadSnapshot(ThreadOverheadSnapshot* snapshots, uint32_t capacity)
+{
+    uint32_t generation = s_StatsGeneration.load();
+    uint32_t count = 0;
+    for (ThreadContext* context = s_ThreadContexts.load(std::memory_order_acquire); context != nullptr && count < capacity; context = context->nextContext)
+    {
+        OverheadStats* stats = context->overhead.load(std::memory_order_acquire);
+        if (stats->generation.load(std::memory_order_acquire) != generation)
+            continue;
+
+        ThreadOverheadSnapshot snapshot{};
+        snapshot.calls = stats->calls.load(std::memory_order_relaxed);
+        snapshot.drains = stats->drains.load(std::memory_order_relaxed);
+        snapshot.contendedDrains = stats->contendedDrains.load(std::memory_order_relaxed);
+        snapshot.lockWaits = stats->lockWaits.load(std::memory_order_relaxed);
+        if (snapshot.calls == 0 && snapshot.drains == 0 && snapshot.contendedDrains == 0 && snapshot.lockWaits == 0)
+            continue;
+
+        snapshot.threadIndex = stats->threadIndex.load(std::memory_order_relaxed);
+        snapshot.runtimeTime = stats->runtimeTime.load(std::memory_order_relaxed);
+        snapshot.overheadTime = stats->overheadTime.load(std::memory_order_relaxed);
+        snapshot.maxOverhead = stats->maxOverhead.load(std::memory_order_relaxed);
+        snapshot.drainTime = stats->drainTime.load(std::memory_order_relaxed);
+        snapshot.lockWaitTime = stats->lockWaitTime.load(std::memory_order_relaxed);
+
+        uint64_t histogram[kLatencyBuckets];
+        for (uint32_t bucket = 0; bucket < kLatencyBuckets; ++bucket)
+        {
+            snapshot.overheadHistogram[bucket] = stats->overheadHistogram[bucket].load(std::memory_order_relaxed);
+            snapshot.lockWaitHistogram[bucket] = stats->lockWaitHistogram[bucket].load(std::memory_order_relaxed);
+            histogram[bucket] = snapshot.overheadHistogram[bucket];
+        }
+        snapshot.p50Overhead = std::min(HistogramPercentile(histogram, snapshot.calls, 50), snapshot.maxOverhead);
+        snapshot.p99Overhead = std::min(HistogramPercentile(histogram, snapshot.calls, 99), snapshot.maxOverhead);
+        snapshots[count++] = snapshot;
+    }
+    return count;
+}
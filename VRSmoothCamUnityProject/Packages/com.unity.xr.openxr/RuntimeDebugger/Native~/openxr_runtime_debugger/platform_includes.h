@@ -0,0 +1,46 @@
+#pragma once
+
+// The D3D and GL headers below pull in windows.h before thread_info.h can, see there.
+#if defined(_WIN32) && !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+
+#ifdef XR_USE_PLATFORM_ANDROID
+#include <jni.h>
+#include <sys/system_properties.h>
+#endif
+
+#ifdef XR_USE_GRAPHICS_API_D3D11
+#include <d3d11_4.h>
+#endif
+
+#ifdef XR_USE_GRAPHICS_API_D3D12
+#include <d3d12.h>
+#endif
+
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+#if defined(XR_USE_PLATFORM_XLIB) || defined(XR_USE_PLATFORM_XCB)
+#include <GL/glx.h>
+#endif
+#ifdef XR_USE_PLATFORM_XCB
+#include <xcb/glx.h>
+#endif
+#ifdef XR_USE_PLATFORM_WIN32
+#include <GL/gl.h>
+#include <wingdi.h> // For HGLRC
+#endif
+#endif
+
+#ifdef XR_USE_GRAPHICS_API_OPENGL_ES
+#include <EGL/egl.h>
+#endif
+
+#ifdef XR_USE_GRAPHICS_API_VULKAN
+#ifdef XR_USE_PLATFORM_WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#if defined(XR_USE_PLATFORM_ANDROID) && !defined(XR_USE_UNITY)
+#define VK_USE_PLATFORM_ANDROID_KHR
+#endif
+#include <vulkan/vulkan.h>
+#endif
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+// Maps a function name to its hook for xrGetInstanceProcAddr.
+// The hash table is built at compile time from the reflection list, a lookup is one hash of the name
+// and (almost always) a single strcmp to confirm it.
+
+struct ProcAddrEntry
+{
+    const char* name;
+    PFN_xrVoidFunction hook;
+    PFN_xrVoidFunction* orig;
+};
+
+#define PROC_ADDR_NAME(f, ...) \
+    #f,
+
+#define PROC_ADDR_ENTRY(f, ...) \
+    {#f, (PFN_xrVoidFunction)&f, (PFN_xrVoidFunction*)&orig_##f},
+
+// clang-format off
+static constexpr const char* kProcAddrNames[] = {
+    XR_LIST_FUNCS(PROC_ADDR_NAME)
+    SPECIALIZED_FUNCS(PROC_ADDR_NAME)
+};
+
+static const ProcAddrEntry s_ProcAddrEntries[] = {
+    XR_LIST_FUNCS(PROC_ADDR_ENTRY)
+    SPECIALIZED_FUNCS(PROC_ADDR_ENTRY)
+};
+// clang-format on
+
+static constexpr uint32_t kProcAddrCount = sizeof(kProcAddrNames) / sizeof(kProcAddrNames[0]);
+
+static constexpr uint32_t ProcAddrTableSize()
+{
+    // At most half full keeps the probe sequences short.
+    uint32_t size = 1;
+    while (size < kProcAddrCount * 2)
+        size <<= 1;
+    return size;
+}
+
+static constexpr uint32_t kProcAddrTableSize = ProcAddrTableSize();
+
+// FNV-1a
+static constexpr uint32_t HashProcName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+    while (*name != 0)
+    {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+struct ProcAddrTable
+{
+    // Index into s_ProcAddrEntries plus one, zero for an empty slot.
+    uint16_t slots[kProcAddrTableSize];
+    uint32_t maxProbes;
+};
+
+static constexpr ProcAddrTable BuildProcAddrTable()
+{
+    ProcAddrTable table{};
+    for (uint32_t i = 0; i < kProcAddrCount; ++i)
+    {
+        uint32_t slot = HashProcName(kProcAddrNames[i]) & (kProcAddrTableSize - 1);
+        uint32_t probes = 1;
+        while (table.slots[slot] != 0)
+        {
+            slot = (slot + 1) & (kProcAddrTableSize - 1);
+            ++probes;
+        }
+        table.slots[slot] = (uint16_t)(i + 1);
+        if (probes > table.maxProbes)
+            table.maxProbes = probes;
+    }
+    return table;
+}
+
+static constexpr ProcAddrTable s_ProcAddrTable = BuildProcAddrTable();
+
+static_assert(kProcAddrCount < 0xFFFF, "Too many functions for 16 bit slots");
+static_assert(s_ProcAddrTable.maxProbes <= 8, "Function name hash clusters badly, grow the table or change the hash");
+
+static const ProcAddrEntry* FindProcAddr(const char* name)
+{
+    if (name == nullptr)
+        return nullptr;
+
+    uint32_t slot = HashProcName(name) & (kProcAddrTableSize - 1);
+    for (uint32_t probe = 0; probe < s_ProcAddrTable.maxProbes; ++probe)
+    {
+        uint16_t index = s_ProcAddrTable.slots[slot];
+        if (index == 0)
+            return nullptr;
+
+        const ProcAddrEntry* entry = &s_ProcAddrEntries[index - 1];
+        if (strcmp(entry->name, name) == 0)
+            return entry;
+
+        slot = (slot + 1) & (kProcAddrTableSize - 1);
+    }
+    return nullptr;
+}
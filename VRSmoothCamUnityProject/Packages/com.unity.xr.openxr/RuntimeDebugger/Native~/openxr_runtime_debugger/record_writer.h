@@ -0,0 +1,149 @@
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace_format.h"
+
+struct RecordWriter;
+
+// Defined in spill_arena.h.
+static bool GrowIntoSpill(RecordWriter& record, size_t size);
+static void FreeSpillBlock(uint8_t* block, uint32_t capacity);
+
+// Flat buffer one call record is serialized into before it's published to the thread's queue.
+// Each field reserves the most it can encode to in one bounds check, fills it with plain stores and commits
+// what it used.  A record that outgrows the buffer moves to a spill block, see spill_arena.h.  If that fails too
+// the record is marked overflowed and every later reservation fails, so a record is either complete or known
+// to be truncated.
+// Must call Create first, and Destroy when done.  Nothing is allocated in between unless a record spills.
+struct RecordWriter
+{
+    uint8_t* base;
+    uint8_t* pos;
+    uint8_t* end;
+    uint32_t capacity;
+    bool overflowed;
+
+    // The buffer from Create.  base and capacity describe the spill block instead while the record is spilled.
+    uint8_t* fixedBase;
+    uint32_t fixedCapacity;
+
+    void Create(uint32_t size)
+    {
+        if (fixedBase == nullptr)
+        {
+            fixedBase = (uint8_t*)malloc(size);
+            fixedCapacity = size;
+            base = fixedBase;
+            capacity = size;
+        }
+        Reset();
+    }
+
+    void Destroy()
+    {
+        Reset();
+        free(fixedBase);
+        fixedBase = nullptr;
+        fixedCapacity = 0;
+        base = nullptr;
+        pos = nullptr;
+        end = nullptr;
+        capacity = 0;
+    }
+
+    // Frees the spill block, if any.
+    void Reset()
+    {
+        if (Spilled())
+        {
+            FreeSpillBlock(base, capacity);
+            DetachSpill();
+        }
+        pos = base;
+        end = base + capacity;
+        overflowed = false;
+    }
+
+    bool Spilled() const
+    {
+        return base != fixedBase;
+    }
+
+    // Back to the fixed buffer without freeing the spill block, once someone else owns it.
+    void DetachSpill()
+    {
+        base = fixedBase;
+        capacity = fixedCapacity;
+        pos = base;
+        end = base + capacity;
+    }
+
+    uint32_t Size() const
+    {
+        return (uint32_t)(pos - base);
+    }
+
+    // Room for at most size bytes, or nullptr once the record has overflowed.
+    uint8_t* Reserve(size_t size)
+    {
+        if (overflowed || (size_t)(end - pos) < size)
+        {
+            if (overflowed || !GrowIntoSpill(*this, size))
+            {
+                overflowed = true;
+                return nullptr;
+            }
+        }
+        return pos;
+    }
+
+    // p is one past the last byte written since Reserve.
+    void Commit(uint8_t* p)
+    {
+        pos = p;
+    }
+};
+
+// Longest LEB128 encodings.
+static const uint32_t kMaxVarUInt32Size = 5;
+static const uint32_t kMaxVarUInt64Size = 10;
+
+// LEB128: 7 bits per byte, high bit set on every byte but the last.
+static inline uint8_t* PutVarUInt(uint8_t* p, uint64_t u)
+{
+    while (u >= 0x80)
+    {
+        *p++ = (uint8_t)(u | 0x80);
+        u >>= 7;
+    }
+    *p++ = (uint8_t)u;
+    return p;
+}
+
+static inline uint8_t* PutVarInt(uint8_t* p, int64_t i)
+{
+    return PutVarUInt(p, ZigZagEncode(i));
+}
+
+template <typename T>
+static inline uint8_t* PutFixed(uint8_t* p, T t)
+{
+    memcpy(p, &t, sizeof(T));
+    return p + sizeof(T);
+}
+
+static inline uint8_t* PutCommand(uint8_t* p, Command c)
+{
+    *p = (uint8_t)c;
+    return p + 1;
+}
+
+// length doesn't include the terminator, which is written too.
+static inline uint8_t* PutString(uint8_t* p, const char* s, size_t length)
+{
+    memcpy(p, s, length);
+    p[length] = 0;
+    return p + length + 1;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+// With input recording on, a captured call is sent with its arguments as the app passed them, then kCallOutputs,
+// then its arguments as the runtime left them, see trace_format.h.  That's what trace_replay needs to call the
+// runtime again the same way: output structs the runtime fills in (an event, a frame state) and counts it writes
+// back no longer show what went in.
+//
+// The hook copies the arguments into the calling thread's input arena before the call, the same deep copy
+// Capture_xrFoo makes for deferred formatting.  The arena belongs to the thread alone and is reused by every call, so
+// nothing is locked or queued while the runtime runs.  A call whose inputs don't fit is sent without them.
+// Output buffers are read as they are, except strings, which are recorded empty: the app hasn't written them.
+
+static std::atomic<bool> s_RecordInputs{false};
+
+static bool RecordingInputs()
+{
+    return s_RecordInputs.load(std::memory_order_relaxed);
+}
+
+// The calling thread's input arena with a span started, for CaptureInputs_xrFoo.  Never committed, so every call
+// gets all of it.  Hooks don't nest on a thread, the runtime doesn't call back into the debugger.
+static CaptureArena& BeginRecordInputs()
+{
+    ThreadContext* context = GetThreadContext();
+    CaptureArena& arena = context->inputs;
+    if (s_PerThreadCacheSize != 0 && arena.capacity != CaptureArena::CapacityFor(s_PerThreadCacheSize))
+    {
+        if (arena.data != nullptr)
+        {
+            TrackMemory(-(int64_t)arena.capacity);
+            free(arena.data);
+        }
+        arena.Create(s_PerThreadCacheSize);
+        TrackMemory(arena.capacity);
+    }
+    arena.Begin();
+    return arena;
+}
+
+// Between a call's inputs and its outputs.
+static void SendCallOutputs()
+{
+    uint8_t* p = s_Record->Reserve(1);
+    if (p == nullptr)
+        return;
+    s_Record->Commit(PutCommand(p, kCallOutputs));
+}
+
+// A deferred call with its inputs, both copies in the stream's arena.
+struct RecordedCall
+{
+    const void* inputs;
+    const void* outputs;
+};
+
+template <typename... Params, size_t... Indices>
+static const void* CaptureWithArgs(const void* (*capture)(CaptureArena&, Params...), CaptureArena& arena, const std::tuple<Params...>& args, ArgIndices<Indices...>)
+{
+    return capture(arena, std::get<Indices>(args)...);
+}
+
+// Copies the inputs a hook recorded, which only live until its next call, along with the outputs.
+// nullptr once the arena is full, like Capture_xrFoo.
+template <typename... Params>
+static const void* CaptureRecordedCall(const void* (*capture)(CaptureArena&, Params...), CaptureArena& arena, const void* inputs, Params... params)
+{
+    const auto& inputArgs = *static_cast<const std::tuple<Params...>*>(inputs);
+    const void* inputsCopy = CaptureWithArgs(capture, arena, inputArgs, typename MakeArgIndices<sizeof...(Params)>::type());
+    const void* outputsCopy = capture(arena, params...);
+    return arena.New<RecordedCall>(RecordedCall{inputsCopy, outputsCopy});
+}
+
+// DeferredCall::format of calls from CaptureRecordedCall, format is Format_xrFoo.
+template <void (*format)(const void*)>
+static void FormatRecordedCall(const void* args)
+{
+    const RecordedCall& call = *static_cast<const RecordedCall*>(args);
+    format(call.inputs);
+    SendCallOutputs();
+    format(call.outputs);
+}
+
+// Only calls starting after the switch are recorded with their inputs.
+extern "C" void UNITY_INTERFACE_EXPORT SetRecordInputs(bool record)
+{
+    s_RecordInputs.store(record, std::memory_order_relaxed);
+}
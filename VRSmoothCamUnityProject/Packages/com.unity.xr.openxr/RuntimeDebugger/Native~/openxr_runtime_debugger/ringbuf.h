@@ -0,0 +1,302 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Block-based dynamic allocator via ring-buffer.
+// Ring buffer that stores "blocks" which dynamically grow and wrap.
+// If a block grows large enough that it overlaps older blocks, the older blocks are forgotten, oldest first,
+// and counted in droppedBlocks / droppedBytes.
+// A block is always contiguous.  Mirrored buffers map the same memory twice back to back, so blocks and reads simply
+// run past the end.  Otherwise a block that no longer fits at the end of the buffer is moved to the start, and reads
+// may come in two spans.
+// Bring your own synchronization.
+// Must call Create first, and Destroy when done.  Must create a block before writing.
+// Nothing is allocated after Create, block boundaries are kept in a fixed size ring of their own.
+// Tests and a benchmark are in ringbuf_tests.cpp.
+struct RingBuf
+{
+    struct Block
+    {
+        uint32_t start;
+        uint32_t end;
+    };
+
+    uint8_t* data;
+    uint32_t cacheSize;
+    // data is followed by a second mapping of itself.
+    bool mirrored;
+
+    // Power of two, the oldest block is forgotten when a new one doesn't fit.
+    Block* blocks;
+    uint32_t blockCapacity;
+    uint32_t firstBlock;
+    uint32_t blockCount;
+
+    uint32_t writeOffset;
+    uint32_t usedBytes;
+    // Set when the current block didn't fit in the whole buffer, writes fail until the next block.
+    bool blockAbandoned;
+
+    // Blocks forgotten to make room, not cleared by Reset.
+    uint64_t droppedBlocks;
+    uint64_t droppedBytes;
+
+    // Sized for blocks averaging kMinAverageBlockSize bytes or more, smaller ones run out of index first.
+    static const uint32_t kMinAverageBlockSize = 32;
+    static const uint32_t kMinBlockCapacity = 16;
+
+    // mirror is only a request, it falls back to a plain allocation where mirroring isn't supported or csize isn't
+    // a multiple of the page size.
+    void Create(uint32_t csize, bool mirror = false)
+    {
+        if (data == nullptr)
+        {
+            blockCapacity = kMinBlockCapacity;
+            while (blockCapacity < csize / kMinAverageBlockSize)
+                blockCapacity *= 2;
+
+            data = mirror ? CreateMirroredMapping(csize) : nullptr;
+            mirrored = data != nullptr;
+            if (!mirrored)
+                data = (uint8_t*)malloc(csize);
+            blocks = (Block*)malloc(blockCapacity * sizeof(Block));
+            cacheSize = csize;
+        }
+        Reset();
+    }
+
+    void Reset()
+    {
+        firstBlock = 0;
+        blockCount = 0;
+        writeOffset = 0;
+        usedBytes = 0;
+        blockAbandoned = false;
+    }
+
+    void Destroy()
+    {
+        if (data != nullptr)
+        {
+#if defined(__linux__)
+            if (mirrored)
+                munmap(data, (size_t)cacheSize * 2);
+            else
+#endif
+                free(data);
+            data = nullptr;
+            mirrored = false;
+            free(blocks);
+            blocks = nullptr;
+            cacheSize = 0;
+            blockCapacity = 0;
+        }
+    }
+
+    // Zero before Create.
+    uint64_t AllocatedBytes() const
+    {
+        return data != nullptr ? (uint64_t)cacheSize + blockCapacity * sizeof(Block) : 0;
+    }
+
+    void CreateNewBlock()
+    {
+        if (blockCount == blockCapacity)
+            DropOldestBlock();
+
+        if (writeOffset >= cacheSize)
+            writeOffset -= cacheSize;
+
+        Block& block = blocks[(firstBlock + blockCount) & (blockCapacity - 1)];
+        block.start = writeOffset;
+        block.end = writeOffset;
+        ++blockCount;
+        blockAbandoned = false;
+    }
+
+    uint8_t* GetForWrite(uint32_t size)
+    {
+        if (blockCount == 0 || blockAbandoned)
+            return nullptr;
+
+        Block& current = blocks[(firstBlock + blockCount - 1) & (blockCapacity - 1)];
+        uint32_t length = current.end - current.start;
+
+        // Block grew larger than the full buffer and would overwrite itself, abort.
+        if ((uint64_t)length + size > cacheSize)
+        {
+            usedBytes -= length;
+            CountDropped(length);
+            --blockCount;
+            writeOffset = current.start;
+            blockAbandoned = true;
+            return nullptr;
+        }
+
+        if (mirrored)
+        {
+            // No gaps, the oldest block is always the next one to be overwritten.
+            while (blockCount > 1 && (uint64_t)usedBytes + size > cacheSize)
+                DropOldestBlock();
+        }
+        else
+        {
+            // Past the end of the buffer the whole block moves to the start.
+            bool wrap = (uint64_t)current.end + size > cacheSize;
+            uint32_t targetEnd = wrap ? length + size : current.end + size;
+
+            // Older blocks sit ahead of the write offset, oldest first.  Forget the ones that are in the way,
+            // and when wrapping, also everything between the write offset and the end of the buffer.
+            while (blockCount > 1)
+            {
+                const Block& oldest = blocks[firstBlock];
+                bool ahead = oldest.start >= current.end;
+                bool overlaps = oldest.start < targetEnd;
+                if (wrap ? !(ahead || overlaps) : !(ahead && overlaps))
+                    break;
+                DropOldestBlock();
+            }
+
+            if (wrap)
+            {
+                memmove(data, data + current.start, length);
+                current.start = 0;
+                current.end = length;
+            }
+        }
+
+        uint8_t* ret = &data[current.end];
+        current.end += size;
+        writeOffset = current.end;
+        usedBytes += size;
+        return ret;
+    }
+
+    bool HasDataForRead()
+    {
+        return usedBytes != 0;
+    }
+
+    // returns true if there is more data to read
+    // unless mirrored, there may be two reads necessary to get all the data, from mid to end and from beginning to mid.
+    // reading is a one time operation - data is cleared after read.
+    bool GetForRead(uint8_t** ptr, uint32_t* size)
+    {
+        if (blockCount == 0)
+        {
+            *ptr = data;
+            *size = 0;
+            return false;
+        }
+
+        if (mirrored)
+        {
+            *ptr = &data[blocks[firstBlock].start];
+            *size = usedBytes;
+            firstBlock = (firstBlock + blockCount) & (blockCapacity - 1);
+            blockCount = 0;
+            usedBytes = 0;
+            return false;
+        }
+
+        uint32_t start = blocks[firstBlock].start;
+        uint32_t end = start;
+        while (blockCount > 0 && blocks[firstBlock].start == end)
+        {
+            end = blocks[firstBlock].end;
+            firstBlock = (firstBlock + 1) & (blockCapacity - 1);
+            --blockCount;
+        }
+
+        *ptr = &data[start];
+        *size = end - start;
+        usedBytes -= *size;
+
+        return blockCount > 0;
+    }
+
+    // Copies the newest blocks that fit in capacity to dst, oldest first, and returns the bytes copied.
+    // Unlike GetForRead the blocks stay where they are.
+    uint32_t CopyNewest(uint8_t* dst, uint32_t capacity) const
+    {
+        uint32_t skipped = 0;
+        uint32_t remaining = usedBytes;
+        while (skipped < blockCount && remaining > capacity)
+        {
+            const Block& block = blocks[(firstBlock + skipped) & (blockCapacity - 1)];
+            remaining -= block.end - block.start;
+            ++skipped;
+        }
+
+        uint32_t copied = 0;
+        for (uint32_t i = skipped; i < blockCount; ++i)
+        {
+            const Block& block = blocks[(firstBlock + i) & (blockCapacity - 1)];
+            memcpy(dst + copied, &data[block.start], block.end - block.start);
+            copied += block.end - block.start;
+        }
+        return copied;
+    }
+
+    void DropOldestBlock()
+    {
+        const Block& oldest = blocks[firstBlock];
+        usedBytes -= oldest.end - oldest.start;
+        CountDropped(oldest.end - oldest.start);
+        firstBlock = (firstBlock + 1) & (blockCapacity - 1);
+        --blockCount;
+    }
+
+    void CountDropped(uint32_t bytes)
+    {
+        if (bytes == 0)
+            return;
+        ++droppedBlocks;
+        droppedBytes += bytes;
+    }
+
+    // An anonymous file mapped twice, back to back, into one reservation.
+    static uint8_t* CreateMirroredMapping(uint32_t size)
+    {
+#if defined(__linux__) && defined(SYS_memfd_create)
+        long pageSize = sysconf(_SC_PAGESIZE);
+        if (size == 0 || pageSize <= 0 || size % pageSize != 0)
+            return nullptr;
+
+        // Through syscall, the libc wrapper is missing on older Android API levels.
+        int fd = (int)syscall(SYS_memfd_create, "openxr_runtime_debugger", 1u /* MFD_CLOEXEC */);
+        if (fd < 0)
+            return nullptr;
+
+        uint8_t* base = nullptr;
+        if (ftruncate(fd, size) == 0)
+        {
+            void* reservation = mmap(nullptr, (size_t)size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (reservation != MAP_FAILED)
+            {
+                base = (uint8_t*)reservation;
+                if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+                    mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+                {
+                    munmap(reservation, (size_t)size * 2);
+                    base = nullptr;
+                }
+            }
+        }
+
+        // The mappings keep the memory alive.
+        close(fd);
+        return base;
+#else
+        return nullptr;
+#endif
+    }
+};
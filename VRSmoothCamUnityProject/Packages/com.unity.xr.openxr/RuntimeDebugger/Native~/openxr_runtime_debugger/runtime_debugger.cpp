@@ -0,0 +1,135 @@
+#include "platform_includes.h"
+
+#define XR_NO_PROTOTYPES
+#include <openxr/openxr.h>
+#include <openxr/openxr_platform.h>
+
+#include "openxr/openxr_reflection_full.h"
+
+#include <cstring>
+#include <type_traits>
+
+#include "api_exports.h"
+
+#include "serialize_names.h"
+#include "serialize_data.h"
+#include "spill_arena.h"
+#include "deferred_calls.h"
+#include "call_stats.h"
+#include "file_sink.h"
+#include "serialize_data_access.h"
+#include "capture_policy.h"
+#include "overhead_stats.h"
+#include "frame_stats.h"
+#include "flight_recorder.h"
+#include "recorded_inputs.h"
+
+#define CATCH_MISSING_TEMPLATES 0
+
+template <typename T>
+void SendToCSharp(const char* fieldname, T t)
+#if !CATCH_MISSING_TEMPLATES
+{
+    SendString(fieldname, "<Unknown>");
+}
+#else
+    ;
+#endif
+
+// Arrays of base structs
+template <typename structType>
+bool SendToCSharpBaseStructArray(const char* fieldname, structType t, int lenParam)
+{
+    return false;
+}
+
+// These includes are order-sensitive
+// clang-format off
+#include "serialize_primitives.h"
+#include "serialize_enums.h"
+#include "serialize_handles.h"
+#include "serialize_atoms.h"
+#include "serialize_nextptr.h"
+#include "serialize_structs.h"
+#include "serialize_todo.h"
+#include "serialize_nextptr_impl.h"
+#include "serialize_capture.h"
+
+#include "serialize_funcs.h"
+#include "serialize_funcs_specialization.h"
+#include "proc_addr_table.h"
+// clang-format on
+
+// Serialized after the runtime call like every other function, see StartFunctionCall.
+// function is "<not hooked>" for functions the debugger passes straight through.
+static void SendGetInstanceProcAddr(XrInstance instance, const char* name, bool hooked, XrResult result, uint64_t startTime, uint64_t duration, uint32_t frame)
+{
+    const auto& fieldNames = s_Names.xrGetInstanceProcAddr;
+    StartFunctionCall(fieldNames.name_);
+    SendToCSharp(fieldNames.instance, instance);
+    SendToCSharp(fieldNames.name, name);
+    SendToCSharp(fieldNames.function, hooked ? "<func>" : "<not hooked>");
+    EndFunctionCall(fieldNames.name_, result, startTime, duration, frame);
+}
+
+// Asks the runtime for name and hands out the hook in its place if there is one.  duration only covers the runtime.
+static XrResult GetProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function, bool& hooked, uint64_t& startTime, uint64_t& duration)
+{
+    const ProcAddrEntry* entry = FindProcAddr(name);
+    hooked = entry != nullptr;
+    startTime = GetTimestamp();
+    XrResult result = orig_xrGetInstanceProcAddr(instance, name, hooked ? entry->orig : function);
+    duration = GetTimestamp() - startTime;
+    if (hooked && result == XR_SUCCESS)
+        *function = entry->hook;
+    return result;
+}
+
+extern "C" XrResult UNITY_INTERFACE_EXPORT XRAPI_PTR xrGetInstanceProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function)
+{
+    bool hooked = false;
+    uint64_t startTime = 0;
+    uint64_t duration = 0;
+    CallAction action = BeginCall(kFunc_xrGetInstanceProcAddr);
+    if (action == kForwardCall)
+        return GetProcAddr(instance, name, function, hooked, startTime, duration);
+
+    OverheadScope overhead;
+
+    uint32_t frame = CurrentFrame(kFunc_xrGetInstanceProcAddr);
+    XrResult result = GetProcAddr(instance, name, function, hooked, startTime, duration);
+    overhead.runtime = duration;
+    if (action != kSerializeCall)
+        RecordCallStats(kFunc_xrGetInstanceProcAddr, result, duration);
+    if (action == kTimeCall)
+        return result;
+
+    if (action == kSerializeCall)
+        RecordFrameTime(kFunc_xrGetInstanceProcAddr, frame, duration);
+    SendGetInstanceProcAddr(instance, name, hooked, result, startTime, duration, frame);
+    CheckFreezeTriggers(kFunc_xrGetInstanceProcAddr, result, frame, startTime, duration);
+    return result;
+}
+
+// Bump whenever an export's parameters or a struct shared with RuntimeDebuggerOpenXRFeature.cs change, and kAbiVersion
+// there with it.  The C# side checks it before hooking, so a stale prebuilt plugin is left unhooked instead of called
+// with the wrong arguments.
+static const uint32_t kAbiVersion = 1;
+
+extern "C" uint32_t UNITY_INTERFACE_EXPORT GetAbiVersion()
+{
+    return kAbiVersion;
+}
+
+extern "C" PFN_xrGetInstanceProcAddr UNITY_INTERFACE_EXPORT XRAPI_PTR HookXrInstanceProcAddr(PFN_xrGetInstanceProcAddr func, uint32_t cacheSize, uint32_t perThreadCacheSize, uint32_t threadMemoryBudget, uint32_t spillBudget)
+{
+    s_CacheSize = cacheSize;
+    s_PerThreadCacheSize = perThreadCacheSize;
+    s_ThreadMemoryBudget = threadMemoryBudget;
+    s_SpillBudget = spillBudget;
+    s_SessionEpoch = std::chrono::steady_clock::now();
+    ResendMetadata();
+    StartFileSinkFromEnvironment();
+    orig_xrGetInstanceProcAddr = func;
+    return xrGetInstanceProcAddr;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+template <>
+void SendToCSharp<XrSystemId*>(const char* fieldname, XrSystemId* t)
+{
+    SendToCSharp(fieldname, *t);
+}
\ No newline at end of file
@@ -0,0 +1,313 @@
+#pragma once
+
+// Deep copies of a call's arguments into a CaptureArena, for deferred_calls.h.
+// CopyDeep(t, arena) follows every pointer the matching SendToCSharp reads through, copies what it points to into the
+// arena and points t at the copy, so the call can be formatted after the caller has reused its memory.
+// Arrays are copied by CopyArray, as far as the Send path loops.  Pointers it doesn't follow (handles, function
+// pointers, void* other than next) keep their value.  Once the arena is full every copy stops and arena.overflowed
+// is set, the call is then serialized on the calling thread instead.
+
+template <typename T, typename = void>
+struct IsCompleteType : std::false_type
+{
+};
+
+template <typename T>
+struct IsCompleteType<T, decltype(void(sizeof(T)))> : std::true_type
+{
+};
+
+template <typename T>
+struct IsCopyablePointee : std::integral_constant<bool, !std::is_void<T>::value && !std::is_function<T>::value && IsCompleteType<T>::value>
+{
+};
+
+#define COPY_DEEP_BASE_STRUCT_PTR_DECL(structType)                                     \
+    static inline void CopyDeep(structType const*& t, CaptureArena& arena);            \
+    static inline void CopyDeep(structType*& t, CaptureArena& arena);                  \
+    static inline void CopyArray(structType*& t, uint32_t count, CaptureArena& arena); \
+    static inline void CopyArray(structType const* const*& t, uint32_t count, CaptureArena& arena);
+
+XR_LIST_BASE_STRUCTS(COPY_DEEP_BASE_STRUCT_PTR_DECL)
+
+static void CopyDeep(const char*& t, CaptureArena& arena);
+static void CopyDeep(char*& t, CaptureArena& arena);
+static void CopyDeep(XrEventDataBuffer*& t, CaptureArena& arena);
+static void CopyNext(const void*& t, CaptureArena& arena);
+static void CopyStruct(void* t, StructId structId, CaptureArena& arena);
+
+// Values, and pointers to things the Send path only prints the address of.
+template <typename T>
+static void CopyDeep(T&, CaptureArena&, std::false_type)
+{
+}
+
+// Structs from the reflection lists, walked with their FieldDescriptors.
+template <typename T>
+static void CopyDeep(T& t, CaptureArena& arena, std::true_type)
+{
+    CopyStruct(&t, (StructId)FieldEncoding<T>::type, arena);
+}
+
+template <typename T>
+static void CopyDeep(T& t, CaptureArena& arena)
+{
+    CopyDeep(t, arena, IsListedStruct<T>());
+}
+
+template <typename T>
+static void CopyPointee(T*&, CaptureArena&, std::false_type)
+{
+}
+
+template <typename T>
+static void CopyPointee(T*& t, CaptureArena& arena, std::true_type)
+{
+    if (t == nullptr)
+        return;
+
+    typename std::remove_const<T>::type* copy = arena.Copy(t, 1);
+    if (copy == nullptr)
+        return;
+    CopyDeep(*copy, arena);
+    t = copy;
+}
+
+template <typename T>
+static void CopyDeep(T*& t, CaptureArena& arena)
+{
+    CopyPointee(t, arena, IsCopyablePointee<T>());
+}
+
+template <typename T>
+static void CopyArray(T*& t, uint32_t count, CaptureArena& arena)
+{
+    if (t == nullptr || count == 0)
+        return;
+
+    typename std::remove_const<T>::type* copy = arena.Copy(t, count);
+    if (copy == nullptr)
+        return;
+    for (uint32_t i = 0; i < count; ++i)
+        CopyDeep(copy[i], arena);
+    t = copy;
+}
+
+// Struct members, the Send path only follows void pointers named next.
+template <typename T>
+static void CopyMember(T& t, CaptureArena& arena, bool)
+{
+    CopyDeep(t, arena);
+}
+
+static void CopyMember(const void*& t, CaptureArena& arena, bool next)
+{
+    if (next)
+        CopyNext(t, arena);
+}
+
+static void CopyMember(void*& t, CaptureArena& arena, bool next)
+{
+    if (next)
+    {
+        const void* copy = t;
+        CopyNext(copy, arena);
+        t = const_cast<void*>(copy);
+    }
+}
+
+static void CopyDeep(const char*& t, CaptureArena& arena)
+{
+    if (t != nullptr)
+    {
+        const char* copy = arena.Copy(t, strlen(t) + 1);
+        if (copy != nullptr)
+            t = copy;
+    }
+}
+
+static void CopyDeep(char*& t, CaptureArena& arena)
+{
+    if (t != nullptr)
+    {
+        char* copy = arena.Copy(t, strlen(t) + 1);
+        if (copy != nullptr)
+            t = copy;
+    }
+}
+
+// FieldDescriptor::copy of members, see serialize_structs.h.
+template <typename T, bool next>
+static void CopyField(void* member, uint32_t, CaptureArena& arena)
+{
+    CopyMember(*(T*)member, arena, next);
+}
+
+template <typename T>
+static void CopyArrayField(void* member, uint32_t count, CaptureArena& arena)
+{
+    CopyArray(*(T*)member, count, arena);
+}
+
+static void CopyStruct(void* t, StructId structId, CaptureArena& arena)
+{
+    const StructDescriptor& descriptor = s_Structs[structId];
+    for (uint32_t i = 0; i < descriptor.fieldCount; ++i)
+    {
+        const FieldDescriptor& field = descriptor.fields[i];
+        uint8_t* member = (uint8_t*)t + field.offset;
+        if (field.kind == kFieldStruct)
+            CopyStruct(member, (StructId)field.type, arena);
+        else if (field.copy != nullptr)
+            field.copy(member, field.countSize != 0 ? ArrayCount((const uint8_t*)t, field) : 0, arena);
+    }
+}
+
+// Points t at a deep copy of the structId struct it points to.
+static void CopyStructPointer(const void*& t, StructId structId, CaptureArena& arena)
+{
+    const StructDescriptor& descriptor = s_Structs[structId];
+    void* copy = arena.Alloc(descriptor.size, descriptor.alignment);
+    if (copy == nullptr)
+        return;
+    memcpy(copy, t, descriptor.size);
+    CopyStruct(copy, structId, arena);
+    t = copy;
+}
+
+// Points t at a deep copy of count structId structs.
+static void CopyStructArray(const void*& t, StructId structId, uint32_t count, CaptureArena& arena)
+{
+    const StructDescriptor& descriptor = s_Structs[structId];
+    uint8_t* copy = (uint8_t*)arena.Alloc(descriptor.size * count, descriptor.alignment);
+    if (copy == nullptr)
+        return;
+    memcpy(copy, t, descriptor.size * count);
+    for (uint32_t i = 0; i < count; ++i)
+        CopyStruct(copy + i * descriptor.size, structId, arena);
+    t = copy;
+}
+
+// Points t at a copy of count pointers, each to a deep copy of its structId struct.
+static void CopyStructPointerArray(const void* const*& t, StructId structId, uint32_t count, CaptureArena& arena)
+{
+    const void** copy = arena.Copy((const void**)t, count);
+    if (copy == nullptr)
+        return;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (copy[i] != nullptr)
+            CopyStructPointer(copy[i], structId, arena);
+    }
+    t = copy;
+}
+
+// Same dispatch as SendToCSharp<XrBaseInStructure const*>: known types in full, unknown ones by their header.
+static void CopyNext(const void*& t, CaptureArena& arena)
+{
+    const XrBaseInStructure* next = static_cast<const XrBaseInStructure*>(t);
+    if (next == nullptr)
+        return;
+
+    StructId structId = StructIdForType(next->type);
+    if (structId != kStructCount)
+    {
+        CopyStructPointer(t, structId, arena);
+        return;
+    }
+
+    XrBaseInStructure* copy = arena.Copy(next, 1);
+    if (copy == nullptr)
+        return;
+    const void* rest = copy->next;
+    CopyNext(rest, arena);
+    copy->next = static_cast<const XrBaseInStructure*>(rest);
+    t = copy;
+}
+
+// Same dispatch as serialize_structs_base.h: the type of the first element decides how the whole array is read,
+// an unknown one is only read for its type.  Not every overload is used by every base struct, but each is used by one:
+// XrEventDataBuffer goes through the non-const pointer, xrEnumerateSwapchainImages the array, XrFrameEndInfo::layers
+// the array of pointers.  They are inline so the ones a base struct doesn't use aren't reported as unused.
+#define COPY_DEEP_BASE_STRUCT(structType)                                                          \
+    static inline void CopyDeep(structType const*& t, CaptureArena& arena)                         \
+    {                                                                                              \
+        if (t == nullptr)                                                                          \
+            return;                                                                                \
+        StructId structId = DerivedStructId(*t);                                                   \
+        if (structId != kStructCount)                                                              \
+        {                                                                                          \
+            const void* copy = t;                                                                  \
+            CopyStructPointer(copy, structId, arena);                                              \
+            t = (structType const*)copy;                                                           \
+            return;                                                                                \
+        }                                                                                          \
+        const structType* copy = arena.Copy(t, 1);                                                 \
+        if (copy != nullptr)                                                                       \
+            t = copy;                                                                              \
+    }                                                                                              \
+                                                                                                   \
+    static inline void CopyDeep(structType*& t, CaptureArena& arena)                               \
+    {                                                                                              \
+        const structType* copy = t;                                                                \
+        CopyDeep(copy, arena);                                                                     \
+        t = const_cast<structType*>(copy);                                                         \
+    }                                                                                              \
+                                                                                                   \
+    static inline void CopyArray(structType*& t, uint32_t count, CaptureArena& arena)              \
+    {                                                                                              \
+        if (t == nullptr || count == 0)                                                            \
+            return;                                                                                \
+        StructId structId = DerivedStructId(t[0]);                                                 \
+        if (structId == kStructCount)                                                              \
+        {                                                                                          \
+            CopyArray<structType>(t, 1, arena);                                                    \
+            return;                                                                                \
+        }                                                                                          \
+        const void* copy = t;                                                                      \
+        CopyStructArray(copy, structId, count, arena);                                             \
+        t = (structType*)copy;                                                                     \
+    }                                                                                              \
+                                                                                                   \
+    static inline void CopyArray(structType const* const*& t, uint32_t count, CaptureArena& arena) \
+    {                                                                                              \
+        if (t == nullptr || count == 0 || t[0] == nullptr)                                         \
+            return;                                                                                \
+        StructId structId = DerivedStructId(*t[0]);                                                \
+        if (structId == kStructCount)                                                              \
+        {                                                                                          \
+            CopyArray<structType const* const>(t, 1, arena);                                       \
+            return;                                                                                \
+        }                                                                                          \
+        const void* const* copy = (const void* const*)t;                                           \
+        CopyStructPointerArray(copy, structId, count, arena);                                      \
+        t = (structType const* const*)copy;                                                        \
+    }
+
+XR_LIST_BASE_STRUCTS(COPY_DEEP_BASE_STRUCT)
+
+// Sent as the event it holds, see serialize_todo.h.
+static void CopyDeep(XrEventDataBuffer*& t, CaptureArena& arena)
+{
+    XrEventDataBaseHeader* evt = reinterpret_cast<XrEventDataBaseHeader*>(t);
+    CopyDeep(evt, arena);
+    t = reinterpret_cast<XrEventDataBuffer*>(evt);
+}
+
+// Inputs recorded before the call, see recorded_inputs.h.  The app hasn't written its output strings yet, so they
+// aren't read.
+template <typename T>
+static void CopyInput(T& t, CaptureArena& arena)
+{
+    CopyDeep(t, arena);
+}
+
+static void CopyInput(char*& t, CaptureArena& arena)
+{
+    if (t != nullptr)
+    {
+        char* copy = arena.New<char>('\0');
+        if (copy != nullptr)
+            t = copy;
+    }
+}
@@ -0,0 +1,860 @@
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <stdlib.h>
+
+#include "trace_format.h"
+#include "capture_arena.h"
+#include "record_writer.h"
+#include "ringbuf.h"
+#include "thread_info.h"
+#include "thread_queue.h"
+
+// Held by whoever drains the per-thread queues into s_WriteStore, and by StartDataAccess for the swap.
+// Calling threads only ever try_lock this, so they never wait on the reader or on each other.
+static std::mutex s_DataMutex;
+
+// Held by the reader from StartDataAccess to EndDataAccess.  Only ever taken by the reader, never by calling threads.
+static std::mutex s_ReadMutex;
+
+// Two stores: drained calls go to s_WriteStore while the reader has s_ReadStore to itself.
+// StartDataAccess swaps them, so the reader can copy out at its own pace without holding s_DataMutex.
+// s_WriteStore is protected with s_DataMutex, s_ReadStore with s_ReadMutex.
+// Only filled from the per-thread queues in DrainThreadQueues.
+static RingBuf s_DataStores[2] = {};
+static RingBuf* s_WriteStore = &s_DataStores[0];
+static RingBuf* s_ReadStore = &s_DataStores[1];
+
+// These get set from c# in HookXrInstanceProcAddr
+static uint32_t s_CacheSize = 0;
+static uint32_t s_PerThreadCacheSize = 0;
+
+// Most the per-thread streams may hold between them, see AcquireStream.
+static const uint32_t kDefaultThreadMemoryBudget = 4 * 1024 * 1024;
+static uint32_t s_ThreadMemoryBudget = kDefaultThreadMemoryBudget;
+
+// Call start times are sent relative to this, set in HookXrInstanceProcAddr before any call goes through the hooks.
+static std::chrono::steady_clock::time_point s_SessionEpoch;
+
+// Monotonic nanoseconds since s_SessionEpoch.
+static uint64_t GetTimestamp()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_SessionEpoch).count();
+}
+
+// Everything the debugger has allocated, and the most it ever had at once.  See GetMemoryStats.
+static std::atomic<uint64_t> s_MemoryBytes{0};
+static std::atomic<uint64_t> s_MemoryHighWater{0};
+
+static void TrackMemory(int64_t bytes)
+{
+    uint64_t total = s_MemoryBytes.fetch_add((uint64_t)bytes, std::memory_order_relaxed) + (uint64_t)bytes;
+    uint64_t highWater = s_MemoryHighWater.load(std::memory_order_relaxed);
+    while (total > highWater && !s_MemoryHighWater.compare_exchange_weak(highWater, total, std::memory_order_relaxed))
+    {
+    }
+}
+
+struct ThreadStats;
+struct FrameTimes;
+struct OverheadStats;
+
+// Delta encoding state of one stream, see trace_format.h.  Only touched by whoever writes the stream's records.
+struct DeltaState
+{
+    uint64_t values[kDeltaSlots];
+    uint64_t startTime;
+    uint32_t frame;
+    uint16_t sequence;
+    uint32_t callsSinceKeyframe;
+    uint32_t keyframeGeneration;
+
+    // Set when a call's values were written but never reached a reader.
+    bool forceKeyframe;
+};
+
+// Bumped whenever readers start from scratch (new capture session, new trace file), every thread then sends a keyframe.
+static std::atomic<uint32_t> s_KeyframeGeneration{1};
+
+// The buffers captured calls are serialized and queued in, and the thread identity they're sent under.
+// Created on a thread's first captured call, so threads that only ever forward or time calls never get one.
+// Handed back to the pool when the thread exits and given a new identity by the next thread that takes it.
+// Linked into s_CallStreams so the reader can find every queue, pooled streams are only freed by ReleasePooledStreams.
+struct CallStream
+{
+    ThreadQueue queue;
+    CallStream* nextStream;
+    CallStream* nextFree;
+
+    // The call being serialized, see record_writer.h.  Published to queue by EndFunctionCall.
+    RecordWriter record;
+
+    DeltaState delta;
+
+    // Arguments of calls waiting for the formatter, and the delta state it formats them with, see deferred_calls.h.
+    // capture is created on the stream's first deferred call.  formatDelta is protected by s_DataMutex.
+    CaptureArena capture;
+    DeltaState formatDelta;
+    // The last call went to the formatter, so the next one formatted here has to be a keyframe.
+    bool lastCallDeferred;
+
+    // Written with every call instead of the OS thread id.
+    uint32_t threadIndex;
+
+    // Sent once as a kThreadInfo record.  Set under s_StreamPoolMutex, which the reader holds to send them.
+    uint64_t osThreadId;
+    char threadName[kMaxThreadNameLength];
+
+    // Last s_MetadataGeneration this stream's kThreadInfo was sent in.  Protected by s_StreamPoolMutex.
+    uint32_t metadataGeneration;
+
+    // Last trace file this stream's kThreadInfo was written to, see file_sink.h.  Protected by s_DataMutex.
+    uint64_t fileSequence;
+
+    // s_OverflowStream, written to by every thread over s_ThreadMemoryBudget while holding s_OverflowMutex.
+    bool shared;
+};
+
+// Per-thread state, created the first time a thread makes a call and handed back to the pool when it exits.
+// Never freed, contexts are linked into s_ThreadContexts so counters and statistics outlive their threads.  Statistics
+// walk that list without a lock, so ReleasePooledStreams only frees the buffers of pooled ones.
+struct ThreadContext
+{
+    ThreadContext* nextContext;
+    ThreadContext* nextFree;
+
+    // nullptr until the thread's first captured call.
+    CallStream* stream;
+
+    // Per-function call counters, only written by the owning thread.
+    std::atomic<uint64_t> callCounts[kFuncCount];
+    std::atomic<uint64_t> capturedCounts[kFuncCount];
+
+    // Statistics mode aggregates, see call_stats.h.  Allocated by the owning thread on its first timed call.
+    std::atomic<ThreadStats*> stats;
+
+    // This thread's share of the current frame, see frame_stats.h.  Allocated by the owning thread on its first captured call.
+    std::atomic<FrameTimes*> frameTimes;
+
+    // What the debugger cost this thread, see overhead_stats.h.  Allocated with the context, drains can't allocate.
+    std::atomic<OverheadStats*> overhead;
+
+    // The call being serialized is only measured for its size, EndFunctionCall drops it instead of publishing.
+    bool measuring;
+    FuncId measureFunc;
+
+    // Inputs of the call in flight, see recorded_inputs.h.  Created on the thread's first recorded call.
+    CaptureArena inputs;
+};
+
+static std::atomic<ThreadContext*> s_ThreadContexts{nullptr};
+static std::atomic<CallStream*> s_CallStreams{nullptr};
+static std::atomic<uint32_t> s_NextThreadIndex{0};
+
+// Identity of a stream that was reused before its kThreadInfo went out, the reader sends it with the next metadata.
+// Only the most recent kMaxRetiredThreads are kept, calls from older ones decode without a thread name.
+struct RetiredThread
+{
+    uint32_t threadIndex;
+    uint64_t osThreadId;
+    char threadName[kMaxThreadNameLength];
+};
+static const uint32_t kMaxRetiredThreads = 64;
+
+// Protects the free lists, stream identities and the retired threads.
+// Only taken when a thread starts or exits and by the reader, never by a call in flight.
+// Lock order: s_ReadMutex or s_DataMutex first, then s_StreamPoolMutex.
+static std::mutex s_StreamPoolMutex;
+static ThreadContext* s_FreeContexts = nullptr;
+static CallStream* s_FreeStreams = nullptr;
+static std::atomic<uint32_t> s_FreeStreamCount{0};
+static RetiredThread s_RetiredThreads[kMaxRetiredThreads];
+static uint32_t s_RetiredThreadCount = 0;
+
+// Bytes held by every stream but the overflow one, checked against s_ThreadMemoryBudget.
+static std::atomic<uint64_t> s_StreamBytes{0};
+static std::atomic<uint32_t> s_StreamCount{0};
+
+// Shared by the threads that would take the stream pool over budget.  Created the first time it's needed.
+static CallStream* s_OverflowStream = nullptr;
+static std::mutex s_OverflowMutex;
+static std::atomic<uint32_t> s_OverflowThreads{0};
+
+thread_local ThreadContext* s_ThreadContext = nullptr;
+
+// Stream of the call being serialized, set by StartFunctionCall.
+thread_local CallStream* s_CallStream = nullptr;
+
+// Where the Send* functions below write: the calling stream's record and delta state, or the formatter's while it
+// formats a deferred call, see deferred_calls.h.
+thread_local RecordWriter* s_Record = nullptr;
+thread_local DeltaState* s_Delta = nullptr;
+
+// Called once per thread, from ThreadExitHook.
+static void ReleaseThreadContext(ThreadContext* context);
+
+// Hands the thread's context and stream back to the pool when the thread exits.
+// Only constructed on a thread's first call, so the hot path never pays for the registration.
+struct ThreadExitHook
+{
+    ThreadContext* context;
+
+    ~ThreadExitHook()
+    {
+        if (context != nullptr)
+            ReleaseThreadContext(context);
+    }
+};
+
+thread_local ThreadExitHook s_ThreadExitHook = {};
+
+// Defined in overhead_stats.h.
+static OverheadStats* CreateOverheadStats();
+
+static ThreadContext* GetThreadContext()
+{
+    if (s_ThreadContext == nullptr)
+    {
+        ThreadContext* context = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(s_StreamPoolMutex);
+            context = s_FreeContexts;
+            if (context != nullptr)
+                s_FreeContexts = context->nextFree;
+        }
+
+        // Counters and statistics carry over, they're only ever reported as totals.
+        if (context == nullptr)
+        {
+            context = new ThreadContext();
+            context->stats = nullptr;
+            context->frameTimes = nullptr;
+            context->overhead = CreateOverheadStats();
+            TrackMemory(sizeof(ThreadContext));
+
+            ThreadContext* first = s_ThreadContexts.load(std::memory_order_relaxed);
+            do
+            {
+                context->nextContext = first;
+            } while (!s_ThreadContexts.compare_exchange_weak(first, context, std::memory_order_release, std::memory_order_relaxed));
+        }
+        context->stream = nullptr;
+        context->measuring = false;
+
+        s_ThreadContext = context;
+        s_ThreadExitHook.context = context;
+    }
+    return s_ThreadContext;
+}
+
+static void SetStreamIdentity(CallStream* stream, uint64_t osThreadId, const char (&threadName)[kMaxThreadNameLength])
+{
+    stream->threadIndex = s_NextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    stream->osThreadId = osThreadId;
+    memcpy(stream->threadName, threadName, sizeof(stream->threadName));
+    stream->metadataGeneration = 0;
+    stream->fileSequence = 0;
+    stream->delta.forceKeyframe = true;
+}
+
+static uint64_t StreamBytes(uint32_t perThreadCacheSize)
+{
+    return (uint64_t)ThreadQueue::CapacityFor(perThreadCacheSize) + perThreadCacheSize;
+}
+
+// Must be called with s_StreamPoolMutex held.
+static CallStream* CreateStream(bool shared)
+{
+    CallStream* stream = new CallStream();
+    stream->queue.Create(s_PerThreadCacheSize);
+    stream->record.Create(s_PerThreadCacheSize);
+    stream->shared = shared;
+    TrackMemory(sizeof(CallStream) + stream->queue.capacity + stream->record.fixedCapacity);
+    if (!shared)
+    {
+        s_StreamBytes.fetch_add(stream->queue.capacity + stream->record.fixedCapacity, std::memory_order_relaxed);
+        s_StreamCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    stream->nextStream = s_CallStreams.load(std::memory_order_relaxed);
+    s_CallStreams.store(stream, std::memory_order_release);
+    return stream;
+}
+
+// A free stream if there is one, else a new one if the budget allows, else the shared overflow stream.
+static CallStream* AcquireStream()
+{
+    char threadName[kMaxThreadNameLength];
+    GetOSThreadName(threadName);
+    uint64_t osThreadId = GetOSThreadId();
+
+    std::lock_guard<std::mutex> lock(s_StreamPoolMutex);
+    CallStream* stream = s_FreeStreams;
+    if (stream != nullptr)
+    {
+        s_FreeStreams = stream->nextFree;
+        s_FreeStreamCount.fetch_sub(1, std::memory_order_relaxed);
+
+        // Calls sent under the old identity may still be waiting for the reader.
+        RetiredThread& retired = s_RetiredThreads[s_RetiredThreadCount++ % kMaxRetiredThreads];
+        retired.threadIndex = stream->threadIndex;
+        retired.osThreadId = stream->osThreadId;
+        memcpy(retired.threadName, stream->threadName, sizeof(retired.threadName));
+    }
+    else if (s_StreamBytes.load(std::memory_order_relaxed) + StreamBytes(s_PerThreadCacheSize) <= s_ThreadMemoryBudget)
+    {
+        stream = CreateStream(false);
+    }
+    else
+    {
+        if (s_OverflowStream == nullptr)
+        {
+            static const char kOverflowName[kMaxThreadNameLength] = "over budget";
+            s_OverflowStream = CreateStream(true);
+            SetStreamIdentity(s_OverflowStream, 0, kOverflowName);
+        }
+        s_OverflowThreads.fetch_add(1, std::memory_order_relaxed);
+        return s_OverflowStream;
+    }
+
+    SetStreamIdentity(stream, osThreadId, threadName);
+    return stream;
+}
+
+// Must be called with s_DataMutex held.
+static void DrainThreadQueues();
+
+static void ReleaseThreadContext(ThreadContext* context)
+{
+    CallStream* stream = context->stream;
+
+    // Drained before the stream goes back in the pool, so its next owner starts with an empty queue.
+    if (stream != nullptr && !stream->shared)
+    {
+        std::lock_guard<std::mutex> lock(s_DataMutex);
+        DrainThreadQueues();
+    }
+
+    std::lock_guard<std::mutex> lock(s_StreamPoolMutex);
+    if (stream != nullptr && stream->shared)
+    {
+        s_OverflowThreads.fetch_sub(1, std::memory_order_relaxed);
+    }
+    else if (stream != nullptr)
+    {
+        stream->nextFree = s_FreeStreams;
+        s_FreeStreams = stream;
+        s_FreeStreamCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    context->stream = nullptr;
+    context->nextFree = s_FreeContexts;
+    s_FreeContexts = context;
+
+    s_ThreadContext = nullptr;
+    s_CallStream = nullptr;
+    s_Record = nullptr;
+    s_Delta = nullptr;
+}
+
+// Frees the streams of threads that have exited, and the input arenas of their contexts, see ReleasePooledStreams.
+static void ReleaseFreeStreams()
+{
+    std::lock_guard<std::mutex> dataLock(s_DataMutex);
+    // Their calls were drained when they went back in the pool, this only formats anything deferred since.
+    DrainThreadQueues();
+
+    std::lock_guard<std::mutex> lock(s_StreamPoolMutex);
+    for (CallStream* stream = s_FreeStreams; stream != nullptr;)
+    {
+        CallStream* next = stream->nextFree;
+
+        // Both the drains and the reader walk s_CallStreams, and hold one of the locks above while they do.
+        CallStream* first = s_CallStreams.load(std::memory_order_relaxed);
+        if (first == stream)
+        {
+            s_CallStreams.store(stream->nextStream, std::memory_order_release);
+        }
+        else
+        {
+            CallStream* previous = first;
+            while (previous->nextStream != stream)
+                previous = previous->nextStream;
+            previous->nextStream = stream->nextStream;
+        }
+
+        // Calls sent under its identity may still be waiting for the reader.
+        RetiredThread& retired = s_RetiredThreads[s_RetiredThreadCount++ % kMaxRetiredThreads];
+        retired.threadIndex = stream->threadIndex;
+        retired.osThreadId = stream->osThreadId;
+        memcpy(retired.threadName, stream->threadName, sizeof(retired.threadName));
+
+        uint64_t bytes = stream->queue.capacity + stream->record.fixedCapacity + stream->capture.capacity;
+        TrackMemory(-(int64_t)(sizeof(CallStream) + bytes));
+        s_StreamBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        s_StreamCount.fetch_sub(1, std::memory_order_relaxed);
+        stream->queue.Destroy();
+        stream->record.Destroy();
+        free(stream->capture.data);
+        delete stream;
+        stream = next;
+    }
+    s_FreeStreams = nullptr;
+    s_FreeStreamCount.store(0, std::memory_order_relaxed);
+
+    for (ThreadContext* context = s_FreeContexts; context != nullptr; context = context->nextFree)
+    {
+        CaptureArena& inputs = context->inputs;
+        if (inputs.data == nullptr)
+            continue;
+        TrackMemory(-(int64_t)inputs.capacity);
+        free(inputs.data);
+        inputs.data = nullptr;
+        inputs.capacity = 0;
+    }
+}
+
+// Defined in file_sink.h.
+static void WriteToFileSink(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize);
+
+// Defined in spill_arena.h and deferred_calls.h.
+static bool DrainSpilledRecord(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize);
+static bool IsDeferredCall(const uint8_t* first, uint32_t firstSize, uint32_t secondSize);
+static bool DrainDeferredCall(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize);
+static bool DeferringCalls();
+static void RequestDrain();
+
+// Defined in flight_recorder.h.
+static void FreezePendingSnapshot();
+
+// One record from a stream's queue into the main store and the trace file.  Must be called with s_DataMutex held.
+static void DrainRecord(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize)
+{
+    s_WriteStore->CreateNewBlock();
+    uint8_t* dst = s_WriteStore->GetForWrite(firstSize + secondSize);
+    if (dst != nullptr)
+    {
+        memcpy(dst, first, firstSize);
+        memcpy(dst + firstSize, second, secondSize);
+    }
+    WriteToFileSink(stream, first, firstSize, second, secondSize);
+}
+
+// callingThread is set for drains on a thread that made a call.  Those leave deferred calls, and everything queued
+// after them, to the formatter thread, and a pending freeze to the flight recorder's, so they only ever copy records.
+static void DrainThreadQueues(bool callingThread)
+{
+    if (s_WriteStore->cacheSize != s_CacheSize)
+    {
+        TrackMemory(-(int64_t)s_WriteStore->AllocatedBytes());
+        s_WriteStore->Destroy();
+        // Mirrored where possible, so the reader always gets the whole store in one span.
+        s_WriteStore->Create(s_CacheSize, true);
+        TrackMemory(s_WriteStore->AllocatedBytes());
+    }
+
+    for (CallStream* stream = s_CallStreams.load(std::memory_order_acquire); stream != nullptr; stream = stream->nextStream)
+    {
+        stream->queue.Drain([stream, callingThread](const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize) {
+            if (callingThread && IsDeferredCall(first, firstSize, secondSize))
+                return false;
+            if (!DrainSpilledRecord(stream, first, firstSize, second, secondSize) &&
+                !DrainDeferredCall(stream, first, firstSize, second, secondSize))
+                DrainRecord(stream, first, firstSize, second, secondSize);
+            return true;
+        });
+    }
+
+    if (!callingThread)
+        FreezePendingSnapshot();
+}
+
+static void DrainThreadQueues()
+{
+    DrainThreadQueues(false);
+}
+
+// Defined in overhead_stats.h.
+static void RecordDrain(uint64_t drainTime, bool contended);
+static void RecordLockWait(uint64_t waitTime);
+
+// Drain on the calling thread only if nobody else is already doing it.
+static void TryDrainThreadQueues()
+{
+    if (!s_DataMutex.try_lock())
+    {
+        RecordDrain(0, true);
+        return;
+    }
+    uint64_t drainStart = GetTimestamp();
+    DrainThreadQueues(true);
+    s_DataMutex.unlock();
+    RecordDrain(GetTimestamp() - drainStart, false);
+}
+
+// A name as it will be written: names that came from s_Names are written as their 16 bit id,
+// anything else is written inline after kInlineName.
+struct EncodedName
+{
+    const char* name;
+    uint16_t id;
+    // Inline names only.
+    uint32_t length;
+    uint32_t size;
+};
+
+static EncodedName EncodeName(const char* name)
+{
+    EncodedName encoded;
+    encoded.name = name;
+    encoded.id = NameId(name);
+    encoded.length = encoded.id == kInlineName ? (uint32_t)strlen(name) : 0;
+    encoded.size = sizeof(uint16_t) + (encoded.id == kInlineName ? encoded.length + 1 : 0);
+    return encoded;
+}
+
+static uint8_t* PutName(uint8_t* p, const EncodedName& name)
+{
+    p = PutFixed(p, name.id);
+    if (name.id == kInlineName)
+        p = PutString(p, name.name, name.length);
+    return p;
+}
+
+static uint8_t* PutDelta(uint8_t* p, uint16_t nameId, uint64_t value)
+{
+    uint64_t& last = s_Delta->values[DeltaSlot(nameId)];
+    p = PutVarInt(p, (int64_t)(value - last));
+    last = value;
+    return p;
+}
+
+// The calling thread's stream, locked if it's the overflow stream.  Unlocked by EndFunctionCall or EndDeferredCall.
+static CallStream* BeginStreamCall()
+{
+    ThreadContext* context = GetThreadContext();
+    CallStream* stream = context->stream;
+    // Threads on the overflow stream move to their own as soon as one is freed.
+    if (stream == nullptr || (stream->shared && s_FreeStreamCount.load(std::memory_order_relaxed) != 0))
+    {
+        if (stream != nullptr)
+            s_OverflowThreads.fetch_sub(1, std::memory_order_relaxed);
+        stream = AcquireStream();
+        context->stream = stream;
+    }
+    // Only timed when another thread has it.
+    if (stream->shared && !s_OverflowMutex.try_lock())
+    {
+        uint64_t waitStart = GetTimestamp();
+        s_OverflowMutex.lock();
+        RecordLockWait(GetTimestamp() - waitStart);
+    }
+    // perThreadCacheSize changed since the queue was made, it's replaced once the reader has emptied it.
+    if (stream->queue.recordSize != s_PerThreadCacheSize)
+    {
+        int64_t growth = stream->queue.TryResize(s_PerThreadCacheSize);
+        TrackMemory(growth);
+        if (!stream->shared)
+            s_StreamBytes.fetch_add((uint64_t)growth, std::memory_order_relaxed);
+    }
+    s_CallStream = stream;
+    return stream;
+}
+
+// Starts record with the call's header, a keyframe if delta is due one.
+static void WriteCallStart(RecordWriter& record, DeltaState& delta, uint32_t threadIndex, uint16_t sequence, const char* funcName)
+{
+    uint32_t generation = s_KeyframeGeneration.load(std::memory_order_relaxed);
+    bool keyframe = delta.forceKeyframe || delta.callsSinceKeyframe >= kKeyframeInterval || delta.keyframeGeneration != generation;
+    if (keyframe)
+    {
+        memset(delta.values, 0, sizeof(delta.values));
+        delta.startTime = 0;
+        delta.frame = 0;
+        delta.callsSinceKeyframe = 0;
+        delta.keyframeGeneration = generation;
+        delta.forceKeyframe = false;
+    }
+    ++delta.callsSinceKeyframe;
+
+    record.Reset();
+    EncodedName name = EncodeName(funcName);
+    uint8_t* p = record.Reserve(1 + kMaxVarUInt32Size + sizeof(uint16_t) + name.size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, keyframe ? kStartKeyframeCall : kStartFunctionCall);
+    p = PutVarUInt(p, threadIndex);
+    p = PutFixed(p, sequence);
+    record.Commit(PutName(p, name));
+}
+
+// Called after the runtime call, so the overflow stream is never held across one.
+// Every Send* below reserves its whole command at once, see record_writer.h.
+static void StartFunctionCall(const char* funcName)
+{
+    CallStream* stream = BeginStreamCall();
+    RecordWriter& record = stream->record;
+    if (record.fixedCapacity != s_PerThreadCacheSize)
+    {
+        int64_t growth = (int64_t)s_PerThreadCacheSize - (int64_t)record.fixedCapacity;
+        record.Destroy();
+        record.Create(s_PerThreadCacheSize);
+        TrackMemory(growth);
+        if (!stream->shared)
+            s_StreamBytes.fetch_add((uint64_t)growth, std::memory_order_relaxed);
+    }
+
+    // Values sent since the last keyframe went through the formatter's delta state, not this one.
+    DeltaState& delta = stream->delta;
+    if (stream->lastCallDeferred)
+    {
+        delta.forceKeyframe = true;
+        stream->lastCallDeferred = false;
+    }
+
+    s_Record = &record;
+    s_Delta = &delta;
+    WriteCallStart(record, delta, stream->threadIndex, ++delta.sequence, funcName);
+}
+
+// Followed by the struct's fields, packed with the Pack* functions below, see serialize_structs.h.
+static void StartStruct(const char* fieldName, StructId structId)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + kMaxVarUInt32Size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kStruct);
+    p = PutName(p, field);
+    s_Record->Commit(PutVarUInt(p, structId));
+}
+
+static void SendFloat(const char* fieldName, float t)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + sizeof(float));
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kFloat);
+    p = PutName(p, field);
+    s_Record->Commit(PutFixed(p, t));
+}
+
+static void SendString(const char* fieldName, const char* t)
+{
+    EncodedName field = EncodeName(fieldName);
+    size_t length = strlen(t);
+    uint8_t* p = s_Record->Reserve(1 + field.size + length + 1);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kString);
+    p = PutName(p, field);
+    s_Record->Commit(PutString(p, t, length));
+}
+
+static void SendInt32(const char* fieldName, int32_t t)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + kMaxVarUInt32Size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kInt32);
+    p = PutName(p, field);
+    s_Record->Commit(PutVarInt(p, t));
+}
+
+static void SendInt64(const char* fieldName, int64_t t)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + kMaxVarUInt64Size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kInt64);
+    p = PutName(p, field);
+    s_Record->Commit(PutDelta(p, field.id, (uint64_t)t));
+}
+
+static void SendUInt32(const char* fieldName, uint32_t t)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + kMaxVarUInt32Size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kUInt32);
+    p = PutName(p, field);
+    s_Record->Commit(PutVarUInt(p, t));
+}
+
+static void SendUInt64(const char* fieldName, uint64_t t)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + kMaxVarUInt64Size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kUInt64);
+    p = PutName(p, field);
+    s_Record->Commit(PutDelta(p, field.id, t));
+}
+
+static void SendEnum(const char* fieldName, EnumTypeId enumType, int32_t t)
+{
+    EncodedName field = EncodeName(fieldName);
+    uint8_t* p = s_Record->Reserve(1 + field.size + kMaxVarUInt32Size + kMaxVarUInt32Size);
+    if (p == nullptr)
+        return;
+    p = PutCommand(p, kEnum);
+    p = PutName(p, field);
+    p = PutVarUInt(p, enumType);
+    s_Record->Commit(PutVarInt(p, t));
+}
+
+static void EndField()
+{
+    uint8_t* p = s_Record->Reserve(1);
+    if (p == nullptr)
+        return;
+    s_Record->Commit(PutCommand(p, kEndField));
+}
+
+// Struct fields, without a command or name.
+static void PackFloat(float t)
+{
+    uint8_t* p = s_Record->Reserve(sizeof(float));
+    if (p != nullptr)
+        s_Record->Commit(PutFixed(p, t));
+}
+
+static void PackVarInt(int64_t t)
+{
+    uint8_t* p = s_Record->Reserve(kMaxVarUInt64Size);
+    if (p != nullptr)
+        s_Record->Commit(PutVarInt(p, t));
+}
+
+static void PackVarUInt(uint64_t t)
+{
+    uint8_t* p = s_Record->Reserve(kMaxVarUInt64Size);
+    if (p != nullptr)
+        s_Record->Commit(PutVarUInt(p, t));
+}
+
+static void PackDelta(uint16_t fieldNameId, uint64_t t)
+{
+    uint8_t* p = s_Record->Reserve(kMaxVarUInt64Size);
+    if (p != nullptr)
+        s_Record->Commit(PutDelta(p, fieldNameId, t));
+}
+
+static void PackString(const char* t, size_t length)
+{
+    uint8_t* p = s_Record->Reserve(length + 1);
+    if (p != nullptr)
+        s_Record->Commit(PutString(p, t, length));
+}
+
+// Defined in spill_arena.h.
+static bool PublishSpilledRecord(CallStream* stream);
+
+static bool PublishRecord(CallStream* stream)
+{
+    if (stream->record.Spilled())
+        return PublishSpilledRecord(stream);
+
+    uint32_t size = stream->record.Size();
+    if (!stream->queue.TryReserve(size))
+    {
+        // With the formatter thread running it's the only one that drains, the record is dropped meanwhile.
+        if (DeferringCalls())
+        {
+            RequestDrain();
+            return false;
+        }
+        TryDrainThreadQueues();
+        if (!stream->queue.TryReserve(size))
+            return false;
+    }
+
+    stream->queue.Write(stream->record.base, size);
+    stream->queue.Publish();
+    return true;
+}
+
+// Defined in call_stats.h.
+static void RecordMeasuredBytes(ThreadContext* context, uint32_t bytes);
+
+static void WriteCallEnd(RecordWriter& record, DeltaState& delta, XrResult result, uint64_t startTime, uint64_t duration, uint32_t frame)
+{
+    uint8_t* p = record.Reserve(1 + kMaxVarUInt32Size + 2 * kMaxVarUInt64Size + kMaxVarUInt32Size);
+    if (p != nullptr)
+    {
+        p = PutCommand(p, kEndFunctionCall);
+        p = PutVarInt(p, result);
+        p = PutVarUInt(p, startTime - delta.startTime);
+        p = PutVarUInt(p, duration);
+        record.Commit(PutVarUInt(p, frame - delta.frame));
+    }
+    delta.startTime = startTime;
+    delta.frame = frame;
+}
+
+// Replaces a record that overflowed with just the call's name and result.  The next call has to be a keyframe.
+static void WriteCacheNotLargeEnough(RecordWriter& record, DeltaState& delta, uint32_t threadIndex, const char* funcName, XrResult result, uint64_t startTime, uint64_t duration, uint32_t frame)
+{
+    record.Reset();
+    EncodedName name = EncodeName(funcName);
+    uint8_t* p = record.Reserve(1 + kMaxVarUInt32Size + name.size + kMaxVarUInt32Size + 2 * kMaxVarUInt64Size + kMaxVarUInt32Size);
+    if (p != nullptr)
+    {
+        p = PutCommand(p, kCacheNotLargeEnough);
+        p = PutVarUInt(p, threadIndex);
+        p = PutName(p, name);
+        p = PutVarInt(p, result);
+        p = PutVarUInt(p, startTime);
+        p = PutVarUInt(p, duration);
+        record.Commit(PutVarUInt(p, frame));
+    }
+    delta.forceKeyframe = true;
+}
+
+static void FinishFunctionCall(ThreadContext* context, CallStream* stream, const char* funcName, XrResult result, uint64_t startTime, uint64_t duration, uint32_t frame)
+{
+    RecordWriter& record = stream->record;
+    WriteCallEnd(record, stream->delta, result, startTime, duration, frame);
+
+    if (context->measuring)
+    {
+        context->measuring = false;
+        stream->delta.forceKeyframe = true;
+        if (!record.overflowed)
+            RecordMeasuredBytes(context, record.Size());
+        return;
+    }
+
+    if (record.overflowed)
+        WriteCacheNotLargeEnough(record, stream->delta, stream->threadIndex, funcName, result, startTime, duration, frame);
+
+    if (record.overflowed || !PublishRecord(stream))
+    {
+        stream->delta.forceKeyframe = true;
+        stream->queue.droppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Keep the main store current without making anyone wait for it.
+    if (stream->queue.UsedBytes() > stream->queue.capacity / 2)
+        RequestDrain();
+}
+
+// startTime and duration only cover the call into the runtime, not the serialization around it.
+// frame is the one the call started in, from CurrentFrame.
+static void EndFunctionCall(const char* funcName, XrResult result, uint64_t startTime, uint64_t duration, uint32_t frame)
+{
+    CallStream* stream = s_CallStream;
+    FinishFunctionCall(GetThreadContext(), stream, funcName, result, startTime, duration, frame);
+    // A spill block that wasn't handed to the queue counts against s_SpillBudget until it's freed.
+    if (stream->record.Spilled())
+        stream->record.Reset();
+    if (stream->shared)
+        s_OverflowMutex.unlock();
+}
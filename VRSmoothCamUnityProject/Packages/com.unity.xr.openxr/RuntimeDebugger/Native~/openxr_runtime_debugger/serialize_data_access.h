@@ -0,0 +1,269 @@
+#pragma once
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+// Metadata (name table, thread info, drop counts) isn't kept in the ring buffer, where it could be overwritten.
+// It's written by the reader instead, at the start of the first read that needs it.
+// Bumping the generation makes every thread's kThreadInfo go out again.
+static std::atomic<bool> s_SendNameTable{true};
+static std::atomic<uint32_t> s_MetadataGeneration{1};
+
+// Protected by s_ReadMutex.
+static std::vector<uint8_t> s_Metadata;
+static bool s_MetadataRead = false;
+
+template <typename T>
+static void AppendMetadata(T t)
+{
+    const uint8_t* bytes = (const uint8_t*)&t;
+    s_Metadata.insert(s_Metadata.end(), bytes, bytes + sizeof(T));
+}
+
+static void AppendMetadata(const char* s, size_t size)
+{
+    s_Metadata.insert(s_Metadata.end(), (const uint8_t*)s, (const uint8_t*)s + size);
+}
+
+static void AppendThreadInfo(uint32_t threadIndex, uint64_t osThreadId, const char* threadName)
+{
+    AppendMetadata(kThreadInfo);
+    AppendMetadata(threadIndex);
+    AppendMetadata(osThreadId);
+    AppendMetadata(threadName, strlen(threadName) + 1);
+}
+
+// Must be called with s_ReadMutex held.
+static void BuildMetadata()
+{
+    s_Metadata.clear();
+    s_MetadataRead = false;
+
+    // kNameTable, size, then the raw bytes of s_Names.  kEnumTable and kSchemaTable, size, then the blob.
+    if (s_SendNameTable.exchange(false))
+    {
+        AppendMetadata(kNameTable);
+        AppendMetadata((uint32_t)sizeof(NameBlob));
+        AppendMetadata((const char*)&s_Names, sizeof(NameBlob));
+
+        const std::vector<uint8_t>& enumTable = EnumTable();
+        AppendMetadata(kEnumTable);
+        AppendMetadata((uint32_t)enumTable.size());
+        AppendMetadata((const char*)enumTable.data(), enumTable.size());
+
+        const std::vector<uint8_t>& schemaTable = SchemaTable();
+        AppendMetadata(kSchemaTable);
+        AppendMetadata((uint32_t)schemaTable.size());
+        AppendMetadata((const char*)schemaTable.data(), schemaTable.size());
+    }
+
+    // kThreadInfo, thread index, os thread id, thread name.  Retired threads first, their calls are older.
+    {
+        std::lock_guard<std::mutex> lock(s_StreamPoolMutex);
+        uint32_t retiredCount = std::min(s_RetiredThreadCount, kMaxRetiredThreads);
+        for (uint32_t i = s_RetiredThreadCount - retiredCount; i != s_RetiredThreadCount; ++i)
+        {
+            const RetiredThread& retired = s_RetiredThreads[i % kMaxRetiredThreads];
+            AppendThreadInfo(retired.threadIndex, retired.osThreadId, retired.threadName);
+        }
+        s_RetiredThreadCount = 0;
+
+        uint32_t generation = s_MetadataGeneration.load();
+        for (CallStream* stream = s_CallStreams.load(std::memory_order_acquire); stream != nullptr; stream = stream->nextStream)
+        {
+            if (stream->metadataGeneration == generation)
+                continue;
+            stream->metadataGeneration = generation;
+            AppendThreadInfo(stream->threadIndex, stream->osThreadId, stream->threadName);
+        }
+    }
+
+    // kDroppedData, calls and bytes the reader will never see because they were overwritten.
+    if (s_ReadStore->droppedBlocks != 0)
+    {
+        AppendMetadata(kDroppedData);
+        AppendMetadata(s_ReadStore->droppedBlocks);
+        AppendMetadata(s_ReadStore->droppedBytes);
+        s_ReadStore->droppedBlocks = 0;
+        s_ReadStore->droppedBytes = 0;
+    }
+}
+
+// New capture session or the reader lost its copy: send all the metadata again.
+static void ResendMetadata()
+{
+    s_SendNameTable = true;
+    s_MetadataGeneration.fetch_add(1);
+    s_KeyframeGeneration.fetch_add(1);
+}
+
+// s_DataMutex is only held for the swap, so the reader never holds up a drain.  Calls still in a thread's queue
+// weren't drained yet and go out with a later read, once a calling thread, the formatter or the file sink drains them.
+extern "C" void UNITY_INTERFACE_EXPORT StartDataAccess()
+{
+    s_ReadMutex.lock();
+
+    s_DataMutex.lock();
+    std::swap(s_WriteStore, s_ReadStore);
+    s_DataMutex.unlock();
+
+    BuildMetadata();
+}
+
+// returns true if there is more data to read, keep calling until it returns false.
+extern "C" bool UNITY_INTERFACE_EXPORT GetDataForRead(uint8_t** ptr, uint32_t* size)
+{
+    if (!s_MetadataRead && !s_Metadata.empty())
+    {
+        s_MetadataRead = true;
+        *ptr = s_Metadata.data();
+        *size = (uint32_t)s_Metadata.size();
+        return true;
+    }
+
+    return s_ReadStore->GetForRead(ptr, size);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT EndDataAccess()
+{
+    s_ReadStore->Reset();
+    s_ReadMutex.unlock();
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT RequestMetadata()
+{
+    ResendMetadata();
+}
+
+// One function's statistics, merged across threads.  Durations are in nanoseconds, p50 and p99 are bucket midpoints.
+// estimatedBytes is what full capture would have sent for these calls, extrapolated from the measured ones.
+struct FunctionStatsSnapshot
+{
+    uint32_t functionId;
+    uint32_t threadCount;
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t minDuration;
+    uint64_t maxDuration;
+    uint64_t meanDuration;
+    uint64_t p50Duration;
+    uint64_t p99Duration;
+    uint64_t estimatedBytes;
+};
+
+// Fills snapshots with every function called since the last ResetStats, returns how many were written.
+// Doesn't stop the calling threads, so a snapshot taken mid-frame can be a few calls out between threads.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT GetStatsSnapshot(FunctionStatsSnapshot* snapshots, uint32_t capacity)
+{
+    uint32_t generation = s_StatsGeneration.load();
+    uint32_t count = 0;
+    for (uint32_t id = 0; id < kFuncCount && count < capacity; ++id)
+    {
+        FunctionStatsSnapshot snapshot{};
+        uint64_t histogram[kLatencyBuckets]{};
+        uint64_t measuredCalls = 0;
+        uint64_t measuredBytes = 0;
+        uint64_t totalDuration = 0;
+
+        for (ThreadContext* context = s_ThreadContexts.load(std::memory_order_acquire); context != nullptr; context = context->nextContext)
+        {
+            ThreadStats* stats = context->stats.load(std::memory_order_acquire);
+            if (stats == nullptr || stats->generation.load(std::memory_order_acquire) != generation)
+                continue;
+
+            const FuncStats& funcStats = stats->funcs[id];
+            uint64_t calls = funcStats.calls.load(std::memory_order_relaxed);
+            if (calls == 0)
+                continue;
+
+            uint64_t minDuration = funcStats.minDuration.load(std::memory_order_relaxed);
+            if (snapshot.calls == 0 || minDuration < snapshot.minDuration)
+                snapshot.minDuration = minDuration;
+            snapshot.maxDuration = std::max(snapshot.maxDuration, funcStats.maxDuration.load(std::memory_order_relaxed));
+            snapshot.calls += calls;
+            snapshot.errors += funcStats.errors.load(std::memory_order_relaxed);
+            ++snapshot.threadCount;
+
+            totalDuration += funcStats.totalDuration.load(std::memory_order_relaxed);
+            measuredCalls += funcStats.measuredCalls.load(std::memory_order_relaxed);
+            measuredBytes += funcStats.measuredBytes.load(std::memory_order_relaxed);
+            for (uint32_t bucket = 0; bucket < kLatencyBuckets; ++bucket)
+                histogram[bucket] += funcStats.histogram[bucket].load(std::memory_order_relaxed);
+        }
+
+        if (snapshot.calls == 0)
+            continue;
+
+        snapshot.functionId = id;
+        snapshot.meanDuration = totalDuration / snapshot.calls;
+        snapshot.p50Duration = std::min(std::max(HistogramPercentile(histogram, snapshot.calls, 50), snapshot.minDuration), snapshot.maxDuration);
+        snapshot.p99Duration = std::min(std::max(HistogramPercentile(histogram, snapshot.calls, 99), snapshot.minDuration), snapshot.maxDuration);
+        if (measuredCalls != 0)
+            snapshot.estimatedBytes = measuredBytes * snapshot.calls / measuredCalls;
+        snapshots[count++] = snapshot;
+    }
+    return count;
+}
+
+// Each thread clears its own statistics on its next call, until then GetStatsSnapshot skips them.
+extern "C" void UNITY_INTERFACE_EXPORT ResetStats()
+{
+    s_StatsGeneration.fetch_add(1);
+}
+
+// For labelling GetStatsSnapshot results, nullptr if id is out of range.
+extern "C" UNITY_INTERFACE_EXPORT const char* GetFunctionName(uint32_t id)
+{
+    return id < kFuncCount ? s_FuncNames[id] : nullptr;
+}
+
+// Upper bound on what GetStatsSnapshot can return.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT GetFunctionCount()
+{
+    return kFuncCount;
+}
+
+// Debugger memory use.  currentBytes and highWaterBytes cover everything: main stores, streams, spill blocks, thread
+// contexts and statistics.
+struct MemoryStats
+{
+    uint64_t currentBytes;
+    uint64_t highWaterBytes;
+    // Per-thread streams, held under streamBudget.  The overflow stream isn't counted.
+    uint64_t streamBytes;
+    uint64_t streamBudget;
+    uint32_t streams;
+    uint32_t freeStreams;
+    // Threads sharing the overflow stream because a stream of their own would go over streamBudget.
+    uint32_t overflowThreads;
+    uint32_t padding;
+    // Calls too large for a stream's record buffer, see spill_arena.h.
+    uint64_t spillBytes;
+    uint64_t spillBudget;
+    uint64_t spilledCalls;
+    uint64_t droppedSpilledCalls;
+};
+
+extern "C" void UNITY_INTERFACE_EXPORT GetMemoryStats(MemoryStats* stats)
+{
+    stats->currentBytes = s_MemoryBytes.load(std::memory_order_relaxed);
+    stats->highWaterBytes = s_MemoryHighWater.load(std::memory_order_relaxed);
+    stats->streamBytes = s_StreamBytes.load(std::memory_order_relaxed);
+    stats->streamBudget = s_ThreadMemoryBudget;
+    stats->streams = s_StreamCount.load(std::memory_order_relaxed);
+    stats->freeStreams = s_FreeStreamCount.load(std::memory_order_relaxed);
+    stats->overflowThreads = s_OverflowThreads.load(std::memory_order_relaxed);
+    stats->padding = 0;
+    stats->spillBytes = s_SpillBytes.load(std::memory_order_relaxed);
+    stats->spillBudget = s_SpillBudget;
+    stats->spilledCalls = s_SpilledRecords.load(std::memory_order_relaxed);
+    stats->droppedSpilledCalls = s_SpillDroppedRecords.load(std::memory_order_relaxed);
+}
+
+// Frees the streams threads left in the pool when they exited, for when the instance is destroyed.  Threads that still
+// have a stream keep it, and the overflow stream is kept for whoever is on it.
+extern "C" void UNITY_INTERFACE_EXPORT ReleasePooledStreams()
+{
+    ReleaseFreeStreams();
+}
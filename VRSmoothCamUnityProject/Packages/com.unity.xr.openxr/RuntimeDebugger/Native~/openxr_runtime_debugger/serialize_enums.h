@@ -0,0 +1,52 @@
+#pragma once
+
+// Enum values go over the wire as numbers tagged with their type, EnumTable() has the names.
+
+#define SEND_TO_CSHARP_ENUMS(enumname)                             \
+    template <>                                                    \
+    void SendToCSharp<enumname>(const char* fieldname, enumname t) \
+    {                                                              \
+        SendEnum(fieldname, kEnumType_##enumname, (int32_t)t);     \
+    }
+
+XR_LIST_ENUM_TYPES(SEND_TO_CSHARP_ENUMS)
+
+#define SEND_TO_CSHARP_ENUMS_PTR(enumname)                           \
+    template <>                                                      \
+    void SendToCSharp<enumname*>(const char* fieldname, enumname* t) \
+    {                                                                \
+        if (t != nullptr)                                            \
+            SendEnum(fieldname, kEnumType_##enumname, (int32_t)*t);  \
+        else                                                         \
+            SendString(fieldname, "nullptr");                        \
+    }
+
+XR_LIST_ENUM_TYPES(SEND_TO_CSHARP_ENUMS_PTR)
+
+static void AppendEnumTable(std::vector<uint8_t>& table, const char* name, uint64_t value)
+{
+    uint8_t varint[kMaxVarUInt64Size];
+    table.insert(table.end(), varint, PutVarUInt(varint, value));
+    table.insert(table.end(), (const uint8_t*)name, (const uint8_t*)name + strlen(name) + 1);
+}
+
+#define ENUM_TABLE_COUNT(enumentry, enumvalue) \
+    +1
+
+#define ENUM_TABLE_VALUE(enumentry, enumvalue) \
+    AppendEnumTable(table, #enumentry, ZigZagEncode((int32_t)enumvalue));
+
+#define ENUM_TABLE_TYPE(enumname)                                                   \
+    AppendEnumTable(table, #enumname, 0 XR_LIST_ENUM_##enumname(ENUM_TABLE_COUNT)); \
+    XR_LIST_ENUM_##enumname(ENUM_TABLE_VALUE)
+
+// Built once, the first time it's sent.
+static const std::vector<uint8_t>& EnumTable()
+{
+    static const std::vector<uint8_t> s_EnumTable = []() {
+        std::vector<uint8_t> table;
+        XR_LIST_ENUM_TYPES(ENUM_TABLE_TYPE)
+        return table;
+    }();
+    return s_EnumTable;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+// Begin Declaration of original functions
+static PFN_xrGetInstanceProcAddr orig_xrGetInstanceProcAddr;
+
+#define GEN_ORIG_FUNC_PTRS(f, ...) \
+    static PFN_##f orig_##f;
+
+XR_LIST_FUNCS(GEN_ORIG_FUNC_PTRS)
+// End Declaration of original functions
+
+#define GEN_PARAMS(...) \
+    __VA_ARGS__
+
+#define SEND_PARAM_TO_CSHARP(param) \
+    SendToCSharp(fieldNames.param, param);
+
+#define SEND_ARRAY_TO_CSHARP(param, lenParam)                            \
+    if (!SendToCSharpBaseStructArray(fieldNames.param, param, lenParam)) \
+    {                                                                    \
+        for (uint32_t i = 0; i < lenParam; ++i)                          \
+            SendArrayElement(fieldNames.param, param[i]);                \
+    }
+
+#define COPY_PARAM(param) \
+    CopyDeep(param, arena);
+
+#define COPY_ARRAY(param, lenParam) \
+    CopyArray(param, lenParam, arena);
+
+#define COPY_INPUT_PARAM(param) \
+    CopyInput(param, arena);
+
+// Send_xrFoo serializes the arguments, straight from the hook or from the copy Capture_xrFoo made of them when the
+// call is deferred, see deferred_calls.h.  CaptureInputs_xrFoo copies them before the call, see recorded_inputs.h.
+#define GEN_FUNCS(f, ...)                                                                                             \
+    static void Send_##f(__VA_ARGS__)                                                                                 \
+    {                                                                                                                 \
+        const auto& fieldNames = s_Names.f;                                                                           \
+        XR_LIST_FUNC_##f(SEND_PARAM_TO_CSHARP);                                                                       \
+        XR_LIST_FUNC_ARRAYS_##f(SEND_ARRAY_TO_CSHARP);                                                                \
+    }                                                                                                                 \
+                                                                                                                      \
+    static const void* Capture_##f(CaptureArena& arena, __VA_ARGS__)                                                  \
+    {                                                                                                                 \
+        XR_LIST_FUNC_##f(COPY_PARAM);                                                                                 \
+        XR_LIST_FUNC_ARRAYS_##f(COPY_ARRAY);                                                                          \
+        return arena.New<FuncArgs<PFN_##f>::type>(XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                          \
+    }                                                                                                                 \
+                                                                                                                      \
+    static const void* CaptureInputs_##f(CaptureArena& arena, __VA_ARGS__)                                            \
+    {                                                                                                                 \
+        XR_LIST_FUNC_##f(COPY_INPUT_PARAM);                                                                           \
+        XR_LIST_FUNC_ARRAYS_##f(COPY_ARRAY);                                                                          \
+        return arena.New<FuncArgs<PFN_##f>::type>(XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                          \
+    }                                                                                                                 \
+                                                                                                                      \
+    static void Format_##f(const void* args)                                                                          \
+    {                                                                                                                 \
+        CallWithArgs(Send_##f, *static_cast<const FuncArgs<PFN_##f>::type*>(args));                                   \
+    }                                                                                                                 \
+                                                                                                                      \
+    extern "C" XrResult UNITY_INTERFACE_EXPORT XRAPI_PTR f(__VA_ARGS__)                                               \
+    {                                                                                                                 \
+        CallAction callAction = BeginCall(kFunc_##f);                                                                 \
+        if (callAction == kForwardCall)                                                                               \
+            return orig_##f(XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                                                \
+                                                                                                                      \
+        OverheadScope overhead;                                                                                       \
+                                                                                                                      \
+        uint32_t frame = CurrentFrame(kFunc_##f);                                                                     \
+        const void* inputs = nullptr;                                                                                 \
+        if (callAction == kSerializeCall && RecordingInputs())                                                        \
+            inputs = CaptureInputs_##f(BeginRecordInputs(), XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                \
+        uint64_t startTime = GetTimestamp();                                                                          \
+        XrResult result = orig_##f(XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                                         \
+        uint64_t duration = GetTimestamp() - startTime;                                                               \
+        overhead.runtime = duration;                                                                                  \
+        if (callAction != kSerializeCall)                                                                             \
+            RecordCallStats(kFunc_##f, result, duration);                                                             \
+        if (callAction == kTimeCall)                                                                                  \
+            return result;                                                                                            \
+                                                                                                                      \
+        const auto& fieldNames = s_Names.f;                                                                           \
+        if (callAction == kSerializeCall)                                                                             \
+            RecordFrameCall(kFunc_##f, frame, result, startTime, duration, XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS)); \
+        if (callAction == kSerializeCall && DeferringCalls())                                                         \
+        {                                                                                                             \
+            CaptureArena& arena = BeginDeferredCall();                                                                \
+            const void* args = inputs != nullptr                                                                      \
+                ? CaptureRecordedCall(Capture_##f, arena, inputs, XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS))           \
+                : Capture_##f(arena, XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                                       \
+            void (*format)(const void*) = inputs != nullptr ? FormatRecordedCall<Format_##f> : Format_##f;            \
+            if (EndDeferredCall(fieldNames.name_, format, args, result, startTime, duration, frame))                  \
+            {                                                                                                         \
+                CheckFreezeTriggers(kFunc_##f, result, frame, startTime, duration);                                   \
+                return result;                                                                                        \
+            }                                                                                                         \
+        }                                                                                                             \
+                                                                                                                      \
+        StartFunctionCall(fieldNames.name_);                                                                          \
+        if (inputs != nullptr)                                                                                        \
+        {                                                                                                             \
+            Format_##f(inputs);                                                                                       \
+            SendCallOutputs();                                                                                        \
+        }                                                                                                             \
+        Send_##f(XR_LIST_FUNC_PARAM_NAMES_##f(GEN_PARAMS));                                                           \
+        EndFunctionCall(fieldNames.name_, result, startTime, duration, frame);                                        \
+        CheckFreezeTriggers(kFunc_##f, result, frame, startTime, duration);                                           \
+        return result;                                                                                                \
+    }
+
+XR_LIST_FUNCS(GEN_FUNCS)
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#define SPECIALIZED_FUNCS(_) \
+    _(xrLoadControllerModelMSFT, void)
+
+static PFN_xrLoadControllerModelMSFT orig_xrLoadControllerModelMSFT;
+XrResult UNITY_INTERFACE_EXPORT XRAPI_PTR xrLoadControllerModelMSFT(XrSession session, XrControllerModelKeyMSFT modelKey, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer)
+{
+    CallAction action = BeginCall(kFunc_xrLoadControllerModelMSFT);
+    if (action == kForwardCall)
+        return orig_xrLoadControllerModelMSFT(session, modelKey, bufferCapacityInput, bufferCountOutput, buffer);
+
+    OverheadScope overhead;
+
+    uint32_t frame = CurrentFrame(kFunc_xrLoadControllerModelMSFT);
+    uint64_t startTime = GetTimestamp();
+    XrResult result = orig_xrLoadControllerModelMSFT(session, modelKey, bufferCapacityInput, bufferCountOutput, buffer);
+    uint64_t duration = GetTimestamp() - startTime;
+    overhead.runtime = duration;
+    if (action != kSerializeCall)
+        RecordCallStats(kFunc_xrLoadControllerModelMSFT, result, duration);
+    if (action == kTimeCall)
+        return result;
+
+    const auto& fieldNames = s_Names.xrLoadControllerModelMSFT;
+    if (action == kSerializeCall)
+        RecordFrameCall(kFunc_xrLoadControllerModelMSFT, frame, result, startTime, duration, session, modelKey, bufferCapacityInput, bufferCountOutput, buffer);
+    StartFunctionCall(fieldNames.name_);
+    SendToCSharp(fieldNames.session, session);
+    SendToCSharp(fieldNames.modelKey, modelKey);
+    SendToCSharp(fieldNames.bufferCapacityInput, bufferCapacityInput);
+    SendToCSharp(fieldNames.bufferCountOutput, bufferCountOutput);
+    SendToCSharp(fieldNames.buffer, "<TODO>");
+    EndFunctionCall(fieldNames.name_, result, startTime, duration, frame);
+    CheckFreezeTriggers(kFunc_xrLoadControllerModelMSFT, result, frame, startTime, duration);
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "trace_format.h"
+
+// Every function, parameter, struct and field name from the reflection lists, laid out back to back as NUL-terminated strings.
+// A name's id is its byte offset into s_Names, so the raw bytes of s_Names are the id -> string dictionary sent to c#.
+// Serializers pass s_Names.<function>.<param> / s_Names.<struct>.<field> as the field name and only the id goes over the wire.
+
+// Hand written serializers that aren't in the reflection lists.
+#define XR_LIST_FUNC_xrGetInstanceProcAddr(_) \
+    _(instance)                               \
+    _(name)                                   \
+    _(function)
+#define XR_LIST_FUNC_ARRAYS_xrGetInstanceProcAddr(_)
+
+#define XR_LIST_FUNC_xrLoadControllerModelMSFT(_) \
+    _(session)                                    \
+    _(modelKey)                                   \
+    _(bufferCapacityInput)                        \
+    _(bufferCountOutput)                          \
+    _(buffer)
+#define XR_LIST_FUNC_ARRAYS_xrLoadControllerModelMSFT(_)
+
+#define XR_LIST_EXTRA_NAME_FUNCS(_) \
+    _(xrGetInstanceProcAddr)        \
+    _(xrLoadControllerModelMSFT)
+
+// Field names used outside of a particular struct.
+#define XR_LIST_EXTRA_NAMES(_) \
+    _(next)                    \
+    _(varying)
+
+#define NAME_DECL(name) \
+    char name[sizeof(#name)];
+
+#define NAME_ARRAY_DECL(name, lenName) \
+    char name[sizeof(#name)];
+
+#define NAME_FUNC_DECL(f, ...)                   \
+    struct                                       \
+    {                                            \
+        char name_[sizeof(#f)];                  \
+        XR_LIST_FUNC_##f(NAME_DECL)              \
+        XR_LIST_FUNC_ARRAYS_##f(NAME_ARRAY_DECL) \
+    } f;
+
+#define NAME_STRUCT_DECL(s, ...)                   \
+    struct                                         \
+    {                                              \
+        char name_[sizeof(#s)];                    \
+        XR_LIST_STRUCT_##s(NAME_DECL)              \
+        XR_LIST_STRUCT_ARRAYS_##s(NAME_ARRAY_DECL) \
+    } s;
+
+struct NameBlob
+{
+    XR_LIST_FUNCS(NAME_FUNC_DECL)
+    XR_LIST_EXTRA_NAME_FUNCS(NAME_FUNC_DECL)
+    XR_LIST_BASIC_STRUCTS(NAME_STRUCT_DECL)
+    XR_LIST_STRUCTURE_TYPES(NAME_STRUCT_DECL)
+
+    struct
+    {
+        XR_LIST_EXTRA_NAMES(NAME_DECL)
+    } extra;
+};
+
+#define NAME_INIT(name) \
+    #name,
+
+#define NAME_ARRAY_INIT(name, lenName) \
+    #name,
+
+#define NAME_FUNC_INIT(f, ...) \
+    {#f, XR_LIST_FUNC_##f(NAME_INIT) XR_LIST_FUNC_ARRAYS_##f(NAME_ARRAY_INIT)},
+
+#define NAME_STRUCT_INIT(s, ...) \
+    {#s, XR_LIST_STRUCT_##s(NAME_INIT) XR_LIST_STRUCT_ARRAYS_##s(NAME_ARRAY_INIT)},
+
+// clang-format off
+static constexpr NameBlob s_Names = {
+    XR_LIST_FUNCS(NAME_FUNC_INIT)
+    XR_LIST_EXTRA_NAME_FUNCS(NAME_FUNC_INIT)
+    XR_LIST_BASIC_STRUCTS(NAME_STRUCT_INIT)
+    XR_LIST_STRUCTURE_TYPES(NAME_STRUCT_INIT)
+    {XR_LIST_EXTRA_NAMES(NAME_INIT)}
+};
+// clang-format on
+
+static_assert(sizeof(NameBlob) < kInlineName, "Name ids no longer fit in 16 bits");
+
+static uint16_t NameId(const char* name)
+{
+    uintptr_t offset = (uintptr_t)name - (uintptr_t)&s_Names;
+    return offset < sizeof(NameBlob) ? (uint16_t)offset : kInlineName;
+}
+
+static const char* NameString(uint16_t id)
+{
+    return (const char*)&s_Names + id;
+}
+
+// Every hooked function gets a small id, used to index per-function state.
+#define FUNC_ID(f, ...) \
+    kFunc_##f,
+
+enum FuncId
+{
+    XR_LIST_FUNCS(FUNC_ID)
+    XR_LIST_EXTRA_NAME_FUNCS(FUNC_ID)
+    kFuncCount
+};
+
+// Every enum type gets a small id, its index in the enum table, see serialize_enums.h.
+#define ENUM_TYPE_ID(enumname) \
+    kEnumType_##enumname,
+
+enum EnumTypeId
+{
+    XR_LIST_ENUM_TYPES(ENUM_TYPE_ID)
+    kEnumTypeCount
+};
+
+static_assert(kEnumType_XrResult == kResultEnumType, "Results are decoded as the first enum type");
+
+// The enum blob sent with the name table, see trace_format.h.  Defined in serialize_enums.h.
+static const std::vector<uint8_t>& EnumTable();
+
+// Every struct gets a small id, its index in the schema table, see serialize_structs.h.
+#define STRUCT_ID(s, ...) \
+    kStructId_##s,
+
+enum StructId
+{
+    XR_LIST_BASIC_STRUCTS(STRUCT_ID)
+    XR_LIST_STRUCTURE_TYPES(STRUCT_ID)
+    kStructCount
+};
+
+// The schema blob sent with the name table, see trace_format.h.  Defined in serialize_structs.h.
+static const std::vector<uint8_t>& SchemaTable();
+
+// Struct members named next hold the structure chain.
+static inline constexpr bool IsNextMember(const char* name)
+{
+    return name[0] == 'n' && name[1] == 'e' && name[2] == 'x' && name[3] == 't' && name[4] == 0;
+}
+
+#define FUNC_ID_NAME(f, ...) \
+    s_Names.f.name_,
+
+static const char* const s_FuncNames[kFuncCount] = {
+    XR_LIST_FUNCS(FUNC_ID_NAME)
+    XR_LIST_EXTRA_NAME_FUNCS(FUNC_ID_NAME)
+};
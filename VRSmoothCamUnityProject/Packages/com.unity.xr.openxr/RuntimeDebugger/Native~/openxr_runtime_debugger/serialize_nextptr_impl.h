@@ -0,0 +1,29 @@
+#pragma once
+
+template <>
+void SendToCSharp<XrBaseOutStructure*>(const char* fieldname, XrBaseOutStructure* t)
+{
+    auto* next = t;
+    do
+    {
+        StructId structId = StructIdForType(next->type);
+        if (structId != kStructCount)
+            SendStruct(s_Names.extra.next, next, structId);
+        else
+            SendToCSharp(s_Names.extra.next, next->type);
+    } while ((next = static_cast<XrBaseOutStructure*>(next->next)) != nullptr);
+}
+
+template <>
+void SendToCSharp<XrBaseInStructure const*>(const char* fieldname, XrBaseInStructure const* t)
+{
+    auto* next = t;
+    do
+    {
+        StructId structId = StructIdForType(next->type);
+        if (structId != kStructCount)
+            SendStruct(s_Names.extra.next, next, structId);
+        else
+            SendToCSharp(s_Names.extra.next, next->type);
+    } while ((next = static_cast<XrBaseInStructure const*>(next->next)) != nullptr);
+}
@@ -0,0 +1,423 @@
+#pragma once
+
+#define SEND_TO_CSHARP_BASE_STRUCT_DECL(structType) \
+    template <>                                     \
+    bool SendToCSharpBaseStructArray<structType*>(const char* fieldname, structType* t, int lenParam);
+
+#define SEND_TO_CSHARP_BASE_STRUCT_PTR_DECL(structType) \
+    template <>                                         \
+    bool SendToCSharpBaseStructArray<structType**>(const char* fieldname, structType** t, int lenParam);
+
+#define SEND_TO_CSHARP_BASE_STRUCT_CONST_PTR_DECL(structType) \
+    template <>                                               \
+    bool SendToCSharpBaseStructArray<structType const* const*>(const char* fieldname, structType const* const* t, int lenParam);
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_DECL)
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_PTR_DECL)
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_CONST_PTR_DECL)
+
+#define SEND_TO_CSHARP_STRUCT_DECL(structType) \
+    static inline void SendToCSharp(const char* fieldname, const structType& t);
+
+#define SEND_TO_CSHARP_STRUCT_PTR_DECL(structType) \
+    template <>                                    \
+    void SendToCSharp<structType*>(const char* fieldname, structType* t);
+
+#define SEND_TO_CSHARP_STRUCT_CONST_PTR(structType) \
+    template <>                                     \
+    void SendToCSharp<structType const*>(const char* fieldname, structType const* t);
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_STRUCT_DECL)
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_STRUCT_PTR_DECL)
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_STRUCT_CONST_PTR)
+
+// Structs are sent as kStruct, their schema id and their fields packed in schema order, see trace_format.h.
+// A field's kind comes from its C++ type.  Values the schema can describe are written bare, anything else goes
+// through SendToCSharp as before and is closed with kEndField.
+//
+// Nothing here is generated per struct but data: each struct gets a constexpr table of FieldDescriptors and one
+// walker reads every struct from it, here for sending and in serialize_capture.h for copying deferred calls.  Only
+// members that still go through SendToCSharp need code of their own, and that's shared by every member of the
+// same type.
+
+template <typename T>
+struct FieldEncoding
+{
+    static const uint8_t kind = kFieldDynamic;
+    static const uint32_t type = 0;
+};
+
+#define FIELD_ENCODING(cppType, fieldKind, fieldType) \
+    template <>                                       \
+    struct FieldEncoding<cppType>                     \
+    {                                                 \
+        static const uint8_t kind = fieldKind;        \
+        static const uint32_t type = fieldType;       \
+    };
+
+FIELD_ENCODING(float, kFieldFloat, 0)
+FIELD_ENCODING(int32_t, kFieldInt32, 0)
+FIELD_ENCODING(uint32_t, kFieldUInt32, 0)
+FIELD_ENCODING(int64_t, kFieldInt64, 0)
+FIELD_ENCODING(uint64_t, kFieldUInt64, 0)
+
+// Handles are pointers on 64-bit builds, whatever the OS, and plain uint64_t (already covered above) otherwise.
+#if XR_PTR_SIZE == 8
+#define FIELD_ENCODING_HANDLE(handlename)                                                \
+    static_assert(sizeof(handlename) == sizeof(uint64_t), "Handles are read as 64-bit"); \
+    FIELD_ENCODING(handlename, kFieldUInt64, 0)
+
+XR_LIST_HANDLES(FIELD_ENCODING_HANDLE)
+#endif
+
+#define FIELD_ENCODING_ENUM(enumname)                                               \
+    static_assert(sizeof(enumname) == sizeof(int32_t), "Enums are read as 32-bit"); \
+    FIELD_ENCODING(enumname, kFieldEnum, kEnumType_##enumname)
+
+XR_LIST_ENUM_TYPES(FIELD_ENCODING_ENUM)
+
+#define FIELD_ENCODING_STRUCT(structname, ...) \
+    FIELD_ENCODING(structname, kFieldStruct, kStructId_##structname)
+
+XR_LIST_BASIC_STRUCTS(FIELD_ENCODING_STRUCT)
+
+XR_LIST_STRUCTURE_TYPES(FIELD_ENCODING_STRUCT)
+
+template <size_t N>
+struct FieldEncoding<char[N]>
+{
+    static const uint8_t kind = kFieldString;
+    static const uint32_t type = 0;
+};
+
+// How a member of type T is packed.  next is true for members named next.
+template <typename T, bool next>
+struct StructField
+{
+    typedef typename std::remove_cv<T>::type Type;
+    static const bool isNext = next && std::is_pointer<Type>::value && std::is_void<typename std::remove_pointer<Type>::type>::value;
+    static const uint8_t kind = isNext ? (uint8_t)kFieldNext : FieldEncoding<Type>::kind;
+    static const uint32_t type = FieldEncoding<Type>::type;
+};
+
+template <typename T>
+struct IsListedStruct : std::integral_constant<bool, FieldEncoding<typename std::remove_cv<T>::type>::kind == kFieldStruct>
+{
+};
+
+static_assert(kStructCount <= 0xFFFF && kEnumTypeCount <= 0xFFFF, "Field types no longer fit in 16 bits");
+
+// count is the array's length for array members, 0 otherwise.
+typedef void (*SendFieldFunc)(const char* fieldname, const void* member, uint32_t count);
+typedef void (*CopyFieldFunc)(void* member, uint32_t count, CaptureArena& arena);
+
+// Only members that go through SendToCSharp have pointers here, everything else is plain data.
+struct FieldDescriptor
+{
+    // kFieldDynamic and kFieldNext members.
+    SendFieldFunc send;
+    // Members serialize_capture.h has to follow, nullptr for values it can copy as they are.
+    CopyFieldFunc copy;
+    // Name id, see NameString.
+    uint16_t name;
+    uint16_t offset;
+    // Array members: offset of the count member.  kFieldString: size of the char array.
+    uint16_t extra;
+    // Enum type or struct id.
+    uint16_t type;
+    uint8_t kind;
+    // Array members: size of the count member, 0 for everything else.
+    uint8_t countSize;
+};
+
+struct StructDescriptor
+{
+    const char* name;
+    const FieldDescriptor* fields;
+    uint32_t fieldCount;
+    uint32_t size;
+    uint32_t alignment;
+};
+
+// Members the schema can't describe, sent as SendToCSharp sends their type.
+template <typename T>
+static void SendField(const char* fieldname, const void* member, uint32_t /*count*/)
+{
+    SendToCSharp(fieldname, *(T*)member);
+}
+
+// Defined below.
+template <typename T>
+static void SendArrayField(const char* fieldname, const void* member, uint32_t count);
+
+// Defined in serialize_capture.h.
+template <typename T, bool next>
+static void CopyField(void* member, uint32_t count, CaptureArena& arena);
+template <typename T>
+static void CopyArrayField(void* member, uint32_t count, CaptureArena& arena);
+
+template <typename T, bool next>
+static constexpr SendFieldFunc FieldSender(std::true_type)
+{
+    return &SendField<T>;
+}
+
+template <typename T, bool next>
+static constexpr SendFieldFunc FieldSender(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename T, bool next>
+static constexpr CopyFieldFunc FieldCopier(std::true_type)
+{
+    return &CopyField<T, next>;
+}
+
+template <typename T, bool next>
+static constexpr CopyFieldFunc FieldCopier(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename T, bool next>
+static constexpr FieldDescriptor DescribeField(size_t name, size_t offset)
+{
+    typedef StructField<T, next> Field;
+    typedef std::integral_constant<bool, Field::kind == kFieldDynamic || Field::kind == kFieldNext> Sent;
+    // Handles are pointers too, but there's nothing behind them to copy.
+    typedef std::integral_constant<bool, Sent::value && std::is_pointer<T>::value> Copied;
+    return FieldDescriptor{FieldSender<T, next>(Sent()), FieldCopier<T, next>(Copied()), (uint16_t)name, (uint16_t)offset, (uint16_t)(Field::kind == kFieldString ? sizeof(T) : 0), (uint16_t)Field::type, Field::kind, 0};
+}
+
+template <typename T, typename Count>
+static constexpr FieldDescriptor DescribeArray(size_t name, size_t offset, size_t countOffset)
+{
+    static_assert(sizeof(Count) == sizeof(uint32_t) || sizeof(Count) == sizeof(uint64_t), "Array counts are read as 32 or 64-bit");
+    return FieldDescriptor{&SendArrayField<T>, &CopyArrayField<T>, (uint16_t)name, (uint16_t)offset, (uint16_t)countOffset, 0, kFieldDynamic, sizeof(Count)};
+}
+
+#define FIELD_DESCRIPTOR(member) \
+    DescribeField<decltype(Struct::member), IsNextMember(#member)>(namesOffset + offsetof(Names, member), offsetof(Struct, member)),
+
+#define ARRAY_DESCRIPTOR(member, lenMember) \
+    DescribeArray<decltype(Struct::member), decltype(Struct::lenMember)>(namesOffset + offsetof(Names, member), offsetof(Struct, member), offsetof(Struct, lenMember)),
+
+// Members then arrays, in the order the schema lists them.  The empty entry at the end is for structs without fields.
+#define STRUCT_FIELDS(structname, ...)                                                     \
+    struct StructFields_##structname                                                       \
+    {                                                                                      \
+        typedef structname Struct;                                                         \
+        static_assert(sizeof(Struct) <= 0xFFFF, "Field offsets no longer fit in 16 bits"); \
+        typedef decltype(s_Names.structname) Names;                                        \
+        static constexpr size_t namesOffset = offsetof(NameBlob, structname);              \
+        static constexpr FieldDescriptor fields[] = {                                      \
+            XR_LIST_STRUCT_##structname(FIELD_DESCRIPTOR)                                  \
+            XR_LIST_STRUCT_ARRAYS_##structname(ARRAY_DESCRIPTOR) FieldDescriptor{}};       \
+    };                                                                                     \
+    constexpr FieldDescriptor StructFields_##structname::fields[];
+
+XR_LIST_BASIC_STRUCTS(STRUCT_FIELDS)
+
+XR_LIST_STRUCTURE_TYPES(STRUCT_FIELDS)
+
+#define STRUCT_DESCRIPTOR(structname, ...)                        \
+    {s_Names.structname.name_, StructFields_##structname::fields, \
+        sizeof(StructFields_##structname::fields) / sizeof(FieldDescriptor) - 1, sizeof(structname), alignof(structname)},
+
+// Indexed by struct id.
+static constexpr StructDescriptor s_Structs[kStructCount] = {
+    XR_LIST_BASIC_STRUCTS(STRUCT_DESCRIPTOR)
+    XR_LIST_STRUCTURE_TYPES(STRUCT_DESCRIPTOR)
+};
+
+template <typename T>
+static T LoadField(const uint8_t* member)
+{
+    T t;
+    memcpy(&t, member, sizeof(T));
+    return t;
+}
+
+// Length of an array member, t is the struct it's in.
+static uint32_t ArrayCount(const uint8_t* t, const FieldDescriptor& field)
+{
+    if (field.countSize == sizeof(uint64_t))
+        return (uint32_t)LoadField<uint64_t>(t + field.extra);
+    return LoadField<uint32_t>(t + field.extra);
+}
+
+static void PackStructFields(const void* t, StructId structId)
+{
+    const StructDescriptor& descriptor = s_Structs[structId];
+    for (uint32_t i = 0; i < descriptor.fieldCount; ++i)
+    {
+        const FieldDescriptor& field = descriptor.fields[i];
+        const uint8_t* member = (const uint8_t*)t + field.offset;
+        switch (field.kind)
+        {
+            case kFieldFloat:
+                PackFloat(LoadField<float>(member));
+                break;
+            case kFieldInt32:
+            case kFieldEnum:
+                PackVarInt(LoadField<int32_t>(member));
+                break;
+            case kFieldUInt32:
+                PackVarUInt(LoadField<uint32_t>(member));
+                break;
+            case kFieldInt64:
+            case kFieldUInt64:
+                PackDelta(field.name, LoadField<uint64_t>(member));
+                break;
+            case kFieldString:
+                PackString((const char*)member, strnlen((const char*)member, field.extra));
+                break;
+            case kFieldStruct:
+                PackStructFields(member, (StructId)field.type);
+                break;
+            case kFieldNext:
+                if (LoadField<const void*>(member) == nullptr)
+                {
+                    PackVarUInt(0);
+                    break;
+                }
+                PackVarUInt(1);
+                field.send(NameString(field.name), member, 0);
+                EndField();
+                break;
+            default:
+                field.send(NameString(field.name), member, field.countSize != 0 ? ArrayCount((const uint8_t*)t, field) : 0);
+                EndField();
+                break;
+        }
+    }
+}
+
+static void SendStruct(const char* fieldname, const void* t, StructId structId)
+{
+    StartStruct(fieldname, structId);
+    PackStructFields(t, structId);
+}
+
+static void SendStructPointer(const char* fieldname, const void* t, StructId structId)
+{
+    if (t != nullptr)
+        SendStruct(fieldname, t, structId);
+    else
+        SendString(fieldname, "nullptr");
+}
+
+template <typename T>
+static void SendArrayElement(const char* fieldname, const T& t, std::true_type)
+{
+    SendStruct(fieldname, &t, (StructId)FieldEncoding<T>::type);
+}
+
+template <typename T>
+static void SendArrayElement(const char* fieldname, const T& t, std::false_type)
+{
+    SendToCSharp(fieldname, t);
+}
+
+// One element of an array.  Structs are sent from where they are instead of copied.
+template <typename T>
+static void SendArrayElement(const char* fieldname, const T& t)
+{
+    SendArrayElement(fieldname, t, IsListedStruct<T>());
+}
+
+template <typename T>
+static void SendArrayField(const char* fieldname, const void* member, uint32_t count)
+{
+    T array = *(T*)member;
+    if (!SendToCSharpBaseStructArray(fieldname, array, count))
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            SendArrayElement(fieldname, array[i]);
+    }
+}
+
+// Structs by value are an overload rather than a specialization of the by-value template, so they're sent from
+// where they are instead of copied.  Overload resolution prefers it over the template for a struct argument.
+#define SEND_TO_CSHARP_STRUCTS(structname, ...)                                     \
+    static inline void SendToCSharp(const char* fieldname, const structname& t)     \
+    {                                                                               \
+        SendStruct(fieldname, &t, kStructId_##structname);                          \
+    }                                                                               \
+                                                                                    \
+    template <>                                                                     \
+    void SendToCSharp<structname*>(const char* fieldname, structname* t)            \
+    {                                                                               \
+        SendStructPointer(fieldname, t, kStructId_##structname);                    \
+    }
+
+#define SEND_TO_CSHARP_STRUCTS_CONST_PTRS(structname, ...)                           \
+    template <>                                                                      \
+    void SendToCSharp<const structname*>(const char* fieldname, const structname* t) \
+    {                                                                                \
+        SendStructPointer(fieldname, t, kStructId_##structname);                     \
+    }
+
+// Basic Structs
+XR_LIST_BASIC_STRUCTS(SEND_TO_CSHARP_STRUCTS)
+
+// Full Structs
+XR_LIST_STRUCTURE_TYPES(SEND_TO_CSHARP_STRUCTS)
+
+XR_LIST_STRUCTURE_TYPES(SEND_TO_CSHARP_STRUCTS_CONST_PTRS)
+
+#define STRUCT_ID_FOR_TYPE(structname, structtype) \
+    case structtype:                               \
+        return kStructId_##structname;
+
+// The struct a structure type stands for, kStructCount for types that aren't in the reflection lists.
+static StructId StructIdForType(XrStructureType type)
+{
+    switch (type)
+    {
+        XR_LIST_STRUCTURE_TYPES(STRUCT_ID_FOR_TYPE)
+    default:
+        return kStructCount;
+    }
+}
+
+static void AppendSchemaName(std::vector<uint8_t>& table, uint16_t id)
+{
+    table.insert(table.end(), (const uint8_t*)&id, (const uint8_t*)&id + sizeof(id));
+}
+
+static void AppendSchemaVarUInt(std::vector<uint8_t>& table, uint64_t value)
+{
+    uint8_t varint[kMaxVarUInt64Size];
+    table.insert(table.end(), varint, PutVarUInt(varint, value));
+}
+
+// Built once, the first time it's sent.
+static const std::vector<uint8_t>& SchemaTable()
+{
+    static const std::vector<uint8_t> s_SchemaTable = []() {
+        std::vector<uint8_t> table;
+        for (const StructDescriptor& descriptor : s_Structs)
+        {
+            AppendSchemaName(table, NameId(descriptor.name));
+            AppendSchemaVarUInt(table, descriptor.fieldCount);
+            for (uint32_t i = 0; i < descriptor.fieldCount; ++i)
+            {
+                const FieldDescriptor& field = descriptor.fields[i];
+                AppendSchemaName(table, field.name);
+                table.push_back(field.kind);
+                if (field.kind == kFieldEnum || field.kind == kFieldStruct)
+                    AppendSchemaVarUInt(table, field.type);
+            }
+        }
+        return table;
+    }();
+    return s_SchemaTable;
+}
+
+#include "serialize_structs_base.h"
\ No newline at end of file
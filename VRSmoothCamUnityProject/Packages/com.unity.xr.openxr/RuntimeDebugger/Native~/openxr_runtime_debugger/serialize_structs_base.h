@@ -0,0 +1,133 @@
+#pragma once
+
+#define DERIVED_STRUCT_ID(typeName, typeType) \
+    case typeType:                            \
+        return kStructId_##typeName;
+
+// The struct t really is, kStructCount if its type isn't one of the types derived from its base.
+#define DERIVED_STRUCT_ID_FUNC(structType)                            \
+    static StructId DerivedStructId(const structType& t)              \
+    {                                                                 \
+        switch (t.type)                                               \
+        {                                                             \
+            XR_LIST_BASE_STRUCT_TYPES_##structType(DERIVED_STRUCT_ID) \
+        default:                                                      \
+            return kStructCount;                                      \
+        }                                                             \
+    }
+
+XR_LIST_BASE_STRUCTS(DERIVED_STRUCT_ID_FUNC)
+
+// By reference: the derived struct's fields are read from past the end of the base, a copy of the base doesn't have them.
+#define SEND_TO_CSHARP_BASE_STRUCT(structType)                                  \
+    static inline void SendToCSharp(const char* fieldname, const structType& t) \
+    {                                                                           \
+        StructId structId = DerivedStructId(t);                                 \
+        if (structId != kStructCount)                                           \
+            SendStruct(fieldname, &t, structId);                                \
+        else                                                                    \
+            SendToCSharp(fieldname, "<Unknown>");                               \
+    }
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT)
+
+#define SEND_TO_CSHARP_BASE_STRUCT_PTR(structType)                       \
+    template <>                                                          \
+    void SendToCSharp<structType*>(const char* fieldname, structType* t) \
+    {                                                                    \
+        StructId structId = DerivedStructId(*t);                         \
+        if (structId != kStructCount)                                    \
+            SendStruct(fieldname, t, structId);                          \
+        else                                                             \
+            SendToCSharp(fieldname, t->type);                            \
+    }
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_PTR)
+
+#define SEND_TO_CSHARP_BASE_STRUCT_CONST_PTR(structType)                             \
+    template <>                                                                      \
+    void SendToCSharp<structType const*>(const char* fieldname, structType const* t) \
+    {                                                                                \
+        StructId structId = DerivedStructId(*t);                                     \
+        if (structId != kStructCount)                                                \
+            SendStruct(fieldname, t, structId);                                      \
+        else                                                                         \
+            SendToCSharp(fieldname, "<Unknown>");                                    \
+    }
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_CONST_PTR)
+
+// If we serializing a base struct array such as XrSwapchainImageBaseHeader,
+// we can only loop over the array of the real type.
+
+static void SendStructArray(const char* fieldname, const void* t, StructId structId, int lenParam)
+{
+    for (int i = 0; i < lenParam; ++i)
+        SendStruct(fieldname, (const uint8_t*)t + i * s_Structs[structId].size, structId);
+}
+
+static void SendStructPointerArray(const char* fieldname, const void* const* t, StructId structId, int lenParam)
+{
+    for (int i = 0; i < lenParam; ++i)
+        SendStructPointer(fieldname, t[i], structId);
+}
+
+#define SEND_TO_CSHARP_BASE_STRUCT_ARRAY(structType)                                                  \
+    template <>                                                                                       \
+    bool SendToCSharpBaseStructArray<structType*>(const char* fieldname, structType* t, int lenParam) \
+    {                                                                                                 \
+        if (t == nullptr)                                                                             \
+        {                                                                                             \
+            SendToCSharp(fieldname, "nullptr");                                                       \
+            return true;                                                                              \
+        }                                                                                             \
+                                                                                                      \
+        StructId structId = DerivedStructId(t[0]);                                                    \
+        if (structId != kStructCount)                                                                 \
+            SendStructArray(fieldname, t, structId, lenParam);                                        \
+        else                                                                                          \
+            SendToCSharp(fieldname, "<Unknown>");                                                     \
+        return true;                                                                                  \
+    }
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_ARRAY)
+
+#define SEND_TO_CSHARP_BASE_STRUCT_ARRAY_PTR(structType)                                                \
+    template <>                                                                                         \
+    bool SendToCSharpBaseStructArray<structType**>(const char* fieldname, structType** t, int lenParam) \
+    {                                                                                                   \
+        if (t == nullptr || t[0] == nullptr)                                                            \
+        {                                                                                               \
+            SendToCSharp(fieldname, "nullptr");                                                         \
+            return true;                                                                                \
+        }                                                                                               \
+                                                                                                        \
+        StructId structId = DerivedStructId(*t[0]);                                                     \
+        if (structId != kStructCount)                                                                   \
+            SendStructPointerArray(fieldname, (const void* const*)t, structId, lenParam);               \
+        else                                                                                            \
+            SendToCSharp(fieldname, "<Unknown>");                                                       \
+        return true;                                                                                    \
+    }
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_ARRAY_PTR)
+
+#define SEND_TO_CSHARP_BASE_STRUCT_ARRAY_CONST_PTR(structType)                                                                  \
+    template <>                                                                                                                 \
+    bool SendToCSharpBaseStructArray<structType const* const*>(const char* fieldname, structType const* const* t, int lenParam) \
+    {                                                                                                                           \
+        if (t == nullptr || t[0] == nullptr)                                                                                    \
+        {                                                                                                                       \
+            SendToCSharp(fieldname, "nullptr");                                                                                 \
+            return true;                                                                                                        \
+        }                                                                                                                       \
+                                                                                                                                \
+        StructId structId = DerivedStructId(*t[0]);                                                                             \
+        if (structId != kStructCount)                                                                                           \
+            SendStructPointerArray(fieldname, (const void* const*)t, structId, lenParam);                                       \
+        else                                                                                                                    \
+            SendToCSharp(fieldname, "<Unknown>");                                                                               \
+        return true;                                                                                                            \
+    }
+
+XR_LIST_BASE_STRUCTS(SEND_TO_CSHARP_BASE_STRUCT_ARRAY_CONST_PTR)
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+
+// Calls too large for the per-thread record buffer (long enumerations, visibility masks) carry on in a spill block
+// instead of being cut short to a kCacheNotLargeEnough.  The finished block goes through the thread's queue as a
+// SpillRef, so it stays in order with the thread's other calls, and DrainThreadQueues copies it into the main store
+// and frees it.  Blocks come from malloc in kSpillBlockSize steps and only live from the call that spilled until
+// the next drain.  Together they are held under s_SpillBudget, a call that would go over is dropped as before.
+
+static const uint32_t kSpillBlockSize = 64 * 1024;
+static const uint32_t kDefaultSpillBudget = 4 * 1024 * 1024;
+
+// Set from c# in HookXrInstanceProcAddr.
+static uint32_t s_SpillBudget = kDefaultSpillBudget;
+
+// Bytes in spill blocks that haven't been drained yet.
+static std::atomic<uint64_t> s_SpillBytes{0};
+
+// Calls that reached a queue through a spill block, and calls that didn't: over budget, larger than the main store
+// or no room in the queue for the SpillRef.
+static std::atomic<uint64_t> s_SpilledRecords{0};
+static std::atomic<uint64_t> s_SpillDroppedRecords{0};
+
+// A queue record starting with this byte is a SpillRef, no command uses it.
+static const uint8_t kSpillRefTag = 0xFF;
+
+struct SpillRef
+{
+    uint8_t tag;
+    uint8_t* data;
+    uint32_t size;
+    uint32_t capacity;
+};
+
+static bool GrowIntoSpill(RecordWriter& record, size_t size)
+{
+    // Would never fit the main store, don't bother.
+    uint64_t needed = (uint64_t)(record.pos - record.base) + size;
+    if (needed > s_CacheSize)
+    {
+        s_SpillDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // At least double, so a call made of many small fields only copies itself a few times.
+    uint64_t capacity = std::max<uint64_t>(needed, (uint64_t)record.capacity * 2);
+    capacity = (capacity + kSpillBlockSize - 1) / kSpillBlockSize * kSpillBlockSize;
+    if (s_SpillBytes.fetch_add(capacity, std::memory_order_relaxed) + capacity > s_SpillBudget)
+    {
+        s_SpillBytes.fetch_sub(capacity, std::memory_order_relaxed);
+        s_SpillDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint8_t* block = (uint8_t*)malloc((size_t)capacity);
+    if (block == nullptr)
+    {
+        s_SpillBytes.fetch_sub(capacity, std::memory_order_relaxed);
+        s_SpillDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    TrackMemory((int64_t)capacity);
+
+    uint32_t used = record.Size();
+    memcpy(block, record.base, used);
+    if (record.Spilled())
+        FreeSpillBlock(record.base, record.capacity);
+
+    record.base = block;
+    record.capacity = (uint32_t)capacity;
+    record.pos = block + used;
+    record.end = block + capacity;
+    return true;
+}
+
+static void FreeSpillBlock(uint8_t* block, uint32_t capacity)
+{
+    free(block);
+    s_SpillBytes.fetch_sub(capacity, std::memory_order_relaxed);
+    TrackMemory(-(int64_t)capacity);
+}
+
+// Hands the record's spill block to the queue, the drainer frees it.
+static bool PublishSpilledRecord(CallStream* stream)
+{
+    RecordWriter& record = stream->record;
+    SpillRef spill;
+    memset(&spill, 0, sizeof(spill));
+    spill.tag = kSpillRefTag;
+    spill.data = record.base;
+    spill.size = record.Size();
+    spill.capacity = record.capacity;
+
+    if (!stream->queue.TryReserve(sizeof(spill)))
+    {
+        // Same as PublishRecord, only the formatter thread drains while it runs.
+        if (!DeferringCalls())
+            TryDrainThreadQueues();
+        else
+            RequestDrain();
+        if (!stream->queue.TryReserve(sizeof(spill)))
+        {
+            s_SpillDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    stream->queue.Write((const uint8_t*)&spill, sizeof(spill));
+    stream->queue.Publish();
+    record.DetachSpill();
+    s_SpilledRecords.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Must be called with s_DataMutex held, from DrainThreadQueues.  Returns false if the record isn't a SpillRef.
+static bool DrainSpilledRecord(CallStream* stream, const uint8_t* first, uint32_t firstSize, const uint8_t* second, uint32_t secondSize)
+{
+    if (firstSize + secondSize != sizeof(SpillRef) || first[0] != kSpillRefTag)
+        return false;
+
+    // The queue may have split it at the wrap point.
+    SpillRef spill;
+    memcpy(&spill, first, firstSize);
+    memcpy((uint8_t*)&spill + firstSize, second, secondSize);
+
+    DrainRecord(stream, spill.data, spill.size, spill.data + spill.size, 0);
+    FreeSpillBlock(spill.data, spill.capacity);
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_WIN32)
+// std::min and std::max are used after this, keep windows.h from defining them as macros.
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Enough for the 15 characters linux allows plus the terminator.
+static const uint32_t kMaxThreadNameLength = 16;
+
+// Called once per thread, when it first makes a call, so none of this needs to be fast.
+static uint64_t GetOSThreadId()
+{
+#if defined(_WIN32)
+    return (uint64_t)GetCurrentThreadId();
+#else
+    return (uint64_t)syscall(SYS_gettid);
+#endif
+}
+
+static void GetOSThreadName(char (&name)[kMaxThreadNameLength])
+{
+    memset(name, 0, sizeof(name));
+#if !defined(_WIN32)
+    prctl(PR_GET_NAME, name, 0, 0, 0);
+    name[kMaxThreadNameLength - 1] = 0;
+#endif
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Lock-free single-producer / single-consumer queue of finished call records.
+// The owning thread is the only producer, whoever holds s_DataMutex is the only consumer.
+// Records are framed with a 4 byte size header and padded to 4 bytes so a header never splits at the wrap point.
+// Nothing here blocks: if a record doesn't fit, TryReserve fails and the producer decides what to drop.
+struct ThreadQueue
+{
+    uint8_t* data;
+    uint32_t capacity;
+    // The record size Create or TryResize was last given.
+    uint32_t recordSize;
+
+    // Positions grow forever and wrap at 2^32, capacity is a power of two so masking still works after the wrap.
+    std::atomic<uint32_t> head;
+    uint32_t cachedTail;
+    uint32_t writePos;
+
+    // Keep the consumer's index off the producer's cache line.
+    uint8_t padding[64];
+
+    std::atomic<uint32_t> tail;
+
+    // Records that didn't fit and were never published.
+    std::atomic<uint32_t> droppedRecords;
+
+    // Room for a record of minSize bytes, rounded up to a power of two.
+    static uint32_t CapacityFor(uint32_t minSize)
+    {
+        uint32_t size = 64;
+        while (size < minSize + 8)
+            size <<= 1;
+        return size;
+    }
+
+    void Create(uint32_t minSize)
+    {
+        recordSize = minSize;
+        capacity = CapacityFor(minSize);
+        data = (uint8_t*)malloc(capacity);
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        droppedRecords.store(0, std::memory_order_relaxed);
+        cachedTail = 0;
+        writePos = 0;
+    }
+
+    void Destroy()
+    {
+        free(data);
+        data = nullptr;
+        capacity = 0;
+    }
+
+    // Producer: make room for records of minSize bytes instead, once the consumer has taken everything so it never
+    // touches the old buffer again.  Positions carry on, the capacity is still a power of two.
+    // Returns how many bytes the queue grew by, 0 if it's still waiting for the consumer or didn't change.
+    int64_t TryResize(uint32_t minSize)
+    {
+        if (head.load(std::memory_order_relaxed) != tail.load(std::memory_order_acquire))
+            return 0;
+        recordSize = minSize;
+        uint32_t newCapacity = CapacityFor(minSize);
+        if (newCapacity == capacity)
+            return 0;
+        int64_t growth = (int64_t)newCapacity - (int64_t)capacity;
+        free(data);
+        data = (uint8_t*)malloc(newCapacity);
+        capacity = newCapacity;
+        return growth;
+    }
+
+    static uint32_t FramedSize(uint32_t size)
+    {
+        return sizeof(uint32_t) + ((size + 3) & ~3u);
+    }
+
+    // Producer: make room for a record of size bytes.
+    bool TryReserve(uint32_t size)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t needed = FramedSize(size);
+        if (needed > capacity)
+            return false;
+
+        if (h - cachedTail + needed > capacity)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail + needed > capacity)
+                return false;
+        }
+
+        writePos = h + sizeof(uint32_t);
+        return true;
+    }
+
+    // Producer: append bytes to the reserved record.
+    void Write(const uint8_t* src, uint32_t size)
+    {
+        uint32_t offset = writePos & (capacity - 1);
+        uint32_t first = capacity - offset < size ? capacity - offset : size;
+        memcpy(&data[offset], src, first);
+        memcpy(data, src + first, size - first);
+        writePos += size;
+    }
+
+    // Producer: make the reserved record visible to the consumer.
+    void Publish()
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t size = writePos - h - sizeof(uint32_t);
+        *(uint32_t*)&data[h & (capacity - 1)] = size;
+        head.store(h + FramedSize(size), std::memory_order_release);
+    }
+
+    uint32_t UsedBytes() const
+    {
+        return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed);
+    }
+
+    // Consumer: hand published records to onRecord(first, firstSize, second, secondSize) in order.  Stops early if
+    // onRecord returns false, that record stays in the queue for the next drain.
+    // A record that wraps comes out as two spans, otherwise the second span is empty.
+    template <typename OnRecord>
+    void Drain(OnRecord&& onRecord)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+
+        while (t != h)
+        {
+            uint32_t size = *(uint32_t*)&data[t & (capacity - 1)];
+            uint32_t offset = (t + sizeof(uint32_t)) & (capacity - 1);
+            uint32_t first = capacity - offset < size ? capacity - offset : size;
+            if (!onRecord(&data[offset], first, data, size - first))
+                break;
+            t += FramedSize(size);
+        }
+
+        tail.store(t, std::memory_order_release);
+    }
+};
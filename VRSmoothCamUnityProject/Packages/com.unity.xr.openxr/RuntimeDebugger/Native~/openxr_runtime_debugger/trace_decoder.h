@@ -0,0 +1,874 @@
+#pragma once
+
+// Decoder for the debugger command stream (trace_format.h), for checking the encoding and reading trace files
+// without the editor.  Doesn't depend on the OpenXR headers or anything else in the runtime debugger.
+// Strings are handed to the visitor as StringSpans into the buffer being decoded or the decoder's own tables, so
+// decoding a call doesn't copy or allocate.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "trace_format.h"
+
+// A string the decoder didn't copy.  Only valid until the callback it was passed to returns.
+struct StringSpan
+{
+    const char* data = "";
+    size_t size = 0;
+
+    StringSpan() = default;
+
+    StringSpan(const char* data, size_t size) :
+        data(data), size(size)
+    {
+    }
+
+    std::string ToString() const
+    {
+        return std::string(data, size);
+    }
+
+    bool operator==(StringSpan other) const
+    {
+        return size == other.size && memcmp(data, other.data, size) == 0;
+    }
+
+    bool operator==(const char* other) const
+    {
+        return strncmp(data, other, size) == 0 && other[size] == 0;
+    }
+
+    bool operator!=(StringSpan other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator!=(const char* other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// A kFrameSummary, see frame_stats.h.  Display times are XrTime, the others nanoseconds since the start of the session.
+struct FrameSummary
+{
+    struct FunctionTime
+    {
+        std::string funcName;
+        uint64_t calls;
+        uint64_t duration;
+    };
+
+    uint32_t frame;
+    int64_t predictedDisplayTime;
+    uint64_t predictedDisplayPeriod;
+    int64_t submittedDisplayTime;
+    uint64_t waitStart;
+    uint64_t waitDuration;
+    uint64_t beginStart;
+    uint64_t endStart;
+    uint64_t endDuration;
+    std::vector<FunctionTime> functions;
+};
+
+// A kOverheadReport, see overhead_stats.h.  Times are nanoseconds added up over every thread for the frame.
+struct OverheadReport
+{
+    uint32_t frame;
+    uint64_t budget;
+    uint64_t calls;
+    uint64_t runtimeTime;
+    // Includes drainTime and lockWaitTime.
+    uint64_t overhead;
+    uint64_t drainTime;
+    uint64_t lockWaitTime;
+};
+
+// Gets every command in stream order, the fields of packed structs one by one.  Struct nesting is given by
+// OnStartStruct / OnEndStruct.
+// The decoder is a template on the visitor's type, so a visitor declared final has its callbacks called directly
+// rather than through the vtable, and the empty ones inlined away.
+struct TraceVisitor
+{
+    virtual ~TraceVisitor() = default;
+
+    virtual void OnThreadInfo(uint32_t /*threadIndex*/, uint64_t /*osThreadId*/, StringSpan /*threadName*/) {}
+    virtual void OnStartFunctionCall(uint32_t /*threadIndex*/, StringSpan /*funcName*/) {}
+    virtual void OnStartStruct(StringSpan /*fieldName*/, StringSpan /*structName*/) {}
+    virtual void OnFloat(StringSpan /*fieldName*/, float /*value*/) {}
+    virtual void OnString(StringSpan /*fieldName*/, StringSpan /*value*/) {}
+    virtual void OnInt(StringSpan /*fieldName*/, int64_t /*value*/) {}
+    virtual void OnUInt(StringSpan /*fieldName*/, uint64_t /*value*/) {}
+    // valueName is the value as a number if it isn't in the enum table.
+    virtual void OnEnum(StringSpan /*fieldName*/, StringSpan /*typeName*/, int32_t /*value*/, StringSpan /*valueName*/) {}
+    // A delta encoded value whose base was lost, see trace_format.h.
+    virtual void OnLostValue(StringSpan /*fieldName*/) {}
+    virtual void OnEndStruct() {}
+    // The call's values so far were its inputs, the ones up to OnEndFunctionCall are its outputs.  Only calls recorded
+    // with their inputs have it, see recorded_inputs.h.
+    virtual void OnCallOutputs() {}
+    // startTimeKnown is false when the call's start time and frame were delta encoded against a lost call.
+    virtual void OnEndFunctionCall(StringSpan /*result*/, bool /*startTimeKnown*/, uint64_t /*startTime*/, uint64_t /*duration*/, uint32_t /*frame*/) {}
+    virtual void OnCacheNotLargeEnough(uint32_t /*threadIndex*/, StringSpan /*funcName*/, StringSpan /*result*/, uint64_t /*startTime*/, uint64_t /*duration*/, uint32_t /*frame*/) {}
+    virtual void OnDroppedData(uint64_t /*calls*/, uint64_t /*bytes*/) {}
+    virtual void OnFrameSummary(const FrameSummary& /*summary*/) {}
+    virtual void OnOverheadReport(const OverheadReport& /*report*/) {}
+};
+
+class TraceDecoder
+{
+public:
+    // Decodes one buffer of whole commands.  Names, threads and delta state carry over to the next call,
+    // so consecutive reads from the same session can be passed in one at a time.
+    // Returns false on malformed input, see Error().
+    template <typename Visitor>
+    bool Decode(const uint8_t* data, size_t size, Visitor& visitor)
+    {
+        size_t decoded = 0;
+        return DecodeSome(data, size, size, visitor, decoded);
+    }
+
+    // Like Decode, but stops at the first command boundary at least limit bytes in and sets decoded to where it
+    // stopped, so a large buffer can be decoded a piece at a time.
+    template <typename Visitor>
+    bool DecodeSome(const uint8_t* data, size_t size, size_t limit, Visitor& visitor, size_t& decoded)
+    {
+        pos = data;
+        end = data + size;
+        error.clear();
+
+        const uint8_t* stop = data + (limit < size ? limit : size);
+        bool result = true;
+        while (pos < stop)
+        {
+            uint8_t command = 0;
+            if (!ReadFixed(command) || !DecodeCommand((Command)command, visitor))
+            {
+                result = false;
+                break;
+            }
+        }
+        decoded = (size_t)(pos - data);
+        return result;
+    }
+
+    // Checks a trace file written by file_sink.h and finds its command stream, which ends at the last complete record.
+    // Each file starts from scratch, Reset() before decoding it.
+    bool ReadFileHeader(const uint8_t* data, size_t size, size_t& dataOffset, size_t& dataSize)
+    {
+        TraceFileHeader header;
+        if (size < sizeof(header))
+            return Fail("file too small for a header");
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, kTraceFileMagic, sizeof(header.magic)) != 0)
+            return Fail("not a trace file");
+        if (header.version != kTraceFileVersion)
+            return Fail("unsupported trace file version");
+        if (header.headerSize > size || header.dataSize > size - header.headerSize)
+            return Fail("header data size past the end of the file");
+
+        dataOffset = header.headerSize;
+        dataSize = (size_t)header.dataSize;
+        return true;
+    }
+
+    // Decodes a trace file written by file_sink.h, up to the last complete record.
+    template <typename Visitor>
+    bool DecodeFile(const uint8_t* data, size_t size, Visitor& visitor)
+    {
+        size_t dataOffset = 0, dataSize = 0;
+        if (!ReadFileHeader(data, size, dataOffset, dataSize))
+            return false;
+
+        Reset();
+        return Decode(data + dataOffset, dataSize, visitor);
+    }
+
+    void Reset()
+    {
+        names.clear();
+        nameSizes.clear();
+        enumBlob.clear();
+        enumTypes.clear();
+        structs.clear();
+        threads.clear();
+        currentThread = nullptr;
+    }
+
+    const std::string& Error() const
+    {
+        return error;
+    }
+
+private:
+    // The last value looked up for an enum type or field, and its name.  Values mostly repeat from call to call, so
+    // this saves the hash lookup.  Only ever holds names from the enum table.
+    struct EnumCache
+    {
+        int32_t value = 0;
+        StringSpan name;
+        bool valid = false;
+    };
+
+    // Names point into enumBlob.
+    struct EnumType
+    {
+        StringSpan name;
+        std::unordered_map<int32_t, StringSpan> values;
+        EnumCache last;
+    };
+
+    struct SchemaField
+    {
+        uint16_t nameId;
+        FieldKind kind;
+        // Enum type or struct id.
+        uint32_t type;
+        // Looked up when the schema comes in, the name table always comes before it.  Unknown names are looked up
+        // every time instead, they're only in the scratch ring.
+        StringSpan name;
+        bool named;
+        uint32_t deltaSlot;
+        // Enum fields only, cleared when a new enum table comes in.
+        EnumCache lastEnum;
+    };
+
+    struct StructSchema
+    {
+        uint16_t nameId;
+        std::vector<SchemaField> fields;
+    };
+
+    // Deeper than any OpenXR struct, stops malformed schemas from recursing forever.
+    static const uint32_t kMaxStructDepth = 64;
+
+    struct ThreadState
+    {
+        uint64_t values[kDeltaSlots] = {};
+        uint64_t startTime = 0;
+        uint32_t frame = 0;
+        uint16_t sequence = 0;
+        bool valid = false;
+    };
+
+    template <typename Visitor>
+    bool DecodeCommand(Command command, Visitor& visitor)
+    {
+        switch (command)
+        {
+            case kStartFunctionCall:
+            case kStartKeyframeCall:
+            {
+                uint64_t threadIndex = 0;
+                uint16_t sequence = 0;
+                StringSpan funcName;
+                if (!ReadVarUInt(threadIndex) || !ReadFixed(sequence) || !ReadName(funcName))
+                    return false;
+
+                if (!GrowThreads(threadIndex))
+                    return false;
+                ThreadState& thread = threads[(size_t)threadIndex];
+                if (command == kStartKeyframeCall)
+                {
+                    thread = ThreadState();
+                    thread.valid = true;
+                }
+                else if ((uint16_t)(sequence - thread.sequence) != 1)
+                {
+                    thread.valid = false;
+                }
+                thread.sequence = sequence;
+                currentThread = &thread;
+
+                visitor.OnStartFunctionCall((uint32_t)threadIndex, funcName);
+                return true;
+            }
+            case kStartStruct:
+            {
+                StringSpan fieldName, structName;
+                if (!ReadName(fieldName) || !ReadName(structName))
+                    return false;
+                visitor.OnStartStruct(fieldName, structName);
+                return true;
+            }
+            case kFloat:
+            {
+                StringSpan fieldName;
+                float value = 0;
+                if (!ReadName(fieldName) || !ReadFixed(value))
+                    return false;
+                visitor.OnFloat(fieldName, value);
+                return true;
+            }
+            case kString:
+            {
+                StringSpan fieldName, value;
+                if (!ReadName(fieldName) || !ReadString(value))
+                    return false;
+                visitor.OnString(fieldName, value);
+                return true;
+            }
+            case kInt32:
+            case kUInt32:
+            {
+                StringSpan fieldName;
+                uint64_t value = 0;
+                if (!ReadName(fieldName) || !ReadVarUInt(value))
+                    return false;
+                if (command == kInt32)
+                    visitor.OnInt(fieldName, ZigZagDecode(value));
+                else
+                    visitor.OnUInt(fieldName, value);
+                return true;
+            }
+            case kInt64:
+            case kUInt64:
+            {
+                StringSpan fieldName;
+                uint16_t nameId = 0;
+                uint64_t delta = 0;
+                if (!ReadName(fieldName, &nameId) || !ReadVarUInt(delta))
+                    return false;
+                if (currentThread == nullptr)
+                    return Fail("value outside of a function call");
+
+                uint64_t& last = currentThread->values[DeltaSlot(nameId)];
+                last += (uint64_t)ZigZagDecode(delta);
+                if (!currentThread->valid)
+                    visitor.OnLostValue(fieldName);
+                else if (command == kInt64)
+                    visitor.OnInt(fieldName, (int64_t)last);
+                else
+                    visitor.OnUInt(fieldName, last);
+                return true;
+            }
+            case kEnum:
+            {
+                StringSpan fieldName;
+                uint64_t enumType = 0, value = 0;
+                if (!ReadName(fieldName) || !ReadVarUInt(enumType) || !ReadVarUInt(value))
+                    return false;
+                int32_t enumValue = (int32_t)ZigZagDecode(value);
+                visitor.OnEnum(fieldName, EnumTypeName(enumType), enumValue, EnumName(enumType, enumValue));
+                return true;
+            }
+            case kStruct:
+            {
+                StringSpan fieldName;
+                uint64_t structId = 0;
+                if (!ReadName(fieldName) || !ReadVarUInt(structId))
+                    return false;
+                return DecodeStruct(fieldName, structId, 0, visitor);
+            }
+            case kEndStruct:
+                visitor.OnEndStruct();
+                return true;
+            case kEndField:
+                return Fail("kEndField outside of a struct field");
+            case kEndFunctionCall:
+            {
+                StringSpan result;
+                uint64_t startDelta = 0, duration = 0, frameDelta = 0;
+                if (!ReadResult(result) || !ReadVarUInt(startDelta) || !ReadVarUInt(duration) || !ReadVarUInt(frameDelta))
+                    return false;
+                if (currentThread == nullptr)
+                    return Fail("kEndFunctionCall outside of a function call");
+
+                currentThread->startTime += startDelta;
+                currentThread->frame += (uint32_t)frameDelta;
+                visitor.OnEndFunctionCall(result, currentThread->valid, currentThread->startTime, duration, currentThread->frame);
+                currentThread = nullptr;
+                return true;
+            }
+            case kCallOutputs:
+                if (currentThread == nullptr)
+                    return Fail("kCallOutputs outside of a function call");
+                visitor.OnCallOutputs();
+                return true;
+            case kCacheNotLargeEnough:
+            {
+                uint64_t threadIndex = 0, startTime = 0, duration = 0, frame = 0;
+                StringSpan funcName, result;
+                if (!ReadVarUInt(threadIndex) || !ReadName(funcName) || !ReadResult(result) || !ReadVarUInt(startTime) || !ReadVarUInt(duration) || !ReadVarUInt(frame))
+                    return false;
+
+                // The writer's slots moved on without this call's values, its next call is a keyframe.
+                if (!GrowThreads(threadIndex))
+                    return false;
+                threads[(size_t)threadIndex].valid = false;
+                visitor.OnCacheNotLargeEnough((uint32_t)threadIndex, funcName, result, startTime, duration, (uint32_t)frame);
+                return true;
+            }
+            case kNameTable:
+            {
+                uint32_t size = 0;
+                if (!ReadFixed(size) || size > (size_t)(end - pos))
+                    return Fail("truncated name table");
+
+                // Name ids are offsets into the blob, so it's kept as is, NUL-terminated even if the last name isn't.
+                Reset();
+                names.assign((const char*)pos, (const char*)pos + size);
+                names.push_back(0);
+                nameSizes.resize(names.size());
+                nameSizes.back() = 0;
+                for (size_t i = names.size() - 1; i-- > 0;)
+                    nameSizes[i] = names[i] != 0 ? nameSizes[i + 1] + 1 : 0;
+                pos += size;
+                return true;
+            }
+            case kEnumTable:
+            {
+                uint32_t size = 0;
+                if (!ReadFixed(size) || size > (size_t)(end - pos))
+                    return Fail("truncated enum table");
+
+                // Decoded from a copy, which the enum names point into.
+                enumBlob.assign(pos, pos + size);
+                pos += size;
+                const uint8_t* dataPos = pos;
+                const uint8_t* dataEnd = end;
+                pos = enumBlob.data();
+                end = pos + size;
+                for (StructSchema& schema : structs)
+                {
+                    for (SchemaField& field : schema.fields)
+                        field.lastEnum = EnumCache();
+                }
+                bool read = ReadEnumTypes();
+                pos = dataPos;
+                end = dataEnd;
+                return read;
+            }
+            case kSchemaTable:
+            {
+                uint32_t size = 0;
+                if (!ReadFixed(size) || size > (size_t)(end - pos))
+                    return Fail("truncated schema table");
+
+                const uint8_t* tableEnd = pos + size;
+                const uint8_t* dataEnd = end;
+                end = tableEnd;
+                structs.clear();
+                while (pos < end)
+                {
+                    uint64_t count = 0;
+                    StructSchema schema;
+                    if (!ReadFixed(schema.nameId) || !ReadVarUInt(count))
+                        return false;
+                    for (uint64_t i = 0; i < count; ++i)
+                    {
+                        SchemaField field = {};
+                        uint8_t kind = 0;
+                        uint64_t type = 0;
+                        if (!ReadFixed(field.nameId) || !ReadFixed(kind))
+                            return false;
+                        if (kind > kFieldNext)
+                            return Fail("unknown field kind " + std::to_string((int)kind));
+                        field.kind = (FieldKind)kind;
+                        if ((kind == kFieldEnum || kind == kFieldStruct) && !ReadVarUInt(type))
+                            return false;
+                        field.type = (uint32_t)type;
+                        field.named = field.nameId < names.size();
+                        if (field.named)
+                            field.name = NameString(field.nameId);
+                        field.deltaSlot = DeltaSlot(field.nameId);
+                        schema.fields.push_back(field);
+                    }
+                    structs.push_back(std::move(schema));
+                }
+                end = dataEnd;
+                return true;
+            }
+            case kThreadInfo:
+            {
+                uint32_t threadIndex = 0;
+                uint64_t osThreadId = 0;
+                StringSpan threadName;
+                if (!ReadFixed(threadIndex) || !ReadFixed(osThreadId) || !ReadString(threadName))
+                    return false;
+                visitor.OnThreadInfo(threadIndex, osThreadId, threadName);
+                return true;
+            }
+            case kDroppedData:
+            {
+                uint64_t calls = 0, bytes = 0;
+                if (!ReadFixed(calls) || !ReadFixed(bytes))
+                    return false;
+                visitor.OnDroppedData(calls, bytes);
+                return true;
+            }
+            case kFrameSummary:
+            {
+                // Reused, so its function names keep their capacity from frame to frame.
+                FrameSummary& summary = frameSummary;
+                uint64_t frame = 0, predictedDisplayTime = 0, submittedOffset = 0, functionCount = 0;
+                if (!ReadVarUInt(frame) || !ReadVarUInt(predictedDisplayTime) || !ReadVarUInt(summary.predictedDisplayPeriod) ||
+                    !ReadVarUInt(submittedOffset) || !ReadVarUInt(summary.waitStart) || !ReadVarUInt(summary.waitDuration) ||
+                    !ReadVarUInt(summary.beginStart) || !ReadVarUInt(summary.endStart) || !ReadVarUInt(summary.endDuration) ||
+                    !ReadVarUInt(functionCount))
+                    return false;
+                if (functionCount > (size_t)(end - pos))
+                    return Fail("truncated frame summary");
+
+                summary.frame = (uint32_t)frame;
+                summary.predictedDisplayTime = ZigZagDecode(predictedDisplayTime);
+                summary.submittedDisplayTime = summary.predictedDisplayTime + ZigZagDecode(submittedOffset);
+                summary.functions.resize((size_t)functionCount);
+                for (FrameSummary::FunctionTime& function : summary.functions)
+                {
+                    StringSpan funcName;
+                    if (!ReadName(funcName) || !ReadVarUInt(function.calls) || !ReadVarUInt(function.duration))
+                        return false;
+                    function.funcName.assign(funcName.data, funcName.size);
+                }
+                visitor.OnFrameSummary(summary);
+                return true;
+            }
+            case kOverheadReport:
+            {
+                OverheadReport report;
+                uint64_t frame = 0;
+                if (!ReadVarUInt(frame) || !ReadVarUInt(report.budget) || !ReadVarUInt(report.calls) || !ReadVarUInt(report.runtimeTime) ||
+                    !ReadVarUInt(report.overhead) || !ReadVarUInt(report.drainTime) || !ReadVarUInt(report.lockWaitTime))
+                    return false;
+                report.frame = (uint32_t)frame;
+                visitor.OnOverheadReport(report);
+                return true;
+            }
+            default:
+                return Fail("unknown command " + std::to_string((int)command));
+        }
+    }
+
+    bool ReadEnumTypes()
+    {
+        enumTypes.clear();
+        while (pos < end)
+        {
+            uint64_t count = 0;
+            EnumType type;
+            if (!ReadVarUInt(count) || !ReadString(type.name))
+                return false;
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                uint64_t value = 0;
+                StringSpan name;
+                if (!ReadVarUInt(value) || !ReadString(name))
+                    return false;
+                type.values[(int32_t)ZigZagDecode(value)] = name;
+            }
+            enumTypes.push_back(std::move(type));
+        }
+        return true;
+    }
+
+    // A kStruct's fields, as OnStartStruct, a callback per field and OnEndStruct.
+    // Fields are decoded in the loop rather than through a function per field: that call was a good part of the
+    // cost of a struct made of floats.
+    template <typename Visitor>
+    bool DecodeStruct(StringSpan fieldName, uint64_t structId, uint32_t depth, Visitor& visitor)
+    {
+        if (structId >= structs.size())
+            return Fail("unknown struct " + std::to_string(structId));
+        if (depth > kMaxStructDepth)
+            return Fail("structs nested too deep");
+
+        StructSchema& schema = structs[(size_t)structId];
+        visitor.OnStartStruct(fieldName, NameString(schema.nameId));
+        for (SchemaField& field : schema.fields)
+        {
+            StringSpan name = field.named ? field.name : NameString(field.nameId);
+            switch (field.kind)
+            {
+                case kFieldFloat:
+                {
+                    float value = 0;
+                    if (!ReadFixed(value))
+                        return false;
+                    visitor.OnFloat(name, value);
+                    break;
+                }
+                case kFieldInt32:
+                case kFieldUInt32:
+                {
+                    uint64_t value = 0;
+                    if (!ReadVarUInt(value))
+                        return false;
+                    if (field.kind == kFieldInt32)
+                        visitor.OnInt(name, ZigZagDecode(value));
+                    else
+                        visitor.OnUInt(name, value);
+                    break;
+                }
+                case kFieldInt64:
+                case kFieldUInt64:
+                {
+                    uint64_t delta = 0;
+                    if (!ReadVarUInt(delta))
+                        return false;
+                    if (currentThread == nullptr)
+                        return Fail("value outside of a function call");
+
+                    uint64_t& last = currentThread->values[field.deltaSlot];
+                    last += (uint64_t)ZigZagDecode(delta);
+                    if (!currentThread->valid)
+                        visitor.OnLostValue(name);
+                    else if (field.kind == kFieldInt64)
+                        visitor.OnInt(name, (int64_t)last);
+                    else
+                        visitor.OnUInt(name, last);
+                    break;
+                }
+                case kFieldEnum:
+                {
+                    uint64_t value = 0;
+                    if (!ReadVarUInt(value))
+                        return false;
+                    int32_t enumValue = (int32_t)ZigZagDecode(value);
+                    visitor.OnEnum(name, EnumTypeName(field.type), enumValue, EnumName(field.type, enumValue, field.lastEnum));
+                    break;
+                }
+                case kFieldString:
+                {
+                    StringSpan value;
+                    if (!ReadString(value))
+                        return false;
+                    visitor.OnString(name, value);
+                    break;
+                }
+                case kFieldStruct:
+                    if (!DecodeStruct(name, field.type, depth + 1, visitor))
+                        return false;
+                    break;
+                case kFieldNext:
+                {
+                    uint8_t present = 0;
+                    if (!ReadFixed(present))
+                        return false;
+                    // An empty chain shows as the null pointer, the way other pointers are sent.
+                    if (present == 0)
+                        visitor.OnUInt(name, 0);
+                    else if (!DecodeDynamicField(visitor))
+                        return false;
+                    break;
+                }
+                case kFieldDynamic:
+                    if (!DecodeDynamicField(visitor))
+                        return false;
+                    break;
+                default:
+                    return Fail("unknown field kind");
+            }
+        }
+        visitor.OnEndStruct();
+        return true;
+    }
+
+    // Commands up to the kEndField that closes the field.
+    template <typename Visitor>
+    bool DecodeDynamicField(Visitor& visitor)
+    {
+        while (true)
+        {
+            uint8_t command = 0;
+            if (!ReadFixed(command))
+                return false;
+            if (command == kEndField)
+                return true;
+            if (!DecodeCommand((Command)command, visitor))
+                return false;
+        }
+    }
+
+    bool Fail(const std::string& message)
+    {
+        error = message;
+        return false;
+    }
+
+    // Doesn't build a std::string at every call site.
+    bool Fail(const char* message)
+    {
+        error = message;
+        return false;
+    }
+
+    template <typename T>
+    bool ReadFixed(T& value)
+    {
+        if ((size_t)(end - pos) < sizeof(T))
+            return Fail("truncated value");
+        memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool ReadVarUInt(uint64_t& value)
+    {
+        // Most values fit in a byte, the rest are kept out of line so this one inlines.
+        if (pos < end && *pos < 0x80)
+        {
+            value = *pos++;
+            return true;
+        }
+        return ReadLongVarUInt(value);
+    }
+
+    bool ReadLongVarUInt(uint64_t& value)
+    {
+        // Far enough from the end for the longest varint, so only the continuation bits need checking.
+        if ((size_t)(end - pos) >= kMaxVarIntSize)
+        {
+            const uint8_t* p = pos;
+            uint64_t result = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7)
+            {
+                uint8_t b = *p++;
+                result |= (uint64_t)(b & 0x7F) << shift;
+                if ((b & 0x80) == 0)
+                {
+                    value = result;
+                    pos = p;
+                    return true;
+                }
+            }
+            return Fail("varint too long");
+        }
+
+        value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            if (pos >= end)
+                return Fail("truncated varint");
+            uint8_t b = *pos++;
+            value |= (uint64_t)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                return true;
+        }
+        return Fail("varint too long");
+    }
+
+    bool ReadString(StringSpan& value)
+    {
+        const uint8_t* terminator = (const uint8_t*)memchr(pos, 0, end - pos);
+        if (terminator == nullptr)
+            return Fail("unterminated string");
+        value = StringSpan((const char*)pos, terminator - pos);
+        pos = terminator + 1;
+        return true;
+    }
+
+    // For names and values that aren't in the tables, in a small ring so a callback can get a few of them at once.
+    StringSpan Scratch(const char* format, uint64_t value)
+    {
+        char* text = scratch[nextScratch++ % kScratchCount];
+        int size = snprintf(text, kScratchSize, format, (long long)value);
+        return StringSpan(text, size > 0 ? (size_t)size : 0);
+    }
+
+    StringSpan EnumTypeName(uint64_t enumType)
+    {
+        return enumType < enumTypes.size() ? enumTypes[(size_t)enumType].name : Scratch("<enum %lld>", enumType);
+    }
+
+    StringSpan EnumName(uint64_t enumType, int32_t value, EnumCache& cache)
+    {
+        if (cache.valid && cache.value == value)
+            return cache.name;
+        if (enumType < enumTypes.size())
+        {
+            const EnumType& type = enumTypes[(size_t)enumType];
+            auto it = type.values.find(value);
+            if (it != type.values.end())
+            {
+                cache.value = value;
+                cache.name = it->second;
+                cache.valid = true;
+                return it->second;
+            }
+        }
+        return Scratch("%lld", (uint64_t)(int64_t)value);
+    }
+
+    StringSpan EnumName(uint64_t enumType, int32_t value)
+    {
+        if (enumType >= enumTypes.size())
+            return Scratch("%lld", (uint64_t)(int64_t)value);
+        return EnumName(enumType, value, enumTypes[(size_t)enumType].last);
+    }
+
+    bool ReadResult(StringSpan& result)
+    {
+        uint64_t value = 0;
+        if (!ReadVarUInt(value))
+            return false;
+        result = EnumName(kResultEnumType, (int32_t)ZigZagDecode(value));
+        return true;
+    }
+
+    bool ReadName(StringSpan& name, uint16_t* nameId = nullptr)
+    {
+        uint16_t id = 0;
+        if (!ReadFixed(id))
+            return false;
+        if (nameId != nullptr)
+            *nameId = id;
+        if (id == kInlineName)
+            return ReadString(name);
+
+        name = NameString(id);
+        return true;
+    }
+
+    StringSpan NameString(uint16_t id)
+    {
+        if (id >= names.size())
+            return Scratch("<name %lld>", id);
+        return StringSpan(names.data() + id, nameSizes[id]);
+    }
+
+    // Far more threads than any app has, stops a malformed index from allocating without bound.
+    static const uint64_t kMaxThreads = 1 << 16;
+
+    // Makes room for threadIndex.  The current call's thread may move, so only called between calls.
+    bool GrowThreads(uint64_t threadIndex)
+    {
+        if (threadIndex >= kMaxThreads)
+            return Fail("thread index " + std::to_string(threadIndex) + " out of range");
+        if (threadIndex >= threads.size())
+            threads.resize((size_t)threadIndex + 1);
+        currentThread = nullptr;
+        return true;
+    }
+
+    // Bytes in the longest varint, 64 bits at 7 a byte.
+    static const size_t kMaxVarIntSize = 10;
+
+    static const uint32_t kScratchCount = 4;
+    static const uint32_t kScratchSize = 32;
+
+    const uint8_t* pos = nullptr;
+    const uint8_t* end = nullptr;
+    std::string error;
+
+    // The name table as sent, a name's id is its offset.
+    std::vector<char> names;
+    std::vector<uint8_t> enumBlob;
+    // Indexed by enum type.
+    std::vector<EnumType> enumTypes;
+    // Indexed by struct id.
+    std::vector<StructSchema> structs;
+    // Length of the name starting at each offset of names.
+    std::vector<uint32_t> nameSizes;
+    // Indexed by thread index, which the writer keeps compact.
+    std::vector<ThreadState> threads;
+    // Thread of the function call being decoded.
+    ThreadState* currentThread = nullptr;
+    FrameSummary frameSummary;
+
+    char scratch[kScratchCount][kScratchSize];
+    uint32_t nextScratch = 0;
+};
@@ -0,0 +1,177 @@
+#pragma once
+
+// Writes a decoded command stream as Chrome trace event JSON, which chrome://tracing, Perfetto
+// (ui.perfetto.dev, trace_processor) and most other trace viewers load.  Like trace_decoder.h it doesn't depend on
+// the OpenXR headers.
+//
+// Every captured call is a complete ("X") event on its thread's track, with its result, frame and arguments as args.
+// Structs become nested objects, repeated array elements get their index appended to the field name.  Frame
+// summaries are events on a track of their own, spanning the frame's xrWaitFrame to the end of its xrEndFrame.
+// Dropped data shows as a global instant event.
+//
+// Events are written as they're decoded: the writer only holds the call being decoded and the threads it has named,
+// so its memory doesn't grow with the capture.  Calls whose start time was lost to a gap (see trace_format.h) have
+// nothing to place them on the timeline and are skipped, see LostCalls().
+
+#include <stdio.h>
+#include <string>
+#include <unordered_set>
+
+#include "trace_json.h"
+
+class ChromeTraceWriter final : public JsonArgsWriter
+{
+public:
+    // Everything is written to out, which the caller keeps open until Finish().
+    explicit ChromeTraceWriter(FILE* out) :
+        out(out)
+    {
+        fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", out);
+        line = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"OpenXR runtime debugger\"}}";
+        WriteLine();
+        line = "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(kFrameTrack) + ",\"args\":{\"name\":\"Frames\"}}";
+        WriteLine();
+        line = "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(kFrameTrack) + ",\"args\":{\"sort_index\":-1}}";
+        WriteLine();
+    }
+
+    // Closes the JSON.  Returns false if anything failed to write.
+    bool Finish()
+    {
+        fputs("\n]}\n", out);
+        return fflush(out) == 0 && !ferror(out);
+    }
+
+    uint64_t LostCalls() const
+    {
+        return lostCalls;
+    }
+
+    void OnThreadInfo(uint32_t threadIndex, uint64_t osThreadId, StringSpan threadName) override
+    {
+        // Every trace file names its threads again.
+        if (!namedThreads.insert(threadIndex).second)
+            return;
+
+        line = "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(threadIndex) + ",\"args\":{\"name\":";
+        AppendJsonString(line, threadName.size == 0 ? "thread " + std::to_string(osThreadId) : threadName.ToString() + " (" + std::to_string(osThreadId) + ")");
+        line += "}}";
+        WriteLine();
+    }
+
+    void OnStartFunctionCall(uint32_t threadIndex, StringSpan funcName) override
+    {
+        JsonArgsWriter::OnStartFunctionCall(threadIndex, funcName);
+        callThread = threadIndex;
+        callName.assign(funcName.data, funcName.size);
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool startTimeKnown, uint64_t startTime, uint64_t duration, uint32_t frame) override
+    {
+        if (!startTimeKnown)
+        {
+            ++lostCalls;
+            return;
+        }
+
+        CloseArgs();
+        WriteCall(callThread, StringSpan(callName.data(), callName.size()), result, startTime, duration, frame, false);
+    }
+
+    void OnCacheNotLargeEnough(uint32_t threadIndex, StringSpan funcName, StringSpan result, uint64_t startTime, uint64_t duration, uint32_t frame) override
+    {
+        args.clear();
+        WriteCall(threadIndex, funcName, result, startTime, duration, frame, true);
+    }
+
+    void OnDroppedData(uint64_t calls, uint64_t bytes) override
+    {
+        line = "{\"name\":\"Dropped data\",\"cat\":\"debugger\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":";
+        AppendJsonMicroseconds(line, lastTime);
+        line += ",\"args\":{\"calls\":";
+        AppendJsonUInt(line, calls);
+        line += ",\"bytes\":";
+        AppendJsonUInt(line, bytes);
+        line += "}}";
+        WriteLine();
+    }
+
+    void OnFrameSummary(const FrameSummary& summary) override
+    {
+        // A frame whose xrWaitFrame or xrBeginFrame wasn't captured starts at the first one that was.
+        uint64_t start = summary.waitStart != 0 ? summary.waitStart : summary.beginStart != 0 ? summary.beginStart : summary.endStart;
+        start = start < summary.endStart ? start : summary.endStart;
+        uint64_t end = summary.endStart + summary.endDuration;
+
+        line = "{\"name\":\"Frame " + std::to_string(summary.frame) + "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(kFrameTrack) + ",\"ts\":";
+        AppendJsonMicroseconds(line, start);
+        line += ",\"dur\":";
+        AppendJsonMicroseconds(line, end - start);
+        line += ",\"args\":";
+        AppendFrameSummary(line, summary);
+        line += '}';
+        WriteLine();
+        lastTime = end > lastTime ? end : lastTime;
+    }
+
+    // Marked at the end of its frame, which its kFrameSummary just moved lastTime to.
+    void OnOverheadReport(const OverheadReport& report) override
+    {
+        line = "{\"name\":\"Debugger over budget\",\"cat\":\"debugger\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" + std::to_string(kFrameTrack) + ",\"ts\":";
+        AppendJsonMicroseconds(line, lastTime);
+        line += ",\"args\":";
+        AppendOverheadReport(line, report);
+        line += '}';
+        WriteLine();
+    }
+
+private:
+    // Above any thread index the runtime debugger hands out.
+    static const uint32_t kFrameTrack = 0x7FFFFFFF;
+
+    void WriteCall(uint32_t threadIndex, StringSpan funcName, StringSpan result, uint64_t startTime, uint64_t duration, uint32_t frame, bool cacheNotLargeEnough)
+    {
+        line = "{\"name\":";
+        AppendJsonString(line, funcName);
+        line += ",\"cat\":\"openxr\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(threadIndex) + ",\"ts\":";
+        AppendJsonMicroseconds(line, startTime);
+        line += ",\"dur\":";
+        AppendJsonMicroseconds(line, duration);
+        line += ",\"args\":{\"result\":";
+        AppendJsonString(line, result);
+        line += ",\"frame\":" + std::to_string(frame);
+        if (cacheNotLargeEnough)
+            line += ",\"cacheNotLargeEnough\":true";
+        if (!args.empty())
+        {
+            line += ',';
+            line += args;
+        }
+        line += "}}";
+        WriteLine();
+        uint64_t end = startTime + duration;
+        lastTime = end > lastTime ? end : lastTime;
+    }
+
+    void WriteLine()
+    {
+        if (!firstEvent)
+            fputs(",\n", out);
+        firstEvent = false;
+        fwrite(line.data(), 1, line.size(), out);
+    }
+
+    FILE* out;
+    bool firstEvent = true;
+    // The event being written, reused so its capacity carries over.
+    std::string line;
+
+    // The call being decoded.
+    uint32_t callThread = 0;
+    std::string callName;
+
+    std::unordered_set<uint32_t> namedThreads;
+    // End of the latest event, where dropped data is placed.
+    uint64_t lastTime = 0;
+    uint64_t lostCalls = 0;
+};
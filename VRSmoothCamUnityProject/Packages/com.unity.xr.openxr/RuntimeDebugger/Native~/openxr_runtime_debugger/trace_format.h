@@ -0,0 +1,166 @@
+#pragma once
+
+#include <stdint.h>
+
+// Wire format of the debugger command stream, shared by the runtime debugger and trace_decoder.h.
+// Keep DebuggerState.cs in sync with any change here.
+//
+// Every command is a one byte tag.  Integers are LEB128, signed ones zigzag encoded first.
+// 64-bit values (XrTime, XrDuration, handles, flags) and call start times are sent as the difference from the
+// previous value in the same delta slot of the same thread, slots being picked from the field's name id.
+// A call's frame index is sent the same way, against the thread's previous call.
+// A call starting with kStartKeyframeCall resets the thread's slots to zero, so its values are absolute.
+// Calls carry a 16-bit per-thread sequence number: after a gap (overwritten or dropped calls) a decoder can't
+// resolve deltas for that thread until its next keyframe, which the writer sends at least every kKeyframeInterval calls.
+//
+//  kStartFunctionCall / kStartKeyframeCall  varuint thread index, u16 sequence, name
+//  kStartStruct                             legacy, decode only: name (field), name (struct)
+//  kFloat                                   name, f32
+//  kString                                  name, NUL-terminated string
+//  kInt32                                   name, zigzag varint
+//  kUInt32                                  name, varuint
+//  kInt64 / kUInt64                         name, zigzag varint delta
+//  kEnum                                    name, varuint enum type, zigzag varint value
+//  kStruct                                  name (field), varuint struct id, the struct's fields packed as its schema says
+//  kEndField                                ends a kFieldDynamic field
+//  kEndStruct                               legacy, decode only: ends a kStartStruct
+//  kEndFunctionCall                         zigzag varint result, varuint start time delta, varuint duration, varuint frame delta
+//  kCacheNotLargeEnough                     varuint thread index, name, zigzag varint result, varuint start time, varuint duration,
+//                                           varuint frame
+//  kNameTable                               u32 size, name blob
+//  kEnumTable                               u32 size, enum blob
+//  kSchemaTable                             u32 size, schema blob
+//  kThreadInfo                              u32 thread index, u64 os thread id, NUL-terminated thread name
+//  kDroppedData                             u64 calls, u64 bytes overwritten in the main store since the last read
+//  kFrameSummary                            varuint frame, zigzag varint predicted display time, varuint predicted display period,
+//                                           zigzag varint submitted display time - predicted display time,
+//                                           varuint xrWaitFrame start, varuint xrWaitFrame duration, varuint xrBeginFrame start,
+//                                           varuint xrEndFrame start, varuint xrEndFrame duration,
+//                                           varuint function count, then for each function: name, varuint calls, varuint duration
+//  kCallOutputs                             the call's values so far were its inputs, the rest are its outputs
+//  kOverheadReport                          varuint frame, varuint budget, varuint calls, varuint runtime time,
+//                                           varuint overhead, varuint drain time, varuint lock wait time
+//
+// A name is a u16 id into the name table, or kInlineName followed by a NUL-terminated string.
+// Enum values and call results are sent as numbers.  An enum type is its index in the enum table, results are of type
+// kResultEnumType.  The enum blob has every enum type in order, each as a varuint value count and its NUL-terminated
+// name followed by that many values, each a zigzag varint and its NUL-terminated name.  Values that aren't in the
+// table are still valid.
+// Structs are described once by the schema blob, every struct in id order: u16 struct name, varuint field count, then
+// for each field its u16 name, its u8 FieldKind and, for kFieldEnum and kFieldStruct, a varuint enum type or struct id.
+// A kStruct's fields follow it without names or tags, each encoded as its kind says.  The writer no longer sends
+// kStartStruct/kEndStruct, which named every field; they're kept so older captures still decode.
+// Calls recorded with their inputs send every argument twice: as the app passed it, then kCallOutputs, then as the
+// runtime left it, see recorded_inputs.h.  Calls without kCallOutputs only have the latter.
+// Frames are counted by xrEndFrame, a call belongs to the frame the next xrEndFrame ends, see frame_stats.h.
+// A kOverheadReport follows the kFrameSummary of a frame in which the debugger's own time in the hooks, added up over
+// every thread, went over the budget set with SetOverheadBudget, see overhead_stats.h.  Overhead includes the drain
+// and lock wait times.
+// Display times are the runtime's XrTime.  Other times are nanoseconds since the start of the capture session, the
+// function durations are each function's total time in the runtime during the frame.
+// Fixed width values are little endian.
+enum Command : uint8_t
+{
+    kStartFunctionCall,
+    kStartStruct,  // Legacy, decode only.
+
+    kFloat,
+    kString,
+    kInt32,
+    kInt64,
+    kUInt32,
+    kUInt64,
+
+    kEndStruct,  // Legacy, decode only.
+    kEndFunctionCall,
+
+    kCacheNotLargeEnough,
+
+    kNameTable,
+    kThreadInfo,
+
+    kStartKeyframeCall,
+
+    kDroppedData,
+
+    kEnum,
+    kEnumTable,
+
+    kStruct,
+    kEndField,
+    kSchemaTable,
+
+    kFrameSummary,
+
+    kCallOutputs,
+
+    kOverheadReport,
+
+    kEndData = 0xFF
+};
+
+static_assert(sizeof(Command) == 1, "Commands are one byte on the wire");
+
+// Written in place of an id, followed by the name as a string, for names that didn't come from s_Names.
+static const uint16_t kInlineName = 0xFFFF;
+
+// How a struct field is packed after kStruct.
+enum FieldKind : uint8_t
+{
+    // Any commands, then kEndField.  Pointers, arrays and anything else the schema can't describe.
+    kFieldDynamic,
+    // f32
+    kFieldFloat,
+    // zigzag varint
+    kFieldInt32,
+    // varuint
+    kFieldUInt32,
+    // zigzag varint delta, like kInt64 / kUInt64 with the field's name
+    kFieldInt64,
+    kFieldUInt64,
+    // zigzag varint
+    kFieldEnum,
+    // NUL-terminated string
+    kFieldString,
+    // the nested struct's fields, packed the same way
+    kFieldStruct,
+    // u8 0 for nullptr, otherwise u8 1 then the chain as commands and kEndField
+    kFieldNext,
+};
+
+// XrResult is the first type in the enum table.
+static const uint32_t kResultEnumType = 0;
+
+static const uint32_t kDeltaSlots = 64;
+static const uint32_t kKeyframeInterval = 32;
+
+// Fibonacci hash of the name id down to 6 bits.
+static inline uint32_t DeltaSlot(uint16_t nameId)
+{
+    return (uint32_t)(nameId * 2654435761u) >> 26;
+}
+
+static inline uint64_t ZigZagEncode(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t ZigZagDecode(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+// Trace files from file_sink.h: this header, then the command stream.
+static const char kTraceFileMagic[8] = {'O', 'X', 'R', 'T', 'R', 'A', 'C', 'E'};
+static const uint32_t kTraceFileVersion = 7;
+
+struct TraceFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    // Rotation index, starting at 1.
+    uint64_t sequence;
+    // Bytes of complete records after the header.
+    uint64_t dataSize;
+};
@@ -0,0 +1,310 @@
+#pragma once
+
+// JSON for decoded calls, shared by trace_export_chrome.h and the trace tools.
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "trace_decoder.h"
+
+static void AppendJsonString(std::string& s, StringSpan value)
+{
+    s += '"';
+    // Appends runs of characters that don't need escaping in one go.
+    size_t run = 0;
+    for (size_t i = 0; i < value.size; ++i)
+    {
+        char c = value.data[i];
+        if (c != '"' && c != '\\' && (unsigned char)c >= 0x20)
+            continue;
+
+        s.append(value.data + run, i - run);
+        run = i + 1;
+        if (c == '"' || c == '\\')
+        {
+            s += '\\';
+            s += c;
+        }
+        else
+        {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)c);
+            s += escaped;
+        }
+    }
+    s.append(value.data + run, value.size - run);
+    s += '"';
+}
+
+static void AppendJsonString(std::string& s, const char* value)
+{
+    AppendJsonString(s, StringSpan(value, strlen(value)));
+}
+
+static void AppendJsonString(std::string& s, const std::string& value)
+{
+    AppendJsonString(s, StringSpan(value.data(), value.size()));
+}
+
+// Without snprintf, which dominates writing large captures.
+static void AppendDecimal(std::string& s, uint64_t value)
+{
+    char text[20];
+    char* p = text + sizeof(text);
+    do
+    {
+        *--p = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    s.append(p, text + sizeof(text) - p);
+}
+
+static void AppendJsonInt(std::string& s, int64_t value)
+{
+    if (value < 0)
+    {
+        s += '-';
+        AppendDecimal(s, 0 - (uint64_t)value);
+        return;
+    }
+    AppendDecimal(s, (uint64_t)value);
+}
+
+// JSON readers take numbers as doubles, handles and other values past 2^53 are written as hex strings instead.
+static void AppendJsonUInt(std::string& s, uint64_t value)
+{
+    if (value <= (1ull << 53))
+    {
+        AppendDecimal(s, value);
+        return;
+    }
+    char text[24];
+    snprintf(text, sizeof(text), "\"0x%llx\"", (unsigned long long)value);
+    s += text;
+}
+
+// Enough digits to read back the same float.  Whole numbers, common in poses and extents, skip snprintf.
+static void AppendFloat(std::string& s, float value)
+{
+    if (value == (float)(int32_t)value && value > -16777216.0f && value < 16777216.0f)
+    {
+        AppendJsonInt(s, (int32_t)value);
+        return;
+    }
+    char text[32];
+    snprintf(text, sizeof(text), "%.9g", value);
+    s += text;
+}
+
+// Nanoseconds as microseconds, the unit of trace event times.
+static void AppendJsonMicroseconds(std::string& s, uint64_t nanoseconds)
+{
+    AppendDecimal(s, nanoseconds / 1000);
+    uint32_t fraction = (uint32_t)(nanoseconds % 1000);
+    char text[4] = {'.', (char)('0' + fraction / 100), (char)('0' + fraction / 10 % 10), (char)('0' + fraction % 10)};
+    s.append(text, sizeof(text));
+}
+
+// A kFrameSummary as a JSON object, durations in microseconds.
+static void AppendFrameSummary(std::string& s, const FrameSummary& summary)
+{
+    s += "{\"frame\":";
+    AppendJsonUInt(s, summary.frame);
+    s += ",\"predictedDisplayTime\":";
+    AppendJsonInt(s, summary.predictedDisplayTime);
+    s += ",\"predictedDisplayPeriod\":";
+    AppendJsonUInt(s, summary.predictedDisplayPeriod);
+    s += ",\"submittedDisplayTime\":";
+    AppendJsonInt(s, summary.submittedDisplayTime);
+    s += ",\"waitStartUs\":";
+    AppendJsonMicroseconds(s, summary.waitStart);
+    s += ",\"waitDurationUs\":";
+    AppendJsonMicroseconds(s, summary.waitDuration);
+    s += ",\"beginStartUs\":";
+    AppendJsonMicroseconds(s, summary.beginStart);
+    s += ",\"endStartUs\":";
+    AppendJsonMicroseconds(s, summary.endStart);
+    s += ",\"endDurationUs\":";
+    AppendJsonMicroseconds(s, summary.endDuration);
+    s += ",\"functions\":{";
+    for (size_t i = 0; i < summary.functions.size(); ++i)
+    {
+        const FrameSummary::FunctionTime& function = summary.functions[i];
+        if (i != 0)
+            s += ',';
+        AppendJsonString(s, function.funcName);
+        s += ":{\"calls\":";
+        AppendJsonUInt(s, function.calls);
+        s += ",\"durationUs\":";
+        AppendJsonMicroseconds(s, function.duration);
+        s += '}';
+    }
+    s += "}}";
+}
+
+// A kOverheadReport as a JSON object, times in microseconds.
+static void AppendOverheadReport(std::string& s, const OverheadReport& report)
+{
+    s += "{\"frame\":";
+    AppendJsonUInt(s, report.frame);
+    s += ",\"budgetUs\":";
+    AppendJsonMicroseconds(s, report.budget);
+    s += ",\"calls\":";
+    AppendJsonUInt(s, report.calls);
+    s += ",\"runtimeUs\":";
+    AppendJsonMicroseconds(s, report.runtimeTime);
+    s += ",\"overheadUs\":";
+    AppendJsonMicroseconds(s, report.overhead);
+    s += ",\"drainUs\":";
+    AppendJsonMicroseconds(s, report.drainTime);
+    s += ",\"lockWaitUs\":";
+    AppendJsonMicroseconds(s, report.lockWaitTime);
+    s += '}';
+}
+
+// Collects the arguments of the call being decoded as the members of a JSON object, without the braces.
+// Structs become nested objects, repeated array elements get their index appended to the field name.
+class JsonArgsWriter : public TraceVisitor
+{
+public:
+    void OnStartFunctionCall(uint32_t /*threadIndex*/, StringSpan /*funcName*/) override
+    {
+        args.clear();
+        depth = 0;
+        Level& level = Top();
+        level.empty = true;
+        level.lastKey.clear();
+    }
+
+    void OnStartStruct(StringSpan fieldName, StringSpan /*structName*/) override
+    {
+        Key(fieldName);
+        args += '{';
+        ++depth;
+        Level& level = Top();
+        level.empty = true;
+        level.lastKey.clear();
+    }
+
+    void OnEndStruct() override
+    {
+        // Unbalanced input stays valid JSON.
+        if (depth == 0)
+            return;
+        args += '}';
+        --depth;
+    }
+
+    void OnFloat(StringSpan fieldName, float value) override
+    {
+        Key(fieldName);
+        if (isfinite(value))
+        {
+            AppendFloat(args, value);
+        }
+        else
+        {
+            // JSON has no NaN or infinity.
+            AppendJsonString(args, isnan(value) ? "nan" : value > 0 ? "inf" : "-inf");
+        }
+    }
+
+    void OnString(StringSpan fieldName, StringSpan value) override
+    {
+        Key(fieldName);
+        AppendJsonString(args, value);
+    }
+
+    void OnInt(StringSpan fieldName, int64_t value) override
+    {
+        Key(fieldName);
+        AppendJsonInt(args, value);
+    }
+
+    void OnUInt(StringSpan fieldName, uint64_t value) override
+    {
+        Key(fieldName);
+        AppendJsonUInt(args, value);
+    }
+
+    void OnEnum(StringSpan fieldName, StringSpan /*typeName*/, int32_t /*value*/, StringSpan valueName) override
+    {
+        Key(fieldName);
+        AppendJsonString(args, valueName);
+    }
+
+    void OnLostValue(StringSpan fieldName) override
+    {
+        Key(fieldName);
+        AppendJsonString(args, "<lost>");
+    }
+
+    // A call recorded with its inputs has them in an "inputs" object, its outputs stay where a call's arguments are.
+    void OnCallOutputs() override
+    {
+        CloseArgs();
+        args.insert(0, "\"inputs\":{");
+        args += '}';
+        Level& level = Top();
+        level.empty = false;
+        level.lastKey = "inputs";
+        level.repeats = 0;
+    }
+
+protected:
+    // Closes any structs left open.
+    void CloseArgs()
+    {
+        while (depth != 0)
+            OnEndStruct();
+    }
+
+    // Reused from call to call so their capacity carries over.
+    std::string args;
+
+private:
+    // An object being written into args.
+    struct Level
+    {
+        bool empty = true;
+        // Array elements are sent one after the other under the same field name.
+        std::string lastKey;
+        uint32_t repeats = 0;
+    };
+
+    Level& Top()
+    {
+        if (depth >= levels.size())
+            levels.resize(depth + 1);
+        return levels[depth];
+    }
+
+    void Key(StringSpan fieldName)
+    {
+        Level& level = Top();
+        if (!level.empty)
+            args += ',';
+        level.empty = false;
+
+        if (fieldName == StringSpan(level.lastKey.data(), level.lastKey.size()))
+        {
+            AppendJsonString(args, fieldName);
+            args.pop_back();
+            args += '[';
+            args += std::to_string(++level.repeats);
+            args += "]\":";
+            return;
+        }
+
+        level.lastKey.assign(fieldName.data, fieldName.size);
+        level.repeats = 0;
+        AppendJsonString(args, fieldName);
+        args += ':';
+    }
+
+    std::vector<Level> levels;
+    size_t depth = 0;
+};
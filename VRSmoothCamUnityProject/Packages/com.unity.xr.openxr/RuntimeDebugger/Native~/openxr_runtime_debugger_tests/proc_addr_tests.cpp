@@ -0,0 +1,123 @@
+// Tests and benchmark for the xrGetInstanceProcAddr lookup table (openxr_runtime_debugger/proc_addr_table.h).
+// Checks that every hooked function is found with the hook the old strcmp chain returned, and that other names
+// aren't, then times both.  Builds the whole runtime debugger, for example:
+//   g++ -std=c++14 -O2 -I<OpenXR-SDK>/include -pthread proc_addr_tests.cpp -o proc_addr_tests && ./proc_addr_tests
+// Returns non-zero if a test fails.  Pass --no-bench to skip the benchmark.
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "../openxr_runtime_debugger/runtime_debugger.cpp"
+
+static int s_Failures = 0;
+
+// Not assert, so the checks still run in optimized builds.
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++s_Failures;                                                         \
+        }                                                                         \
+    } while (0)
+
+// What xrGetInstanceProcAddr did before the table, one strcmp per hooked function.
+#define PROC_ADDR_CHAIN(f, ...) \
+    if (strcmp(#f, name) == 0)  \
+        return (PFN_xrVoidFunction)&f;
+
+static PFN_xrVoidFunction FindProcAddrChain(const char* name)
+{
+    XR_LIST_FUNCS(PROC_ADDR_CHAIN)
+    SPECIALIZED_FUNCS(PROC_ADDR_CHAIN)
+    return nullptr;
+}
+
+static PFN_xrVoidFunction FindProcAddrTable(const char* name)
+{
+    const ProcAddrEntry* entry = FindProcAddr(name);
+    return entry != nullptr ? entry->hook : nullptr;
+}
+
+// Every hooked name plus a few that aren't, copied so neither lookup can compare string addresses.
+static std::vector<std::vector<char>> QueryNames()
+{
+    static const char* kMisses[] = {"xrNotAFunction", "xrCreateInstanc", "xrCreateInstanceX", "", "xrGetInstanceProcAddr"};
+
+    std::vector<std::vector<char>> names;
+    for (const char* name : kProcAddrNames)
+        names.emplace_back(name, name + strlen(name) + 1);
+    for (const char* name : kMisses)
+        names.emplace_back(name, name + strlen(name) + 1);
+    return names;
+}
+
+static void CheckLookups()
+{
+    for (uint32_t i = 0; i < kProcAddrCount; ++i)
+    {
+        const ProcAddrEntry* entry = FindProcAddr(kProcAddrNames[i]);
+        CHECK(entry != nullptr);
+        if (entry != nullptr)
+            CHECK(strcmp(entry->name, kProcAddrNames[i]) == 0);
+    }
+
+    uint32_t misses = 0;
+    for (const auto& name : QueryNames())
+    {
+        PFN_xrVoidFunction hook = FindProcAddrTable(name.data());
+        CHECK(hook == FindProcAddrChain(name.data()));
+        if (hook == nullptr)
+            ++misses;
+    }
+    CHECK(misses == 5);
+    CHECK(FindProcAddr(nullptr) == nullptr);
+
+    printf("lookups      %u names, %u slots, longest probe %u\n", kProcAddrCount, kProcAddrTableSize, s_ProcAddrTable.maxProbes);
+}
+
+template <typename Find>
+static double TimeLookups(Find find, const std::vector<std::vector<char>>& names)
+{
+    const uint32_t kReps = 20000;
+    uintptr_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t rep = 0; rep < kReps; ++rep)
+    {
+        for (const auto& name : names)
+            sum += (uintptr_t)find(name.data());
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Keeps the lookups from being optimized away.
+    if (sum == 1)
+        printf("\n");
+    return seconds * 1e9 / (kReps * names.size());
+}
+
+static void Benchmark()
+{
+    auto names = QueryNames();
+    for (int run = 0; run < 3; ++run)
+        printf("benchmark    strcmp chain %6.1f ns/lookup, table %6.1f ns/lookup\n", TimeLookups(FindProcAddrChain, names), TimeLookups(FindProcAddrTable, names));
+}
+
+int main(int argc, char** argv)
+{
+    bool bench = argc < 2 || strcmp(argv[1], "--no-bench") != 0;
+
+    CheckLookups();
+    if (bench)
+        Benchmark();
+
+    if (s_Failures != 0)
+    {
+        printf("%d checks failed\n", s_Failures);
+        return 1;
+    }
+    printf("all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,147 @@
+// Records replay_smoke.oxrt, the capture the trace_replay smoke test replays: the runtime debugger with SetRecordInputs
+// on, in front of the fake runtime of replay_fake_runtime.h, from xrCreateInstance to xrDestroyInstance.
+// Run it again whenever the trace file version changes, for example:
+//   g++ -std=c++14 -O2 -I<OpenXR-SDK>/include -pthread replay_capture.cpp -o replay_capture
+//   ./replay_capture <directory> && mv <directory>/openxr_trace_*.oxrt replay_smoke.oxrt
+// Returns non-zero if a call fails or the trace file can't be written.
+
+#include <stdio.h>
+
+#include "../openxr_runtime_debugger/runtime_debugger.cpp"
+#include "replay_fake_runtime.h"
+
+static const uint32_t kFrames = 3;
+
+template <typename T>
+static T Resolve(PFN_xrGetInstanceProcAddr getInstanceProcAddr, XrInstance instance, const char* name)
+{
+    PFN_xrVoidFunction function = nullptr;
+    getInstanceProcAddr(instance, name, &function);
+    return (T)function;
+}
+
+static bool Succeeded(XrResult result, const char* call)
+{
+    if (XR_SUCCEEDED(result))
+        return true;
+    fprintf(stderr, "%s failed with %d\n", call, (int)result);
+    return false;
+}
+
+#define CHECK_XR(call)                 \
+    do                                 \
+    {                                  \
+        if (!Succeeded((call), #call)) \
+            return false;              \
+    } while (0)
+
+static bool RunSession(PFN_xrGetInstanceProcAddr getInstanceProcAddr)
+{
+    auto createInstance = Resolve<PFN_xrCreateInstance>(getInstanceProcAddr, XR_NULL_HANDLE, "xrCreateInstance");
+    XrInstanceCreateInfo instanceInfo{};
+    instanceInfo.type = XR_TYPE_INSTANCE_CREATE_INFO;
+    strcpy(instanceInfo.applicationInfo.applicationName, "replay smoke test");
+    instanceInfo.applicationInfo.apiVersion = XR_CURRENT_API_VERSION;
+    XrInstance instance = XR_NULL_HANDLE;
+    CHECK_XR(createInstance(&instanceInfo, &instance));
+
+    auto getSystem = Resolve<PFN_xrGetSystem>(getInstanceProcAddr, instance, "xrGetSystem");
+    auto createSession = Resolve<PFN_xrCreateSession>(getInstanceProcAddr, instance, "xrCreateSession");
+    auto beginSession = Resolve<PFN_xrBeginSession>(getInstanceProcAddr, instance, "xrBeginSession");
+    auto createReferenceSpace = Resolve<PFN_xrCreateReferenceSpace>(getInstanceProcAddr, instance, "xrCreateReferenceSpace");
+    auto waitFrame = Resolve<PFN_xrWaitFrame>(getInstanceProcAddr, instance, "xrWaitFrame");
+    auto beginFrame = Resolve<PFN_xrBeginFrame>(getInstanceProcAddr, instance, "xrBeginFrame");
+    auto locateSpace = Resolve<PFN_xrLocateSpace>(getInstanceProcAddr, instance, "xrLocateSpace");
+    auto locateViews = Resolve<PFN_xrLocateViews>(getInstanceProcAddr, instance, "xrLocateViews");
+    auto endFrame = Resolve<PFN_xrEndFrame>(getInstanceProcAddr, instance, "xrEndFrame");
+    auto endSession = Resolve<PFN_xrEndSession>(getInstanceProcAddr, instance, "xrEndSession");
+    auto destroySpace = Resolve<PFN_xrDestroySpace>(getInstanceProcAddr, instance, "xrDestroySpace");
+    auto destroySession = Resolve<PFN_xrDestroySession>(getInstanceProcAddr, instance, "xrDestroySession");
+    auto destroyInstance = Resolve<PFN_xrDestroyInstance>(getInstanceProcAddr, instance, "xrDestroyInstance");
+
+    XrSystemGetInfo systemInfo{XR_TYPE_SYSTEM_GET_INFO, nullptr, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY};
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    CHECK_XR(getSystem(instance, &systemInfo, &systemId));
+
+    XrSessionCreateInfo sessionInfo{XR_TYPE_SESSION_CREATE_INFO, nullptr, 0, systemId};
+    XrSession session = XR_NULL_HANDLE;
+    CHECK_XR(createSession(instance, &sessionInfo, &session));
+
+    XrSessionBeginInfo beginInfo{XR_TYPE_SESSION_BEGIN_INFO, nullptr, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO};
+    CHECK_XR(beginSession(session, &beginInfo));
+
+    XrReferenceSpaceCreateInfo spaceInfo{XR_TYPE_REFERENCE_SPACE_CREATE_INFO, nullptr, XR_REFERENCE_SPACE_TYPE_LOCAL, {{0, 0, 0, 1}, {0, 0, 0}}};
+    XrSpace local = XR_NULL_HANDLE;
+    CHECK_XR(createReferenceSpace(session, &spaceInfo, &local));
+    spaceInfo.referenceSpaceType = XR_REFERENCE_SPACE_TYPE_VIEW;
+    XrSpace view = XR_NULL_HANDLE;
+    CHECK_XR(createReferenceSpace(session, &spaceInfo, &view));
+
+    for (uint32_t frame = 0; frame < kFrames; ++frame)
+    {
+        XrFrameWaitInfo waitInfo{XR_TYPE_FRAME_WAIT_INFO, nullptr};
+        XrFrameState frameState{};
+        frameState.type = XR_TYPE_FRAME_STATE;
+        CHECK_XR(waitFrame(session, &waitInfo, &frameState));
+
+        XrFrameBeginInfo frameBeginInfo{XR_TYPE_FRAME_BEGIN_INFO, nullptr};
+        CHECK_XR(beginFrame(session, &frameBeginInfo));
+
+        XrSpaceLocation location{};
+        location.type = XR_TYPE_SPACE_LOCATION;
+        CHECK_XR(locateSpace(view, local, frameState.predictedDisplayTime, &location));
+
+        XrViewLocateInfo viewLocateInfo{XR_TYPE_VIEW_LOCATE_INFO, nullptr, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, frameState.predictedDisplayTime, local};
+        XrViewState viewState{XR_TYPE_VIEW_STATE, nullptr, 0};
+        XrView views[2] = {};
+        views[0].type = views[1].type = XR_TYPE_VIEW;
+        uint32_t viewCount = 0;
+        CHECK_XR(locateViews(session, &viewLocateInfo, &viewState, 0, &viewCount, nullptr));
+        CHECK_XR(locateViews(session, &viewLocateInfo, &viewState, 2, &viewCount, views));
+
+        XrCompositionLayerProjectionView projectionViews[2] = {};
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            projectionViews[i].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+            projectionViews[i].pose = views[i].pose;
+            projectionViews[i].fov = views[i].fov;
+            projectionViews[i].subImage.imageRect.extent = {1440, 1600};
+        }
+        XrCompositionLayerProjection layer{XR_TYPE_COMPOSITION_LAYER_PROJECTION, nullptr, 0, local, 2, projectionViews};
+        const XrCompositionLayerBaseHeader* layers[] = {reinterpret_cast<const XrCompositionLayerBaseHeader*>(&layer)};
+        XrFrameEndInfo frameEndInfo{XR_TYPE_FRAME_END_INFO, nullptr, frameState.predictedDisplayTime, XR_ENVIRONMENT_BLEND_MODE_OPAQUE, 1, layers};
+        CHECK_XR(endFrame(session, &frameEndInfo));
+    }
+
+    CHECK_XR(endSession(session));
+    CHECK_XR(destroySpace(view));
+    CHECK_XR(destroySpace(local));
+    CHECK_XR(destroySession(session));
+    CHECK_XR(destroyInstance(instance));
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: replay_capture directory\n");
+        return 2;
+    }
+
+    // Not where the replay's runtime starts, so trace_replay has to map them.
+    s_FakeNextHandle = 0x1000;
+    s_FakeDisplayTime = 1000000000;
+
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr = HookXrInstanceProcAddr(FakeGetInstanceProcAddr, 1024 * 1024, 64 * 1024, kDefaultThreadMemoryBudget, kDefaultSpillBudget);
+    SetRecordInputs(true);
+    if (!StartFileSink(argv[1], 64 * 1024, 0))
+    {
+        fprintf(stderr, "can't write trace files to %s\n", argv[1]);
+        return 1;
+    }
+
+    bool succeeded = RunSession(getInstanceProcAddr);
+    StopFileSink();
+    return succeeded ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+// The fake runtime of replay_fake_runtime.h as a library trace_replay can load, for the replay smoke test:
+//   g++ -std=c++14 -O2 -I<OpenXR-SDK>/include -shared -fPIC replay_fake_runtime.cpp -o libreplay_fake_runtime.so
+//   trace_replay ./libreplay_fake_runtime.so replay_smoke.oxrt
+// Every function should report 0 in the results column, see replay_capture.cpp for how the capture was made.
+
+#include "../openxr_runtime_debugger/api_exports.h"
+
+#define XR_NO_PROTOTYPES
+#include <openxr/openxr.h>
+
+#include "replay_fake_runtime.h"
+
+extern "C" XrResult UNITY_INTERFACE_EXPORT XRAPI_PTR xrGetInstanceProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function)
+{
+    return FakeGetInstanceProcAddr(instance, name, function);
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+// Fake runtime for the trace_replay smoke test: a session with a few frames, enough for replay_capture.cpp to record
+// and for trace_replay to replay through replay_fake_runtime.cpp.
+// Every function checks the handles, system id and display times it's given against the ones it handed out, and fails
+// with the matching error otherwise, so a replay that doesn't map them shows up as results that differ from the capture.
+
+#include <stdint.h>
+#include <string.h>
+#include <unordered_set>
+
+// Where handles and predicted display times start, different for the capture and the replay so they must be mapped.
+static uint64_t s_FakeNextHandle = 0x7000;
+static XrTime s_FakeDisplayTime = 5000000000;
+
+static const XrSystemId kFakeSystemId = 0x42;
+static const XrDuration kFakeDisplayPeriod = 11111111;
+
+static std::unordered_set<uint64_t> s_FakeHandles;
+static XrTime s_FakeWaitedDisplayTime = 0;
+
+template <typename T>
+static T FakeCreateHandle()
+{
+    uint64_t handle = s_FakeNextHandle++;
+    s_FakeHandles.insert(handle);
+    return (T)handle;
+}
+
+template <typename T>
+static bool FakeIsHandle(T handle)
+{
+    return s_FakeHandles.count((uint64_t)handle) != 0;
+}
+
+template <typename T>
+static XrResult FakeDestroyHandle(T handle)
+{
+    return s_FakeHandles.erase((uint64_t)handle) != 0 ? XR_SUCCESS : XR_ERROR_HANDLE_INVALID;
+}
+
+static XrResult XRAPI_PTR FakeCreateInstance(const XrInstanceCreateInfo* createInfo, XrInstance* instance)
+{
+    if (createInfo == nullptr || createInfo->type != XR_TYPE_INSTANCE_CREATE_INFO || strcmp(createInfo->applicationInfo.applicationName, "replay smoke test") != 0)
+        return XR_ERROR_VALIDATION_FAILURE;
+    *instance = FakeCreateHandle<XrInstance>();
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeDestroyInstance(XrInstance instance)
+{
+    return FakeDestroyHandle(instance);
+}
+
+static XrResult XRAPI_PTR FakeGetSystem(XrInstance instance, const XrSystemGetInfo* getInfo, XrSystemId* systemId)
+{
+    if (!FakeIsHandle(instance))
+        return XR_ERROR_HANDLE_INVALID;
+    if (getInfo->formFactor != XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)
+        return XR_ERROR_FORM_FACTOR_UNSUPPORTED;
+    *systemId = kFakeSystemId;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeCreateSession(XrInstance instance, const XrSessionCreateInfo* createInfo, XrSession* session)
+{
+    if (!FakeIsHandle(instance))
+        return XR_ERROR_HANDLE_INVALID;
+    if (createInfo->systemId != kFakeSystemId)
+        return XR_ERROR_SYSTEM_INVALID;
+    *session = FakeCreateHandle<XrSession>();
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeDestroySession(XrSession session)
+{
+    return FakeDestroyHandle(session);
+}
+
+static XrResult XRAPI_PTR FakeBeginSession(XrSession session, const XrSessionBeginInfo* beginInfo)
+{
+    if (!FakeIsHandle(session))
+        return XR_ERROR_HANDLE_INVALID;
+    return beginInfo->primaryViewConfigurationType == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO ? XR_SUCCESS : XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+}
+
+static XrResult XRAPI_PTR FakeEndSession(XrSession session)
+{
+    return FakeIsHandle(session) ? XR_SUCCESS : XR_ERROR_HANDLE_INVALID;
+}
+
+static XrResult XRAPI_PTR FakeCreateReferenceSpace(XrSession session, const XrReferenceSpaceCreateInfo* createInfo, XrSpace* space)
+{
+    if (!FakeIsHandle(session))
+        return XR_ERROR_HANDLE_INVALID;
+    if (createInfo->referenceSpaceType != XR_REFERENCE_SPACE_TYPE_LOCAL && createInfo->referenceSpaceType != XR_REFERENCE_SPACE_TYPE_VIEW)
+        return XR_ERROR_REFERENCE_SPACE_UNSUPPORTED;
+    *space = FakeCreateHandle<XrSpace>();
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeDestroySpace(XrSpace space)
+{
+    return FakeDestroyHandle(space);
+}
+
+static XrResult XRAPI_PTR FakeWaitFrame(XrSession session, const XrFrameWaitInfo*, XrFrameState* frameState)
+{
+    if (!FakeIsHandle(session))
+        return XR_ERROR_HANDLE_INVALID;
+    s_FakeDisplayTime += kFakeDisplayPeriod;
+    s_FakeWaitedDisplayTime = s_FakeDisplayTime;
+    frameState->predictedDisplayTime = s_FakeDisplayTime;
+    frameState->predictedDisplayPeriod = kFakeDisplayPeriod;
+    frameState->shouldRender = XR_TRUE;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeBeginFrame(XrSession session, const XrFrameBeginInfo*)
+{
+    return FakeIsHandle(session) ? XR_SUCCESS : XR_ERROR_HANDLE_INVALID;
+}
+
+static XrResult XRAPI_PTR FakeLocateSpace(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation* location)
+{
+    if (!FakeIsHandle(space) || !FakeIsHandle(baseSpace))
+        return XR_ERROR_HANDLE_INVALID;
+    if (time != s_FakeWaitedDisplayTime)
+        return XR_ERROR_TIME_INVALID;
+    location->locationFlags = XR_SPACE_LOCATION_ORIENTATION_VALID_BIT | XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    location->pose.orientation.w = 1;
+    location->pose.position.y = 1.5f;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo, XrViewState* viewState, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views)
+{
+    if (!FakeIsHandle(session) || !FakeIsHandle(viewLocateInfo->space))
+        return XR_ERROR_HANDLE_INVALID;
+    if (viewLocateInfo->displayTime != s_FakeWaitedDisplayTime)
+        return XR_ERROR_TIME_INVALID;
+    viewState->viewStateFlags = XR_VIEW_STATE_ORIENTATION_VALID_BIT | XR_VIEW_STATE_POSITION_VALID_BIT;
+    *viewCountOutput = 2;
+    if (viewCapacityInput == 0)
+        return XR_SUCCESS;
+    if (viewCapacityInput < 2)
+        return XR_ERROR_SIZE_INSUFFICIENT;
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        views[i].pose.orientation.w = 1;
+        views[i].pose.position.x = i == 0 ? -0.03f : 0.03f;
+        views[i].fov = {-0.8f, 0.8f, 0.8f, -0.8f};
+    }
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo)
+{
+    if (!FakeIsHandle(session))
+        return XR_ERROR_HANDLE_INVALID;
+    if (frameEndInfo->displayTime != s_FakeWaitedDisplayTime)
+        return XR_ERROR_TIME_INVALID;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeGetInstanceProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function)
+{
+    struct Entry
+    {
+        const char* name;
+        PFN_xrVoidFunction function;
+        // Resolved with XR_NULL_HANDLE, before there's an instance.
+        bool global;
+    };
+    static const Entry kEntries[] = {
+        {"xrCreateInstance", (PFN_xrVoidFunction)FakeCreateInstance, true},
+        {"xrDestroyInstance", (PFN_xrVoidFunction)FakeDestroyInstance, false},
+        {"xrGetSystem", (PFN_xrVoidFunction)FakeGetSystem, false},
+        {"xrCreateSession", (PFN_xrVoidFunction)FakeCreateSession, false},
+        {"xrDestroySession", (PFN_xrVoidFunction)FakeDestroySession, false},
+        {"xrBeginSession", (PFN_xrVoidFunction)FakeBeginSession, false},
+        {"xrEndSession", (PFN_xrVoidFunction)FakeEndSession, false},
+        {"xrCreateReferenceSpace", (PFN_xrVoidFunction)FakeCreateReferenceSpace, false},
+        {"xrDestroySpace", (PFN_xrVoidFunction)FakeDestroySpace, false},
+        {"xrWaitFrame", (PFN_xrVoidFunction)FakeWaitFrame, false},
+        {"xrBeginFrame", (PFN_xrVoidFunction)FakeBeginFrame, false},
+        {"xrLocateSpace", (PFN_xrVoidFunction)FakeLocateSpace, false},
+        {"xrLocateViews", (PFN_xrVoidFunction)FakeLocateViews, false},
+        {"xrEndFrame", (PFN_xrVoidFunction)FakeEndFrame, false},
+    };
+    for (const Entry& entry : kEntries)
+    {
+        if (strcmp(name, entry.name) == 0 && (entry.global || FakeIsHandle(instance)))
+        {
+            *function = entry.function;
+            return XR_SUCCESS;
+        }
+    }
+    *function = nullptr;
+    return instance == XR_NULL_HANDLE || FakeIsHandle(instance) ? XR_ERROR_FUNCTION_UNSUPPORTED : XR_ERROR_HANDLE_INVALID;
+}
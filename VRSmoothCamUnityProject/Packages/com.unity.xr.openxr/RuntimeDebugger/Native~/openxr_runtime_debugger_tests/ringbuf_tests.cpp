@@ -0,0 +1,449 @@
+// Tests and benchmark for RingBuf (openxr_runtime_debugger/ringbuf.h).
+// Standalone, build and run with for example:
+//   g++ -std=c++14 -O2 ringbuf_tests.cpp -o ringbuf_tests && ./ringbuf_tests
+//   cl /std:c++14 /O2 /EHsc ringbuf_tests.cpp && ringbuf_tests.exe
+// Returns non-zero if a test fails.  Pass --no-bench to skip the benchmark.
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "../openxr_runtime_debugger/ringbuf.h"
+
+#define CACHE_SIZE 1024 * 1024 * 1
+
+static int s_Failures = 0;
+
+// Not assert, so the checks still run in optimized builds.
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++s_Failures;                                                         \
+        }                                                                         \
+    } while (0)
+
+static void Fill(RingBuf& buf, uint32_t size, uint8_t value)
+{
+    buf.CreateNewBlock();
+    uint8_t* wbuf = buf.GetForWrite(size);
+    CHECK(wbuf != nullptr);
+    if (wbuf != nullptr)
+        memset(wbuf, value, size);
+}
+
+// Many laps with odd sizes: blocks come back whole, in order, and everything is accounted for.
+static void LapTest(bool mirror)
+{
+    RingBuf buf{};
+    buf.Create(CACHE_SIZE, mirror);
+
+    uint8_t* ptr;
+    uint32_t size;
+    uint64_t written = 0;
+    uint32_t next = 0;
+    for (uint32_t lap = 0; lap < 20; ++lap)
+    {
+        for (uint32_t i = 0; i < 1000; ++i, ++next)
+        {
+            uint32_t blockSize = 8 + (next * 7919) % 3000;
+            buf.CreateNewBlock();
+            uint8_t* block = buf.GetForWrite(blockSize);
+            memcpy(block, &next, 4);
+            memset(block + 4, (uint8_t)next, blockSize - 4);
+            written += blockSize;
+        }
+
+        // Copies don't consume anything, and a short one has the newest whole blocks.
+        std::vector<uint8_t> copy(CACHE_SIZE);
+        uint32_t copied = buf.CopyNewest(copy.data(), CACHE_SIZE);
+        CHECK(copied == buf.usedBytes);
+        std::vector<uint8_t> newest(4096);
+        uint32_t newestSize = buf.CopyNewest(newest.data(), (uint32_t)newest.size());
+        CHECK(newestSize > 4096 - 3008 && newestSize <= 4096);
+        CHECK(memcmp(newest.data(), copy.data() + copied - newestSize, newestSize) == 0);
+
+        std::vector<uint8_t> readBytes;
+        uint64_t read = 0;
+        uint32_t expected = 0;
+        bool first = true;
+        bool more = false;
+        do
+        {
+            more = buf.GetForRead(&ptr, &size);
+            readBytes.insert(readBytes.end(), ptr, ptr + size);
+            for (uint32_t offset = 0; offset < size;)
+            {
+                uint32_t id;
+                memcpy(&id, ptr + offset, 4);
+                CHECK(first || id == expected);
+                first = false;
+                expected = id + 1;
+                offset += 8 + (id * 7919) % 3000;
+            }
+            read += size;
+        } while (more);
+
+        CHECK(expected == next);
+        CHECK(read + buf.droppedBytes == written);
+        CHECK(readBytes.size() == copied && memcmp(readBytes.data(), copy.data(), copied) == 0);
+        CHECK(!buf.HasDataForRead());
+        buf.Reset();
+        written = buf.droppedBytes = buf.droppedBlocks = 0;
+    }
+
+
+    buf.Destroy();
+}
+
+static void Tests()
+{
+    RingBuf buf{};
+    buf.Create(CACHE_SIZE);
+
+    uint8_t* ptr;
+    uint32_t size;
+
+    // Check that starts out empty
+    CHECK(!buf.HasDataForRead());
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 0);
+    buf.Reset();
+
+    // Write
+    buf.CreateNewBlock();
+    auto* wbuf = buf.GetForWrite(4);
+    *(uint32_t*)wbuf = 0x12345678;
+    CHECK(buf.HasDataForRead());
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 4);
+    CHECK(*(uint32_t*)ptr == 0x12345678);
+    CHECK(!buf.HasDataForRead());
+    buf.Reset();
+
+    // Write 2
+    buf.CreateNewBlock();
+    wbuf = buf.GetForWrite(4);
+    *(uint32_t*)wbuf = 0x12345678;
+    buf.CreateNewBlock();
+    wbuf = buf.GetForWrite(8);
+    *(uint64_t*)wbuf = 0x123456789abcdef0;
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 12);
+    CHECK(*(uint32_t*)ptr == 0x12345678);
+    CHECK(*(uint64_t*)(ptr + 4) == 0x123456789abcdef0);
+    buf.Reset();
+
+    // Full buf
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == CACHE_SIZE);
+    CHECK(buf.droppedBlocks == 0);
+    buf.Reset();
+
+    // Wrap buf, perfectly lines up
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+    Fill(buf, 8, 4);
+
+    CHECK(buf.GetForRead(&ptr, &size) == true);
+    CHECK(size == CACHE_SIZE - 8);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[8] == 3);
+    CHECK(ptr[size - 1] == 3);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 8);
+    CHECK(ptr[0] == 4);
+    buf.Reset();
+
+    // Wrap buf, not perfect
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 20, 3);
+    Fill(buf, 8, 4);
+
+    CHECK(buf.GetForRead(&ptr, &size) == true);
+    CHECK(size == CACHE_SIZE - 12);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[8] == 3);
+    CHECK(ptr[size - 1] == 3);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 8);
+    CHECK(ptr[0] == 4);
+    buf.Reset();
+
+    // Wrap, and fit more in previous first spot
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+    Fill(buf, 4, 4);
+    Fill(buf, 4, 5);
+
+    CHECK(buf.GetForRead(&ptr, &size) == true);
+    CHECK(size == CACHE_SIZE - 8);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[8] == 3);
+    CHECK(ptr[size - 1] == 3);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 8);
+    CHECK(ptr[0] == 4);
+    CHECK(ptr[4] == 5);
+    buf.Reset();
+
+    // Wrap, and consume first two entries
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+    Fill(buf, 4, 4);
+    Fill(buf, 8, 5);
+
+    CHECK(buf.GetForRead(&ptr, &size) == true);
+    CHECK(size == CACHE_SIZE - 8 - 8);
+    CHECK(ptr[0] == 3);
+    CHECK(ptr[size - 1] == 3);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 12);
+    CHECK(ptr[0] == 4);
+    CHECK(ptr[4] == 5);
+    buf.Reset();
+
+    // Wrap, and consume first three entries
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+    Fill(buf, 4, 4);
+    Fill(buf, 8, 5);
+    Fill(buf, 8, 6);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 20);
+    CHECK(ptr[0] == 4);
+    CHECK(ptr[4] == 5);
+    CHECK(ptr[12] == 6);
+    buf.Reset();
+
+    // Section wraps, perfectly
+    Fill(buf, 8, 1);
+    Fill(buf, CACHE_SIZE, 2);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == CACHE_SIZE);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[CACHE_SIZE - 1] == 2);
+    buf.Reset();
+
+    // Section wraps, not perfect.  The block moves to the start of the buffer in one piece.
+    Fill(buf, 8, 1);
+    buf.CreateNewBlock();
+    wbuf = buf.GetForWrite(CACHE_SIZE - 16);
+    memset(wbuf, 2, CACHE_SIZE - 16);
+    wbuf = buf.GetForWrite(8);
+    memset(wbuf, 3, 8);
+    wbuf = buf.GetForWrite(8);
+    memset(wbuf, 4, 8);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == CACHE_SIZE);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[CACHE_SIZE - 17] == 2);
+    CHECK(ptr[CACHE_SIZE - 16] == 3);
+    CHECK(ptr[CACHE_SIZE - 1] == 4);
+    buf.Reset();
+
+    // section wraps on itself
+    buf.CreateNewBlock();
+    wbuf = buf.GetForWrite(CACHE_SIZE - 8);
+    wbuf = buf.GetForWrite(8);
+
+    wbuf = buf.GetForWrite(8);
+    CHECK(wbuf == nullptr);
+    CHECK(!buf.HasDataForRead());
+    // Stays abandoned until the next block.
+    CHECK(buf.GetForWrite(1) == nullptr);
+    buf.CreateNewBlock();
+    CHECK(buf.GetForWrite(1) != nullptr);
+    buf.Reset();
+
+    // A block that can't fit leaves the older ones alone.
+    Fill(buf, 8, 1);
+    buf.CreateNewBlock();
+    CHECK(buf.GetForWrite(CACHE_SIZE + 1) == nullptr);
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == 8);
+    CHECK(ptr[0] == 1);
+    buf.Reset();
+
+    // Dropped blocks and bytes
+    buf.droppedBlocks = 0;
+    buf.droppedBytes = 0;
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+    Fill(buf, 12, 4);
+    CHECK(buf.droppedBlocks == 2);
+    CHECK(buf.droppedBytes == 16);
+    Fill(buf, CACHE_SIZE - 12, 5);
+    CHECK(buf.droppedBlocks == 3);
+    CHECK(buf.droppedBytes == CACHE_SIZE);
+    buf.Reset();
+    CHECK(buf.droppedBlocks == 3);
+
+    // Running out of block index forgets the oldest block.
+    buf.droppedBlocks = 0;
+    buf.droppedBytes = 0;
+    for (uint32_t i = 0; i < buf.blockCapacity + 1; ++i)
+        Fill(buf, 1, (uint8_t)i);
+    CHECK(buf.droppedBlocks == 1);
+    CHECK(buf.droppedBytes == 1);
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == buf.blockCapacity);
+    CHECK(ptr[0] == 1);
+    buf.Reset();
+
+    buf.Destroy();
+
+    LapTest(false);
+}
+
+#if defined(__linux__)
+static void MirroredTests()
+{
+    RingBuf buf{};
+    buf.Create(CACHE_SIZE, true);
+    CHECK(buf.mirrored);
+
+    uint8_t* ptr;
+    uint32_t size;
+
+    // Wrap buf, perfectly lines up
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 16, 3);
+    Fill(buf, 8, 4);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == CACHE_SIZE);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[8] == 3);
+    CHECK(ptr[size - 9] == 3);
+    CHECK(ptr[size - 8] == 4);
+    CHECK(ptr[size - 1] == 4);
+    buf.Reset();
+
+    // Wrap buf, not perfect: the record runs past the end instead of leaving a gap.
+    buf.droppedBlocks = 0;
+    Fill(buf, 8, 1);
+    Fill(buf, 8, 2);
+    Fill(buf, CACHE_SIZE - 20, 3);
+    Fill(buf, 8, 4);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == CACHE_SIZE - 4);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[size - 9] == 3);
+    CHECK(ptr[size - 8] == 4);
+    CHECK(ptr[size - 1] == 4);
+    CHECK(buf.data[0] == 4);
+    CHECK(buf.droppedBlocks == 1);
+    buf.Reset();
+
+    // Section wraps, not perfect
+    Fill(buf, 8, 1);
+    Fill(buf, CACHE_SIZE - 16, 2);
+    buf.CreateNewBlock();
+    uint8_t* wbuf = buf.GetForWrite(8);
+    memset(wbuf, 3, 8);
+    wbuf = buf.GetForWrite(8);
+    memset(wbuf, 4, 8);
+
+    CHECK(buf.GetForRead(&ptr, &size) == false);
+    CHECK(size == CACHE_SIZE);
+    CHECK(ptr[0] == 2);
+    CHECK(ptr[CACHE_SIZE - 17] == 2);
+    CHECK(ptr[CACHE_SIZE - 16] == 3);
+    CHECK(ptr[CACHE_SIZE - 1] == 4);
+    buf.Reset();
+
+    // section wraps on itself
+    buf.CreateNewBlock();
+    CHECK(buf.GetForWrite(CACHE_SIZE) != nullptr);
+    CHECK(buf.GetForWrite(1) == nullptr);
+    CHECK(!buf.HasDataForRead());
+    buf.Destroy();
+
+    // Not a multiple of the page size, falls back to a plain allocation.
+    buf.Create(CACHE_SIZE - 8, true);
+    CHECK(!buf.mirrored);
+    buf.Destroy();
+
+    LapTest(true);
+}
+#endif
+
+static void Report(const char* name, uint64_t writes, uint64_t bytes, std::chrono::steady_clock::duration elapsed)
+{
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    printf("%-40s %8.1f M writes/s %8.1f MB/s\n", name, writes / seconds / 1e6, bytes / seconds / 1e6);
+}
+
+static void Benchmark()
+{
+    const uint32_t kCalls = 2000000;
+
+    // Main store: one write per drained record, wrapping and forgetting old blocks.
+    const uint32_t kRecordSizes[] = {32, 256, 4096};
+    for (uint32_t mirror = 0; mirror < 2; ++mirror)
+    for (uint32_t recordSize : kRecordSizes)
+    {
+        RingBuf buf{};
+        buf.Create(CACHE_SIZE, mirror != 0);
+        if (mirror && !buf.mirrored)
+            break;
+        uint8_t record[4096] = {};
+        uint64_t bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kCalls; ++i)
+        {
+            buf.CreateNewBlock();
+            uint8_t* dst = buf.GetForWrite(recordSize);
+            if (dst != nullptr)
+                memcpy(dst, record, recordSize);
+            bytes += recordSize;
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "main store%s, %u byte records", mirror ? " (mirrored)" : "", recordSize);
+        Report(name, kCalls, bytes, std::chrono::steady_clock::now() - start);
+        buf.Destroy();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Tests();
+#if defined(__linux__)
+    MirroredTests();
+#endif
+    if (s_Failures != 0)
+    {
+        printf("%d checks failed\n", s_Failures);
+        return 1;
+    }
+    printf("all tests passed\n");
+
+    if (argc < 2 || strcmp(argv[1], "--no-bench") != 0)
+        Benchmark();
+    return 0;
+}
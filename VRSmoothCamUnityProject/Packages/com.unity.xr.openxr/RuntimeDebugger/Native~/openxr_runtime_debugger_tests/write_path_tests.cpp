@@ -0,0 +1,1650 @@
+// Checks that the hooked functions don't allocate between StartFunctionCall and EndFunctionCall, and times them.
+// Also checks that threads hand their buffers back when they exit, that the memory budget holds, that calls too
+// large for a thread's buffer still come through in full, that enums are sent as numbers and decode to their names,
+// that calls are grouped into frames, decode a command at a time and export to Chrome trace JSON, that deferred
+// formatting decodes to the same calls, and that the trace file sink rotates and every file it keeps decodes on its own.
+// Builds the whole runtime debugger against a fake runtime, for example:
+//   g++ -std=c++14 -O2 -I<OpenXR-SDK>/include -pthread write_path_tests.cpp -o write_path_tests && ./write_path_tests
+// Returns non-zero if a test fails.  Pass --no-bench to skip the benchmark.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#if !defined(_WIN32)
+#include <dirent.h>
+#endif
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "../openxr_runtime_debugger/runtime_debugger.cpp"
+#include "../openxr_runtime_debugger/trace_decoder.h"
+#include "../openxr_runtime_debugger/trace_export_chrome.h"
+
+// Counts every operator new made on a thread while it has s_CountAllocations set.
+static thread_local bool s_CountAllocations = false;
+static std::atomic<uint64_t> s_Allocations{0};
+
+static void* CountedAllocation(size_t size)
+{
+    if (s_CountAllocations)
+        s_Allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = malloc(size != 0 ? size : 1);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(size_t size)
+{
+    return CountedAllocation(size);
+}
+
+void* operator new[](size_t size)
+{
+    return CountedAllocation(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    free(p);
+}
+
+static int s_Failures = 0;
+
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++s_Failures;                                                         \
+        }                                                                         \
+    } while (0)
+
+// Fake runtime, just enough for a frame loop.  Called from several threads by the budget test.
+static std::atomic<XrTime> s_PredictedDisplayTime{1000000000};
+
+static XrResult XRAPI_PTR FakePollEvent(XrInstance, XrEventDataBuffer* eventData)
+{
+    auto* event = reinterpret_cast<XrEventDataSessionStateChanged*>(eventData);
+    event->type = XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED;
+    event->next = nullptr;
+    event->session = (XrSession)0x55;
+    event->state = XR_SESSION_STATE_FOCUSED;
+    event->time = s_PredictedDisplayTime;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeWaitFrame(XrSession, const XrFrameWaitInfo*, XrFrameState* frameState)
+{
+    frameState->predictedDisplayTime = s_PredictedDisplayTime.fetch_add(11111111) + 11111111;
+    frameState->predictedDisplayPeriod = 11111111;
+    frameState->shouldRender = XR_TRUE;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeBeginFrame(XrSession, const XrFrameBeginInfo*)
+{
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeEndFrame(XrSession, const XrFrameEndInfo*)
+{
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeLocateSpace(XrSpace, XrSpace, XrTime, XrSpaceLocation* location)
+{
+    location->locationFlags = XR_SPACE_LOCATION_ORIENTATION_VALID_BIT | XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    location->pose.orientation.w = 1;
+    location->pose.position.y = 1.5f;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeLocateViews(XrSession, const XrViewLocateInfo*, XrViewState* viewState, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views)
+{
+    viewState->viewStateFlags = XR_VIEW_STATE_ORIENTATION_VALID_BIT | XR_VIEW_STATE_POSITION_VALID_BIT;
+    *viewCountOutput = 2;
+    // Long result names are sent as strings too.
+    if (viewCapacityInput < 2)
+        return XR_ERROR_SIZE_INSUFFICIENT;
+    for (uint32_t i = 0; i < viewCapacityInput; ++i)
+    {
+        views[i].pose.orientation.w = 1;
+        views[i].pose.position.x = i == 0 ? -0.03f : 0.03f;
+        views[i].fov = {-0.8f, 0.8f, 0.8f, -0.8f};
+    }
+    return XR_SUCCESS;
+}
+
+// Images of a graphics API this build doesn't include, so neither path can read past their header.
+static XrResult XRAPI_PTR FakeEnumerateSwapchainImages(XrSwapchain, uint32_t imageCapacityInput, uint32_t* imageCountOutput, XrSwapchainImageBaseHeader* images)
+{
+    *imageCountOutput = 3;
+    for (uint32_t i = 0; i < imageCapacityInput && i < 3; ++i)
+        images[i].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR;
+    return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR FakeGetInstanceProcAddr(XrInstance, const char* name, PFN_xrVoidFunction* function)
+{
+    struct Entry
+    {
+        const char* name;
+        PFN_xrVoidFunction function;
+    };
+    static const Entry kEntries[] = {
+        {"xrPollEvent", (PFN_xrVoidFunction)FakePollEvent},
+        {"xrWaitFrame", (PFN_xrVoidFunction)FakeWaitFrame},
+        {"xrBeginFrame", (PFN_xrVoidFunction)FakeBeginFrame},
+        {"xrEndFrame", (PFN_xrVoidFunction)FakeEndFrame},
+        {"xrLocateSpace", (PFN_xrVoidFunction)FakeLocateSpace},
+        {"xrLocateViews", (PFN_xrVoidFunction)FakeLocateViews},
+        {"xrEnumerateSwapchainImages", (PFN_xrVoidFunction)FakeEnumerateSwapchainImages},
+    };
+    for (const Entry& entry : kEntries)
+    {
+        if (strcmp(name, entry.name) == 0)
+        {
+            *function = entry.function;
+            return XR_SUCCESS;
+        }
+    }
+    *function = nullptr;
+    return XR_ERROR_FUNCTION_UNSUPPORTED;
+}
+
+struct HookedFunctions
+{
+    PFN_xrPollEvent pollEvent;
+    PFN_xrWaitFrame waitFrame;
+    PFN_xrBeginFrame beginFrame;
+    PFN_xrEndFrame endFrame;
+    PFN_xrLocateSpace locateSpace;
+    PFN_xrLocateViews locateViews;
+    PFN_xrEnumerateSwapchainImages enumerateSwapchainImages;
+};
+
+template <typename T>
+static T Resolve(PFN_xrGetInstanceProcAddr getInstanceProcAddr, const char* name)
+{
+    PFN_xrVoidFunction function = nullptr;
+    getInstanceProcAddr((XrInstance)0x1, name, &function);
+    return (T)function;
+}
+
+// StartDataAccess only reads what was drained already.  The tests read right after their calls, so they drain
+// first, as a calling thread whose queue filled up would.
+static void StartDrainedDataAccess()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_DataMutex);
+        DrainThreadQueues();
+    }
+    StartDataAccess();
+}
+
+// One frame of a typical app, 7 calls.
+static void Frame(const HookedFunctions& xr)
+{
+    XrSession session = (XrSession)0x55;
+    XrSpace space = (XrSpace)0x77;
+
+    XrEventDataBuffer event{};
+    event.type = XR_TYPE_EVENT_DATA_BUFFER;
+    xr.pollEvent((XrInstance)0x1, &event);
+
+    XrFrameWaitInfo waitInfo{XR_TYPE_FRAME_WAIT_INFO, nullptr};
+    XrFrameState frameState{};
+    frameState.type = XR_TYPE_FRAME_STATE;
+    xr.waitFrame(session, &waitInfo, &frameState);
+
+    XrFrameBeginInfo beginInfo{XR_TYPE_FRAME_BEGIN_INFO, nullptr};
+    xr.beginFrame(session, &beginInfo);
+
+    XrSpaceLocation location{};
+    location.type = XR_TYPE_SPACE_LOCATION;
+    xr.locateSpace((XrSpace)0x66, space, frameState.predictedDisplayTime, &location);
+
+    XrViewLocateInfo viewLocateInfo{XR_TYPE_VIEW_LOCATE_INFO, nullptr, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, frameState.predictedDisplayTime, space};
+    XrViewState viewState{XR_TYPE_VIEW_STATE, nullptr, 0};
+    XrView views[2] = {};
+    views[0].type = views[1].type = XR_TYPE_VIEW;
+    uint32_t viewCount = 0;
+    xr.locateViews(session, &viewLocateInfo, &viewState, 0, &viewCount, nullptr);
+    xr.locateViews(session, &viewLocateInfo, &viewState, 2, &viewCount, views);
+
+    XrCompositionLayerProjectionView projectionViews[2] = {};
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        projectionViews[i].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        projectionViews[i].pose = views[i].pose;
+        projectionViews[i].fov = views[i].fov;
+        projectionViews[i].subImage.swapchain = (XrSwapchain)0x88;
+        projectionViews[i].subImage.imageRect.extent = {1440, 1600};
+    }
+    XrCompositionLayerProjection layer{XR_TYPE_COMPOSITION_LAYER_PROJECTION, nullptr, 0, space, 2, projectionViews};
+    const XrCompositionLayerBaseHeader* layers[] = {reinterpret_cast<const XrCompositionLayerBaseHeader*>(&layer)};
+    XrFrameEndInfo endInfo{XR_TYPE_FRAME_END_INFO, nullptr, frameState.predictedDisplayTime, XR_ENVIRONMENT_BLEND_MODE_OPAQUE, 1, layers};
+    xr.endFrame(session, &endInfo);
+}
+
+static const uint32_t kCallsPerFrame = 7;
+
+// Makes sure nothing allocates in steady state, the first calls on a thread are allowed to set things up.
+static void CheckNoAllocations(const HookedFunctions& xr, const char* mode)
+{
+    Frame(xr);
+
+    s_Allocations = 0;
+    s_CountAllocations = true;
+    for (uint32_t i = 0; i < 10000; ++i)
+        Frame(xr);
+    s_CountAllocations = false;
+
+    printf("%-12s %llu allocations in %u calls\n", mode, (unsigned long long)s_Allocations.load(), 10000 * kCallsPerFrame);
+    CHECK(s_Allocations == 0);
+
+    // Keep the main store from carrying over into the next mode.
+    StartDrainedDataAccess();
+    EndDataAccess();
+}
+
+static void Benchmark(const HookedFunctions& xr, const char* mode)
+{
+    const uint32_t kFrames = 200000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kFrames; ++i)
+        Frame(xr);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("%-12s %6.1f ns/call\n", mode, seconds * 1e9 / (kFrames * kCallsPerFrame));
+
+    StartDrainedDataAccess();
+    EndDataAccess();
+}
+
+// How long frames take while a reader keeps the data locked, like the editor copying out a large read.  Calling threads
+// only ever wait for the reader if their queue fills up, so the slowest frames should be nowhere near kHoldMs.
+static void BenchmarkReaderContention(const HookedFunctions& xr)
+{
+    const uint32_t kFrames = 200000;
+    const uint32_t kHoldMs = 2;
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> reads{0};
+    std::thread reader([&] {
+        while (!stop)
+        {
+            StartDataAccess();
+            uint8_t* ptr = nullptr;
+            uint32_t size = 0;
+            while (GetDataForRead(&ptr, &size))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(kHoldMs));
+            EndDataAccess();
+            reads.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::vector<double> frameTimes(kFrames);
+    for (uint32_t i = 0; i < kFrames; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Frame(xr);
+        frameTimes[i] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+    stop = true;
+    reader.join();
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    printf("%-12s %u reads holding the lock %u ms, frame p50 %.1f us, p99 %.1f us, p99.9 %.1f us, max %.1f us\n", "contended", reads.load(), kHoldMs,
+           frameTimes[kFrames / 2], frameTimes[kFrames * 99 / 100], frameTimes[kFrames * 999 / 1000], frameTimes[kFrames - 1]);
+
+    StartDrainedDataAccess();
+    EndDataAccess();
+}
+
+static uint32_t CaptureArenaBytes()
+{
+    uint32_t bytes = 0;
+    for (CallStream* stream = s_CallStreams.load(); stream != nullptr; stream = stream->nextStream)
+        bytes += stream->capture.UsedBytes();
+    return bytes;
+}
+
+// The loop above makes calls faster than the formatter thread can keep up with, so some of them are formatted on the
+// calling thread anyway.  This times a few frames at a time and wakes the formatter to catch up in between, like a
+// real frame loop would give it time to.
+static void BenchmarkPaced(const HookedFunctions& xr, const char* mode)
+{
+    const uint32_t kBursts = 20000;
+    const uint32_t kFramesPerBurst = 10;
+    double seconds = 0;
+    for (uint32_t burst = 0; burst < kBursts; ++burst)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kFramesPerBurst; ++i)
+            Frame(xr);
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        s_FormatterCondition.notify_one();
+        while (CaptureArenaBytes() != 0)
+            std::this_thread::yield();
+    }
+    printf("%-12s %6.1f ns/call\n", mode, seconds * 1e9 / (kBursts * kFramesPerBurst * kCallsPerFrame));
+
+    StartDrainedDataAccess();
+    EndDataAccess();
+}
+
+// Sums every value the decoder hands out, so none of the decoding can be optimized away.
+struct ChecksumVisitor final : TraceVisitor
+{
+    uint64_t sum = 0;
+    uint64_t calls = 0;
+
+    void OnStartFunctionCall(uint32_t threadIndex, StringSpan funcName) override
+    {
+        sum += threadIndex + funcName.size;
+    }
+
+    void OnStartStruct(StringSpan fieldName, StringSpan structName) override
+    {
+        sum += fieldName.size + structName.size;
+    }
+
+    void OnFloat(StringSpan fieldName, float value) override
+    {
+        sum += fieldName.size + (uint64_t)(int64_t)value;
+    }
+
+    void OnString(StringSpan fieldName, StringSpan value) override
+    {
+        sum += fieldName.size + value.size;
+    }
+
+    void OnInt(StringSpan fieldName, int64_t value) override
+    {
+        sum += fieldName.size + (uint64_t)value;
+    }
+
+    void OnUInt(StringSpan fieldName, uint64_t value) override
+    {
+        sum += fieldName.size + value;
+    }
+
+    void OnEnum(StringSpan fieldName, StringSpan typeName, int32_t value, StringSpan valueName) override
+    {
+        sum += fieldName.size + typeName.size + (uint32_t)value + valueName.size;
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool, uint64_t startTime, uint64_t duration, uint32_t frame) override
+    {
+        sum += result.size + startTime + duration + frame;
+        ++calls;
+    }
+};
+
+// Decodes about 128 MB of captured frames in one pass, read out a few hundred frames at a time so the main store
+// never wraps.
+static void BenchmarkDecode(const HookedFunctions& xr)
+{
+    const size_t kBytes = 128 * 1024 * 1024;
+    std::vector<uint8_t> data;
+    RequestMetadata();
+    while (data.size() < kBytes)
+    {
+        for (uint32_t i = 0; i < 200; ++i)
+            Frame(xr);
+        StartDrainedDataAccess();
+        uint8_t* ptr = nullptr;
+        uint32_t size = 0;
+        bool more = true;
+        while (more)
+        {
+            more = GetDataForRead(&ptr, &size);
+            data.insert(data.end(), ptr, ptr + size);
+        }
+        EndDataAccess();
+    }
+
+    TraceDecoder decoder;
+    ChecksumVisitor visitor;
+    auto start = std::chrono::steady_clock::now();
+    CHECK(decoder.Decode(data.data(), data.size(), visitor));
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("%-12s %6.1f MB/s, %.1f ns/call (checksum %llx)\n", "decode", data.size() / seconds / 1e6, seconds * 1e9 / visitor.calls,
+           (unsigned long long)visitor.sum);
+}
+
+// Which threads the captured calls came from, and whether each one was named by a kThreadInfo first.
+struct ThreadVisitor : TraceVisitor
+{
+    std::unordered_map<uint32_t, std::string> names;
+    std::unordered_map<std::string, uint32_t> callsByName;
+    uint32_t calls = 0;
+    uint32_t unnamedCalls = 0;
+    uint32_t views = 0;
+    uint32_t cacheNotLargeEnough = 0;
+    uint32_t frameSummaries = 0;
+    std::vector<OverheadReport> overheadReports;
+
+    void OnStartStruct(StringSpan, StringSpan structName) override
+    {
+        if (structName == "XrView")
+            ++views;
+    }
+
+    void OnCacheNotLargeEnough(uint32_t, StringSpan, StringSpan, uint64_t, uint64_t, uint32_t) override
+    {
+        ++cacheNotLargeEnough;
+    }
+
+    void OnFrameSummary(const FrameSummary&) override
+    {
+        ++frameSummaries;
+    }
+
+    void OnOverheadReport(const OverheadReport& report) override
+    {
+        overheadReports.push_back(report);
+    }
+
+    void OnThreadInfo(uint32_t threadIndex, uint64_t, StringSpan threadName) override
+    {
+        names[threadIndex] = threadName.ToString();
+    }
+
+    void OnStartFunctionCall(uint32_t threadIndex, StringSpan) override
+    {
+        ++calls;
+        auto name = names.find(threadIndex);
+        if (name == names.end())
+            ++unnamedCalls;
+        else
+            ++callsByName[name->second];
+    }
+};
+
+// Decodes everything captured since the last read, with the metadata sent again so it decodes on its own.
+static void ReadCapturedThreads(ThreadVisitor& visitor)
+{
+    RequestMetadata();
+    StartDrainedDataAccess();
+    std::vector<uint8_t> data;
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    bool more = true;
+    while (more)
+    {
+        more = GetDataForRead(&ptr, &size);
+        data.insert(data.end(), ptr, ptr + size);
+    }
+    EndDataAccess();
+
+    TraceDecoder decoder;
+    CHECK(decoder.Decode(data.data(), data.size(), visitor));
+}
+
+static MemoryStats GetMemory()
+{
+    MemoryStats stats;
+    GetMemoryStats(&stats);
+    return stats;
+}
+
+// Records that didn't fit in a queue while another thread held the drain, see EndFunctionCall.
+static uint64_t QueueDroppedRecords()
+{
+    uint64_t dropped = 0;
+    for (CallStream* stream = s_CallStreams.load(); stream != nullptr; stream = stream->nextStream)
+        dropped += stream->queue.droppedRecords.load();
+    return dropped;
+}
+
+static void SetThreadName(const char* name)
+{
+#if defined(__linux__)
+    prctl(PR_SET_NAME, name);
+#endif
+}
+
+// Everything the decoder reports except times, one line per value.
+struct TranscriptVisitor : TraceVisitor
+{
+    std::string text;
+
+    void OnStartFunctionCall(uint32_t, StringSpan funcName) override
+    {
+        text += funcName.ToString() + "(\n";
+    }
+
+    void OnStartStruct(StringSpan fieldName, StringSpan structName) override
+    {
+        text += fieldName.ToString() + " " + structName.ToString() + " {\n";
+    }
+
+    void OnEndStruct() override
+    {
+        text += "}\n";
+    }
+
+    void OnFloat(StringSpan fieldName, float value) override
+    {
+        text += fieldName.ToString() + " = " + std::to_string(value) + "\n";
+    }
+
+    void OnString(StringSpan fieldName, StringSpan value) override
+    {
+        text += fieldName.ToString() + " = \"" + value.ToString() + "\"\n";
+    }
+
+    void OnInt(StringSpan fieldName, int64_t value) override
+    {
+        text += fieldName.ToString() + " = " + std::to_string(value) + "\n";
+    }
+
+    void OnUInt(StringSpan fieldName, uint64_t value) override
+    {
+        text += fieldName.ToString() + " = " + std::to_string(value) + "u\n";
+    }
+
+    void OnEnum(StringSpan fieldName, StringSpan typeName, int32_t, StringSpan valueName) override
+    {
+        text += fieldName.ToString() + " = " + typeName.ToString() + " " + valueName.ToString() + "\n";
+    }
+
+    void OnLostValue(StringSpan fieldName) override
+    {
+        text += fieldName.ToString() + " lost\n";
+    }
+
+    void OnCallOutputs() override
+    {
+        text += "outputs\n";
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool, uint64_t, uint64_t, uint32_t) override
+    {
+        text += ") = " + result.ToString() + "\n";
+    }
+
+    void OnCacheNotLargeEnough(uint32_t, StringSpan funcName, StringSpan, uint64_t, uint64_t, uint32_t) override
+    {
+        text += funcName.ToString() + " cache not large enough\n";
+    }
+};
+
+static std::string CaptureTranscript(const HookedFunctions& xr, uint32_t frames)
+{
+    s_PredictedDisplayTime = 1000000000;
+    for (uint32_t i = 0; i < frames; ++i)
+        Frame(xr);
+
+    RequestMetadata();
+    StartDrainedDataAccess();
+    std::vector<uint8_t> data;
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    bool more = true;
+    while (more)
+    {
+        more = GetDataForRead(&ptr, &size);
+        data.insert(data.end(), ptr, ptr + size);
+    }
+    EndDataAccess();
+
+    TranscriptVisitor visitor;
+    TraceDecoder decoder;
+    CHECK(decoder.Decode(data.data(), data.size(), visitor));
+    return visitor.text;
+}
+
+// Enum fields and results of a frame, and anything sent as a string.
+struct EnumVisitor : TraceVisitor
+{
+    std::unordered_map<std::string, std::string> enums;
+    std::vector<std::string> results;
+    uint32_t strings = 0;
+
+    void OnEnum(StringSpan fieldName, StringSpan typeName, int32_t, StringSpan valueName) override
+    {
+        enums[fieldName.ToString()] = typeName.ToString() + " " + valueName.ToString();
+    }
+
+    void OnString(StringSpan, StringSpan) override
+    {
+        ++strings;
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool, uint64_t, uint64_t, uint32_t) override
+    {
+        results.push_back(result.ToString());
+    }
+};
+
+// A frame's enums and results arrive as numbers and decode to the same names as before, values the table doesn't
+// know about decode to the number.
+static void CheckEnums(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    Frame(xr);
+    XrViewLocateInfo viewLocateInfo{XR_TYPE_VIEW_LOCATE_INFO, nullptr, (XrViewConfigurationType)12345, 0, (XrSpace)0x77};
+    XrViewState viewState{XR_TYPE_VIEW_STATE, nullptr, 0};
+    uint32_t viewCount = 0;
+    xr.locateViews((XrSession)0x55, &viewLocateInfo, &viewState, 0, &viewCount, nullptr);
+
+    RequestMetadata();
+    StartDrainedDataAccess();
+    std::vector<uint8_t> data;
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    bool more = true;
+    while (more)
+    {
+        more = GetDataForRead(&ptr, &size);
+        data.insert(data.end(), ptr, ptr + size);
+    }
+    EndDataAccess();
+
+    EnumVisitor visitor;
+    TraceDecoder decoder;
+    CHECK(decoder.Decode(data.data(), data.size(), visitor));
+
+    printf("enums        %u enum fields, %u strings in %u calls\n", (uint32_t)visitor.enums.size(), visitor.strings, (uint32_t)visitor.results.size());
+    CHECK(visitor.strings == 0);
+    CHECK(visitor.enums["state"] == "XrSessionState XR_SESSION_STATE_FOCUSED");
+    CHECK(visitor.enums["environmentBlendMode"] == "XrEnvironmentBlendMode XR_ENVIRONMENT_BLEND_MODE_OPAQUE");
+    CHECK(visitor.enums["viewConfigurationType"] == "XrViewConfigurationType 12345");
+    CHECK(visitor.results.size() == kCallsPerFrame + 1);
+    CHECK(visitor.results.size() > 4 && visitor.results[0] == "XR_SUCCESS" && visitor.results[4] == "XR_ERROR_SIZE_INSUFFICIENT");
+}
+
+// Structs are packed against the schema table and decode to the same fields, nested structs and next chains included.
+static void CheckStructs(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    std::string frame = CaptureTranscript(xr, 1);
+
+    XrFrameBeginInfo chained{XR_TYPE_FRAME_BEGIN_INFO, nullptr};
+    XrFrameWaitInfo waitInfo{XR_TYPE_FRAME_WAIT_INFO, &chained};
+    XrFrameState frameState{};
+    frameState.type = XR_TYPE_FRAME_STATE;
+    xr.waitFrame((XrSession)0x55, &waitInfo, &frameState);
+    std::string chain = CaptureTranscript(xr, 0);
+
+    // Every kind of field the schema packs bare, with values that don't fit in fewer bytes than they take.
+    XrCompositionLayerProjectionView view{};
+    view.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    view.pose = {{0.5f, -0.25f, 0.125f, 0.75f}, {-1.5f, 2.0f, -3.25f}};
+    view.fov = {-0.9f, 0.7f, 0.6f, -0.5f};
+    view.subImage.swapchain = (XrSwapchain)0x0123456789ABCDEFull;
+    view.subImage.imageRect = {{-16, 2147483647}, {1440, 1600}};
+    view.subImage.imageArrayIndex = 4294967295u;
+    XrCompositionLayerProjection layer{XR_TYPE_COMPOSITION_LAYER_PROJECTION, nullptr, XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT, (XrSpace)0xFFFFFFFF00000001ull, 1, &view};
+    const XrCompositionLayerBaseHeader* layers[] = {reinterpret_cast<const XrCompositionLayerBaseHeader*>(&layer)};
+    XrFrameEndInfo endInfo{XR_TYPE_FRAME_END_INFO, nullptr, -1, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND, 1, layers};
+    xr.endFrame((XrSession)0x55, &endInfo);
+    std::string layerText = CaptureTranscript(xr, 0);
+
+    // Handles are packed as numbers rather than sent through SendToCSharp, on Windows too.
+    CHECK(FieldEncoding<XrSwapchain>::kind == kFieldUInt64 && FieldEncoding<XrSpace>::kind == kFieldUInt64);
+
+    printf("structs      %u transcript bytes in a frame\n", (uint32_t)frame.size());
+    CHECK(frame.find("views XrView {\n"
+                     "type = XrStructureType XR_TYPE_VIEW\n"
+                     "next = 0u\n"
+                     "pose XrPosef {\n"
+                     "orientation XrQuaternionf {\nx = 0.000000\ny = 0.000000\nz = 0.000000\nw = 1.000000\n}\n"
+                     "position XrVector3f {\nx = 0.030000\ny = 0.000000\nz = 0.000000\n}\n"
+                     "}\n"
+                     "fov XrFovf {\nangleLeft = -0.800000\nangleRight = 0.800000\nangleUp = 0.800000\nangleDown = -0.800000\n}\n"
+                     "}\n") != std::string::npos);
+    CHECK(chain.find("frameWaitInfo XrFrameWaitInfo {\n"
+                     "type = XrStructureType XR_TYPE_FRAME_WAIT_INFO\n"
+                     "next XrFrameBeginInfo {\n"
+                     "type = XrStructureType XR_TYPE_FRAME_BEGIN_INFO\n"
+                     "next = 0u\n"
+                     "}\n"
+                     "}\n") != std::string::npos);
+    CHECK(layerText.find("frameEndInfo XrFrameEndInfo {\n"
+                         "type = XrStructureType XR_TYPE_FRAME_END_INFO\n"
+                         "next = 0u\n"
+                         "displayTime = -1\n"
+                         "environmentBlendMode = XrEnvironmentBlendMode XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND\n"
+                         "layerCount = 1u\n"
+                         "layers XrCompositionLayerProjection {\n"
+                         "type = XrStructureType XR_TYPE_COMPOSITION_LAYER_PROJECTION\n"
+                         "next = 0u\n"
+                         "layerFlags = 2u\n"
+                         "space = 18446744069414584321u\n"
+                         "viewCount = 1u\n"
+                         "views XrCompositionLayerProjectionView {\n"
+                         "type = XrStructureType XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW\n"
+                         "next = 0u\n"
+                         "pose XrPosef {\n"
+                         "orientation XrQuaternionf {\nx = 0.500000\ny = -0.250000\nz = 0.125000\nw = 0.750000\n}\n"
+                         "position XrVector3f {\nx = -1.500000\ny = 2.000000\nz = -3.250000\n}\n"
+                         "}\n"
+                         "fov XrFovf {\nangleLeft = -0.900000\nangleRight = 0.700000\nangleUp = 0.600000\nangleDown = -0.500000\n}\n"
+                         "subImage XrSwapchainSubImage {\n"
+                         "swapchain = 81985529216486895u\n"
+                         "imageRect XrRect2Di {\n"
+                         "offset XrOffset2Di {\nx = -16\ny = 2147483647\n}\n"
+                         "extent XrExtent2Di {\nwidth = 1440\nheight = 1600\n}\n"
+                         "}\n"
+                         "imageArrayIndex = 4294967295u\n"
+                         "}\n"
+                         "}\n"
+                         "}\n"
+                         "}\n") != std::string::npos);
+}
+
+// Frame of every call and the summary xrEndFrame sends.
+struct FrameVisitor : TraceVisitor
+{
+    // Function name and frame, by thread.
+    std::unordered_map<uint32_t, std::vector<std::string>> calls;
+    std::vector<FrameSummary> summaries;
+    uint32_t threadIndex = 0;
+    std::string funcName;
+
+    void OnStartFunctionCall(uint32_t thread, StringSpan name) override
+    {
+        threadIndex = thread;
+        funcName = name.ToString();
+    }
+
+    void OnEndFunctionCall(StringSpan, bool startTimeKnown, uint64_t, uint64_t, uint32_t frame) override
+    {
+        calls[threadIndex].push_back(funcName + " " + (startTimeKnown ? std::to_string(frame) : "lost"));
+    }
+
+    void OnFrameSummary(const FrameSummary& summary) override
+    {
+        summaries.push_back(summary);
+    }
+};
+
+// Every call up to and including xrEndFrame belongs to the frame xrEndFrame ends, and its summary has the frame's
+// timeline and each function's calls.  Calls from other threads count towards the frame they're made in.
+static void CheckFrames(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    s_PredictedDisplayTime = 1000000000;
+    Frame(xr);
+    std::thread([&xr]() {
+        XrSpaceLocation location{};
+        location.type = XR_TYPE_SPACE_LOCATION;
+        xr.locateSpace((XrSpace)0x66, (XrSpace)0x77, 0, &location);
+    }).join();
+    Frame(xr);
+
+    RequestMetadata();
+    StartDrainedDataAccess();
+    std::vector<uint8_t> data;
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    bool more = true;
+    while (more)
+    {
+        more = GetDataForRead(&ptr, &size);
+        data.insert(data.end(), ptr, ptr + size);
+    }
+    EndDataAccess();
+
+    FrameVisitor visitor;
+    TraceDecoder decoder;
+    CHECK(decoder.Decode(data.data(), data.size(), visitor));
+
+    uint32_t mainThread = s_ThreadContext->stream->threadIndex;
+    const std::vector<std::string>& mainCalls = visitor.calls[mainThread];
+    printf("frames       %u calls, %u frame summaries\n", (uint32_t)mainCalls.size(), (uint32_t)visitor.summaries.size());
+    CHECK(visitor.summaries.size() == 2);
+    CHECK(mainCalls.size() == 2 * kCallsPerFrame);
+    CHECK(visitor.calls.size() == 2);
+    if (visitor.summaries.size() != 2 || mainCalls.size() != 2 * kCallsPerFrame || visitor.calls.size() != 2)
+        return;
+
+    const FrameSummary& first = visitor.summaries[0];
+    const FrameSummary& second = visitor.summaries[1];
+    CHECK(second.frame == first.frame + 1);
+    std::string frame = " " + std::to_string(first.frame);
+    CHECK(mainCalls[0] == "xrPollEvent" + frame);
+    CHECK(mainCalls[kCallsPerFrame - 1] == "xrEndFrame" + frame);
+    frame = " " + std::to_string(second.frame);
+    CHECK(mainCalls[kCallsPerFrame] == "xrPollEvent" + frame);
+    CHECK(mainCalls[2 * kCallsPerFrame - 1] == "xrEndFrame" + frame);
+    for (const auto& thread : visitor.calls)
+    {
+        if (thread.first != mainThread)
+            CHECK(thread.second.size() == 1 && thread.second[0] == "xrLocateSpace" + frame);
+    }
+
+    CHECK(first.predictedDisplayTime == 1011111111);
+    CHECK(second.predictedDisplayTime == 1022222222);
+    CHECK(second.predictedDisplayPeriod == 11111111);
+    CHECK(second.submittedDisplayTime == second.predictedDisplayTime);
+    CHECK(first.waitStart + first.waitDuration <= first.beginStart);
+    CHECK(first.beginStart <= first.endStart);
+    CHECK(first.endStart + first.endDuration <= second.waitStart);
+
+    std::unordered_map<std::string, uint64_t> calls;
+    for (const FrameSummary::FunctionTime& function : second.functions)
+        calls[function.funcName] = function.calls;
+    CHECK(second.functions.size() == 6);
+    CHECK(calls["xrWaitFrame"] == 1);
+    CHECK(calls["xrLocateSpace"] == 2);
+    CHECK(calls["xrLocateViews"] == 2);
+    CHECK(calls["xrEndFrame"] == 1);
+}
+
+// Decoding a command at a time, the way the trace tools walk large files, gives the same calls as decoding in one go.
+static void CheckDecodeInPieces(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    s_PredictedDisplayTime = 1000000000;
+    for (uint32_t i = 0; i < 3; ++i)
+        Frame(xr);
+
+    RequestMetadata();
+    StartDrainedDataAccess();
+    std::vector<uint8_t> data;
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    bool more = true;
+    while (more)
+    {
+        more = GetDataForRead(&ptr, &size);
+        data.insert(data.end(), ptr, ptr + size);
+    }
+    EndDataAccess();
+
+    TranscriptVisitor whole;
+    TraceDecoder decoder;
+    CHECK(decoder.Decode(data.data(), data.size(), whole));
+
+    TranscriptVisitor pieces;
+    TraceDecoder piecewise;
+    size_t offset = 0;
+    uint32_t steps = 0;
+    while (offset < data.size())
+    {
+        size_t decoded = 0;
+        bool ok = piecewise.DecodeSome(data.data() + offset, data.size() - offset, 1, pieces, decoded);
+        CHECK(ok && decoded != 0);
+        if (!ok || decoded == 0)
+            break;
+        offset += decoded;
+        ++steps;
+    }
+
+    printf("pieces       %u bytes in %u steps\n", (uint32_t)data.size(), steps);
+    CHECK(steps > 3 * kCallsPerFrame);
+    CHECK(pieces.text == whole.text);
+}
+
+// Captured frames export as a complete event per call and per frame, with array elements kept apart and the JSON
+// brackets balanced.
+static void CheckChromeExport(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    s_PredictedDisplayTime = 1000000000;
+    Frame(xr);
+    Frame(xr);
+
+    RequestMetadata();
+    StartDrainedDataAccess();
+    std::vector<uint8_t> data;
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    bool more = true;
+    while (more)
+    {
+        more = GetDataForRead(&ptr, &size);
+        data.insert(data.end(), ptr, ptr + size);
+    }
+    EndDataAccess();
+
+    FILE* file = tmpfile();
+    CHECK(file != nullptr);
+    if (file == nullptr)
+        return;
+    TraceDecoder decoder;
+    ChromeTraceWriter writer(file);
+    CHECK(decoder.Decode(data.data(), data.size(), writer));
+    CHECK(writer.Finish());
+    CHECK(writer.LostCalls() == 0);
+
+    std::string json;
+    rewind(file);
+    char buffer[4096];
+    size_t read = 0;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) != 0)
+        json.append(buffer, read);
+    fclose(file);
+
+    uint32_t events = 0;
+    for (size_t at = json.find("\"ph\":\"X\""); at != std::string::npos; at = json.find("\"ph\":\"X\"", at + 1))
+        ++events;
+    int32_t depth = 0;
+    bool balanced = true;
+    bool inString = false;
+    for (size_t i = 0; i < json.size(); ++i)
+    {
+        char c = json[i];
+        if (inString)
+        {
+            if (c == '\\')
+                ++i;
+            else if (c == '"')
+                inString = false;
+        }
+        else if (c == '"')
+            inString = true;
+        else if (c == '{' || c == '[')
+            ++depth;
+        else if (c == '}' || c == ']')
+            balanced = --depth >= 0 && balanced;
+    }
+
+    printf("chrome       %u events in %u bytes\n", events, (uint32_t)json.size());
+    CHECK(events == 2 * kCallsPerFrame + 2);
+    CHECK(balanced && depth == 0 && !inString);
+    CHECK(json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") == 0);
+    CHECK(json.find("\"name\":\"thread_name\",\"ph\":\"M\"") != std::string::npos);
+    CHECK(json.find("\"name\":\"xrLocateViews\",\"cat\":\"openxr\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("\"result\":\"XR_ERROR_SIZE_INSUFFICIENT\"") != std::string::npos);
+    CHECK(json.find("\"views\":{\"type\":\"XR_TYPE_VIEW\"") != std::string::npos);
+    CHECK(json.find("\"views[1]\":{\"type\":\"XR_TYPE_VIEW\"") != std::string::npos);
+    CHECK(json.find("\"cat\":\"frame\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("\"predictedDisplayTime\":1022222222") != std::string::npos);
+}
+
+static std::string CaptureSwapchainImages(const HookedFunctions& xr)
+{
+    XrSwapchainImageBaseHeader images[3] = {};
+    uint32_t imageCount = 0;
+    xr.enumerateSwapchainImages((XrSwapchain)0x88, 3, &imageCount, images);
+    return CaptureTranscript(xr, 0);
+}
+
+// Calls formatted on the formatter thread decode to exactly what formatting them on the calling thread gives, including
+// across switches between the two and arrays of base structs, and their arena space is released once they've been read.
+static void CheckDeferredFormatting(const HookedFunctions& xr)
+{
+    const uint32_t kFrames = 20;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    std::string inlineCalls = CaptureTranscript(xr, kFrames);
+    SetDeferredFormatting(true);
+    std::string deferredCalls = CaptureTranscript(xr, kFrames);
+    SetDeferredFormatting(false);
+    std::string inlineAgain = CaptureTranscript(xr, kFrames);
+
+    std::string inlineImages = CaptureSwapchainImages(xr);
+    SetDeferredFormatting(true);
+    std::string deferredImages = CaptureSwapchainImages(xr);
+    SetDeferredFormatting(false);
+
+    uint32_t arenaBytes = CaptureArenaBytes();
+
+    printf("deferred     %u transcript bytes, %u arena bytes left after read\n", (uint32_t)deferredCalls.size(), arenaBytes);
+    CHECK(!inlineCalls.empty());
+    CHECK(deferredCalls == inlineCalls);
+    CHECK(inlineAgain == inlineCalls);
+    CHECK(inlineImages.find("imageCountOutput = 3u\nimages = ") != std::string::npos);
+    CHECK(deferredImages == inlineImages);
+    CHECK(arenaBytes == 0);
+}
+
+// Calls recorded with their inputs send them before kCallOutputs, as the app passed them, formatted inline or deferred.
+static void CheckRecordedInputs(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    SetRecordInputs(true);
+    std::string inlineCalls = CaptureTranscript(xr, 2);
+    SetDeferredFormatting(true);
+    std::string deferredCalls = CaptureTranscript(xr, 2);
+    SetDeferredFormatting(false);
+    SetRecordInputs(false);
+    std::string outputsOnly = CaptureTranscript(xr, 2);
+
+    size_t outputs = 0;
+    for (size_t pos = inlineCalls.find("outputs\n"); pos != std::string::npos; pos = inlineCalls.find("outputs\n", pos + 1))
+        ++outputs;
+
+    printf("inputs       %u transcript bytes with inputs, %u without\n", (uint32_t)inlineCalls.size(), (uint32_t)outputsOnly.size());
+    CHECK(outputs == 2 * kCallsPerFrame);
+    CHECK(deferredCalls == inlineCalls);
+    CHECK(outputsOnly.find("outputs\n") == std::string::npos);
+    CHECK(inlineCalls.find("xrWaitFrame(\n"
+                           "session = 85u\n"
+                           "frameWaitInfo XrFrameWaitInfo {\n"
+                           "type = XrStructureType XR_TYPE_FRAME_WAIT_INFO\n"
+                           "next = 0u\n"
+                           "}\n"
+                           "frameState XrFrameState {\n"
+                           "type = XrStructureType XR_TYPE_FRAME_STATE\n"
+                           "next = 0u\n"
+                           "predictedDisplayTime = 0\n") != std::string::npos);
+    CHECK(inlineCalls.find("xrPollEvent(\n"
+                           "instance = 1u\n"
+                           "varying = XrStructureType XR_TYPE_EVENT_DATA_BUFFER\n"
+                           "outputs\n"
+                           "instance = 1u\n"
+                           "varying XrEventDataSessionStateChanged {\n") == 0);
+}
+
+static bool EndsWith(const std::string& text, const char* end)
+{
+    size_t size = strlen(end);
+    return text.size() >= size && text.compare(text.size() - size, size, end) == 0;
+}
+
+// A failing call freezes the calls leading up to it, and nothing replaces them until the recorder is rearmed.
+// The flight recorder thread makes the copy, give it up to a few seconds.
+static bool WaitForSnapshots(uint64_t snapshots)
+{
+    for (uint32_t i = 0; i < 5000; ++i)
+    {
+        FlightRecorderStats stats;
+        GetFlightRecorderStats(&stats);
+        if (stats.snapshots >= snapshots)
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static void CheckFlightRecorder(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+    // New keyframes, so the snapshot decodes from its first call.
+    RequestMetadata();
+
+    CHECK(StartFlightRecorder(0, nullptr));
+    SetFreezeOnError(true);
+    // The first xrLocateViews of each frame only asks for the view count.  The snapshot may run on to the end of the
+    // frame, but not into the next one.
+    Frame(xr);
+    CHECK(WaitForSnapshots(1));
+    Frame(xr);
+    Frame(xr);
+    SetFreezeOnError(false);
+
+    FlightRecorderStats stats;
+    GetFlightRecorderStats(&stats);
+    uint8_t* ptr = nullptr;
+    uint32_t size = 0;
+    FreezeCause cause;
+    CHECK(StartSnapshotAccess(&ptr, &size, &cause));
+    TranscriptVisitor errorCalls;
+    TraceDecoder decoder;
+    CHECK(decoder.Decode(ptr, size, errorCalls));
+    EndSnapshotAccess();
+
+    CHECK(stats.snapshots == 1);
+    CHECK(stats.missedTriggers == 2);
+    CHECK(cause.trigger == kFreezeOnError);
+    CHECK(cause.functionId == kFunc_xrLocateViews);
+    CHECK(cause.result == XR_ERROR_SIZE_INSUFFICIENT);
+    CHECK(errorCalls.text.find("xrPollEvent(\n") == 0);
+    CHECK(errorCalls.text.find(") = XR_ERROR_SIZE_INSUFFICIENT\n") != std::string::npos);
+    CHECK(errorCalls.text.find("xrWaitFrame(\n") == errorCalls.text.rfind("xrWaitFrame(\n"));
+
+    RearmFlightRecorder();
+    SetFreezeOnFrameInterval(1);
+    Frame(xr);
+    CHECK(WaitForSnapshots(2));
+    SetFreezeOnFrameInterval(0);
+
+    CHECK(StartSnapshotAccess(&ptr, &size, &cause));
+    TranscriptVisitor frameCalls;
+    CHECK(decoder.Decode(ptr, size, frameCalls));
+    EndSnapshotAccess();
+
+    printf("flight       %u snapshot bytes on error, %u on a long frame\n", (uint32_t)errorCalls.text.size(), (uint32_t)frameCalls.text.size());
+    CHECK(cause.trigger == kFreezeOnFrameInterval);
+    CHECK(cause.functionId == kFunc_xrEndFrame);
+    CHECK(cause.frameInterval > 0);
+    CHECK(EndsWith(frameCalls.text, ") = XR_SUCCESS\n"));
+    CHECK(frameCalls.text.rfind("xrEndFrame(\n") != std::string::npos);
+
+    // xrGetInstanceProcAddr is hooked by hand, not generated, and hits the same triggers.
+    RearmFlightRecorder();
+    SetFreezeOnFunctionFailure(kFunc_xrGetInstanceProcAddr, true);
+    PFN_xrVoidFunction function = nullptr;
+    xrGetInstanceProcAddr((XrInstance)0x1, "xrNotAFunction", &function);
+    CHECK(WaitForSnapshots(3));
+    SetFreezeOnFunctionFailure(kFunc_xrGetInstanceProcAddr, false);
+    CHECK(StartSnapshotAccess(&ptr, &size, &cause));
+    EndSnapshotAccess();
+    CHECK(cause.trigger == kFreezeOnFunctionFailure);
+    CHECK(cause.functionId == kFunc_xrGetInstanceProcAddr);
+    CHECK(cause.result == XR_ERROR_FUNCTION_UNSUPPORTED);
+
+    StopFlightRecorder();
+    CHECK(!StartSnapshotAccess(&ptr, &size, &cause));
+}
+
+// Every measured call counts towards its thread's overhead, and with a budget nothing fits in, every frame is reported.
+static void CheckOverhead(const HookedFunctions& xr)
+{
+    const uint32_t kFrames = 10;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+    ResetStats();
+    SetMeasureOverhead(true);
+
+    for (uint32_t i = 0; i < kFrames; ++i)
+        Frame(xr);
+    // Measured like every other hook.
+    PFN_xrVoidFunction function = nullptr;
+    xrGetInstanceProcAddr((XrInstance)0x1, "xrWaitFrame", &function);
+
+    std::vector<ThreadOverheadSnapshot> snapshots(GetThreadCount());
+    snapshots.resize(GetOverheadSnapshot(snapshots.data(), (uint32_t)snapshots.size()));
+    uint32_t mainThread = s_ThreadContext->stream->threadIndex;
+    const ThreadOverheadSnapshot* main = nullptr;
+    for (const ThreadOverheadSnapshot& snapshot : snapshots)
+    {
+        if (snapshot.threadIndex == mainThread)
+            main = &snapshot;
+    }
+    CHECK(main != nullptr);
+    if (main == nullptr)
+        return;
+
+    uint64_t histogramCalls = 0;
+    for (uint32_t count : main->overheadHistogram)
+        histogramCalls += count;
+    CHECK(main->calls == kFrames * kCallsPerFrame + 1);
+    CHECK(histogramCalls == main->calls);
+    CHECK(main->overheadTime > 0);
+    CHECK(main->p50Overhead <= main->p99Overhead && main->p99Overhead <= main->maxOverhead);
+    CHECK(main->maxOverhead <= main->overheadTime);
+    CHECK(main->lockWaits == 0);
+
+    SetOverheadBudget(1);
+    for (uint32_t i = 0; i < kFrames; ++i)
+        Frame(xr);
+    SetOverheadBudget(0);
+    Frame(xr);
+    SetMeasureOverhead(false);
+
+    ThreadVisitor visitor;
+    ReadCapturedThreads(visitor);
+
+    printf("overhead     %.3f us per call, %.3f us in the runtime, %u reports\n", main->overheadTime / 1e3 / main->calls,
+        main->runtimeTime / 1e3 / main->calls, (uint32_t)visitor.overheadReports.size());
+    // The first frame with a budget has nothing to compare against.
+    CHECK(visitor.overheadReports.size() == kFrames - 1);
+    for (const OverheadReport& report : visitor.overheadReports)
+    {
+        CHECK(report.budget == 1);
+        CHECK(report.calls == kCallsPerFrame);
+        CHECK(report.overhead > report.budget);
+        CHECK(report.drainTime + report.lockWaitTime <= report.overhead);
+    }
+    for (size_t i = 1; i < visitor.overheadReports.size(); ++i)
+        CHECK(visitor.overheadReports[i].frame == visitor.overheadReports[i - 1].frame + 1);
+}
+
+// With the formatter thread running, a calling thread never drains, even when it makes calls faster than the formatter
+// keeps up and some of them are serialized on the calling thread after all.
+static void CheckFormatterDrains(const HookedFunctions& xr)
+{
+    const uint32_t kFrames = 5000;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+    ResetStats();
+    SetMeasureOverhead(true);
+    SetDeferredFormatting(true);
+
+    for (uint32_t i = 0; i < kFrames; ++i)
+        Frame(xr);
+
+    std::vector<ThreadOverheadSnapshot> snapshots(GetThreadCount());
+    snapshots.resize(GetOverheadSnapshot(snapshots.data(), (uint32_t)snapshots.size()));
+    SetDeferredFormatting(false);
+    SetMeasureOverhead(false);
+    ReadCapturedThreads(discard);
+
+    uint32_t mainThread = s_ThreadContext->stream->threadIndex;
+    const ThreadOverheadSnapshot* main = nullptr;
+    for (const ThreadOverheadSnapshot& snapshot : snapshots)
+    {
+        if (snapshot.threadIndex == mainThread)
+            main = &snapshot;
+    }
+    CHECK(main != nullptr);
+    if (main == nullptr)
+        return;
+
+    printf("formatter    %llu drains, %llu contended on the calling thread in %u calls\n", (unsigned long long)main->drains,
+        (unsigned long long)main->contendedDrains, kFrames * kCallsPerFrame);
+    CHECK(main->calls == kFrames * kCallsPerFrame);
+    CHECK(main->drains == 0 && main->contendedDrains == 0);
+}
+
+// Short lived threads reuse the buffers of the ones that exited, and their calls still decode with the right names.
+static void CheckThreadChurn(const HookedFunctions& xr)
+{
+    const uint32_t kThreads = 50;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    std::thread([&xr]() {
+        Frame(xr);
+    }).join();
+    MemoryStats before = GetMemory();
+
+    for (uint32_t i = 0; i < kThreads; ++i)
+    {
+        std::thread([&xr]() {
+            SetThreadName("churn");
+            for (uint32_t frame = 0; frame < 10; ++frame)
+                Frame(xr);
+        }).join();
+    }
+    MemoryStats after = GetMemory();
+
+    printf("thread churn %u threads, %u streams, %llu bytes before, %llu after, %llu high water\n", kThreads, after.streams,
+           (unsigned long long)before.currentBytes, (unsigned long long)after.currentBytes, (unsigned long long)after.highWaterBytes);
+    CHECK(after.streams == before.streams);
+    CHECK(after.freeStreams == before.freeStreams);
+    CHECK(after.currentBytes == before.currentBytes);
+    CHECK(after.highWaterBytes >= after.currentBytes);
+
+    ThreadVisitor visitor;
+    ReadCapturedThreads(visitor);
+    CHECK(visitor.unnamedCalls == 0);
+    CHECK(visitor.callsByName["churn"] == kThreads * 10 * kCallsPerFrame);
+}
+
+// Streams left in the pool are freed with everything they hold, and queues follow a new perThreadCacheSize once the
+// reader has emptied them.
+static void CheckPooledStreams(const HookedFunctions& xr)
+{
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    std::thread([&xr]() {
+        SetThreadName("pooled");
+        Frame(xr);
+    }).join();
+    MemoryStats before = GetMemory();
+    ReleasePooledStreams();
+    MemoryStats after = GetMemory();
+
+    printf("pooled       %u streams freed, %llu bytes before, %llu after\n", before.freeStreams,
+           (unsigned long long)before.currentBytes, (unsigned long long)after.currentBytes);
+    CHECK(before.freeStreams != 0);
+    CHECK(after.freeStreams == 0);
+    CHECK(after.streams == before.streams - before.freeStreams);
+    CHECK(after.currentBytes < before.currentBytes);
+
+    // The freed thread's calls still go out under its name.
+    ThreadVisitor visitor;
+    ReadCapturedThreads(visitor);
+    CHECK(visitor.unnamedCalls == 0);
+    CHECK(visitor.callsByName["pooled"] == kCallsPerFrame);
+
+    std::thread([&xr]() {
+        Frame(xr);
+    }).join();
+    CHECK(GetMemory().streams == after.streams + 1);
+
+    CallStream* stream = s_ThreadContext->stream;
+    uint64_t streamBytes = GetMemory().streamBytes;
+    uint32_t oldSize = s_PerThreadCacheSize;
+    s_PerThreadCacheSize = oldSize * 4;
+    ReadCapturedThreads(discard);
+    Frame(xr);
+    CHECK(stream->queue.capacity == ThreadQueue::CapacityFor(oldSize * 4));
+    CHECK(GetMemory().streamBytes > streamBytes);
+
+    s_PerThreadCacheSize = oldSize;
+    ReadCapturedThreads(discard);
+    Frame(xr);
+    CHECK(stream->queue.capacity == ThreadQueue::CapacityFor(oldSize));
+    CHECK(GetMemory().streamBytes == streamBytes);
+    ReadCapturedThreads(discard);
+}
+
+// With room for one more stream, the extra threads share the overflow stream and nothing is lost.
+static void CheckMemoryBudget(const HookedFunctions& xr)
+{
+    const uint32_t kThreads = 4;
+    const uint32_t kFrames = 100;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    // One stream is already free from the churn test.
+    MemoryStats before = GetMemory();
+    uint64_t droppedBefore = QueueDroppedRecords();
+    CHECK(before.freeStreams == 1);
+    uint32_t oldBudget = s_ThreadMemoryBudget;
+    s_ThreadMemoryBudget = (uint32_t)(before.streamBytes + StreamBytes(s_PerThreadCacheSize));
+
+    std::atomic<uint32_t> started{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kThreads; ++i)
+    {
+        threads.emplace_back([&xr, &started, &go]() {
+            Frame(xr);
+            started.fetch_add(1);
+            while (!go.load())
+                std::this_thread::yield();
+            for (uint32_t frame = 1; frame < kFrames; ++frame)
+                Frame(xr);
+        });
+    }
+    while (started.load() != kThreads)
+        std::this_thread::yield();
+
+    MemoryStats during = GetMemory();
+    go = true;
+    for (auto& thread : threads)
+        thread.join();
+    MemoryStats after = GetMemory();
+    s_ThreadMemoryBudget = oldBudget;
+
+    printf("budget       %llu of %llu bytes, %u streams, %u threads over budget\n", (unsigned long long)during.streamBytes,
+           (unsigned long long)during.streamBudget, during.streams, during.overflowThreads);
+    CHECK(during.streamBytes <= during.streamBudget);
+    CHECK(during.streams == before.streams + 1);
+    CHECK(during.overflowThreads == kThreads - 2);
+    CHECK(after.overflowThreads == 0);
+    CHECK(after.freeStreams == 2);
+
+    ThreadVisitor visitor;
+    ReadCapturedThreads(visitor);
+    CHECK(visitor.unnamedCalls == 0);
+    // Every xrEndFrame sends a frame summary as well.
+    CHECK(visitor.calls + visitor.frameSummaries + (QueueDroppedRecords() - droppedBefore) == kThreads * kFrames * (kCallsPerFrame + 1));
+    // At least the first frame, the rest move to their own stream as other threads exit.
+    CHECK(visitor.callsByName["over budget"] >= (kThreads - 2) * kCallsPerFrame);
+}
+
+// A call several times the size of the thread's record buffer spills and arrives whole, unless the spill budget is too small.
+static void CheckLargeCalls(const HookedFunctions& xr)
+{
+    const uint32_t kViews = 4000;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    XrViewLocateInfo viewLocateInfo{XR_TYPE_VIEW_LOCATE_INFO, nullptr, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, 0, (XrSpace)0x77};
+    XrViewState viewState{XR_TYPE_VIEW_STATE, nullptr, 0};
+    XrView view{};
+    view.type = XR_TYPE_VIEW;
+    std::vector<XrView> views(kViews, view);
+    uint32_t viewCount = 0;
+
+    MemoryStats before = GetMemory();
+    xr.locateViews((XrSession)0x55, &viewLocateInfo, &viewState, kViews, &viewCount, views.data());
+    MemoryStats spilled = GetMemory();
+
+    ThreadVisitor visitor;
+    ReadCapturedThreads(visitor);
+    MemoryStats drained = GetMemory();
+
+    printf("large call   %u views, %llu spill bytes held until drained\n", visitor.views, (unsigned long long)spilled.spillBytes);
+    CHECK(visitor.views == kViews);
+    CHECK(visitor.cacheNotLargeEnough == 0);
+    CHECK(spilled.spilledCalls == before.spilledCalls + 1);
+    CHECK(spilled.spillBytes > s_PerThreadCacheSize);
+    CHECK(drained.spillBytes == 0);
+    CHECK(drained.currentBytes == before.currentBytes);
+
+    uint32_t oldBudget = s_SpillBudget;
+    s_SpillBudget = kSpillBlockSize;
+    xr.locateViews((XrSession)0x55, &viewLocateInfo, &viewState, kViews, &viewCount, views.data());
+    s_SpillBudget = oldBudget;
+
+    ThreadVisitor overBudget;
+    ReadCapturedThreads(overBudget);
+    CHECK(overBudget.cacheNotLargeEnough == 1);
+    CHECK(GetMemory().droppedSpilledCalls == before.droppedSpilledCalls + 1);
+    CHECK(GetMemory().spillBytes == 0);
+}
+
+#if !defined(_WIN32)
+// The decoder needs every file's name, enum and schema tables, and the kThreadInfo before each thread's first call.
+struct TraceFileVisitor : ThreadVisitor
+{
+    uint32_t unnamedFunctions = 0;
+    uint32_t unnamedResults = 0;
+
+    void OnStartFunctionCall(uint32_t threadIndex, StringSpan funcName) override
+    {
+        ThreadVisitor::OnStartFunctionCall(threadIndex, funcName);
+        if (funcName.size < 2 || strncmp(funcName.data, "xr", 2) != 0)
+            ++unnamedFunctions;
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool, uint64_t, uint64_t, uint32_t) override
+    {
+        if (result.size < 3 || strncmp(result.data, "XR_", 3) != 0)
+            ++unnamedResults;
+    }
+};
+
+static std::vector<uint8_t> ReadWholeFile(const std::string& path)
+{
+    std::vector<uint8_t> data;
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return data;
+    uint8_t buffer[4096];
+    size_t read = 0;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        data.insert(data.end(), buffer, buffer + read);
+    fclose(file);
+    return data;
+}
+
+static uint64_t CurrentFileSequence()
+{
+    std::lock_guard<std::mutex> lock(s_DataMutex);
+    return s_FileSegment.sequence;
+}
+
+// Small files rotate every few frames and only the last maxFiles are kept.  Each one decodes on its own, and one whose
+// header was last updated partway through decodes up to where the header says.
+static void CheckFileSink(const HookedFunctions& xr)
+{
+    const uint32_t kMaxFiles = 2;
+    const uint64_t kRotations = 4;
+    ThreadVisitor discard;
+    ReadCapturedThreads(discard);
+
+    char directory[] = "/tmp/write_path_tests_XXXXXX";
+    CHECK(mkdtemp(directory) != nullptr);
+    // The smallest size allowed, the tables plus a page.
+    CHECK(StartFileSink(directory, 0, kMaxFiles));
+    uint64_t firstSequence = CurrentFileSequence();
+
+    // The flusher maps the next file every kFileSinkFlushIntervalMs, records that come before it's ready are dropped.
+    for (uint32_t i = 0; i < 1000 && CurrentFileSequence() < firstSequence + kRotations; ++i)
+    {
+        Frame(xr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    uint64_t lastSequence = CurrentFileSequence();
+    StopFileSink();
+
+    std::vector<std::string> paths;
+    DIR* dir = opendir(directory);
+    CHECK(dir != nullptr);
+    while (dirent* entry = dir != nullptr ? readdir(dir) : nullptr)
+    {
+        if (entry->d_name[0] != '.')
+            paths.push_back(std::string(directory) + "/" + entry->d_name);
+    }
+    if (dir != nullptr)
+        closedir(dir);
+    std::sort(paths.begin(), paths.end());
+
+    CHECK(lastSequence >= firstSequence + kRotations);
+    CHECK(paths.size() == kMaxFiles);
+    for (uint64_t sequence = firstSequence; sequence <= lastSequence; ++sequence)
+        CHECK((access(TraceFilePath(sequence).c_str(), F_OK) == 0) == (sequence + kMaxFiles > lastSequence));
+
+    uint32_t calls = 0;
+    std::vector<uint8_t> last;
+    for (const std::string& path : paths)
+    {
+        last = ReadWholeFile(path);
+        TraceFileVisitor visitor;
+        TraceDecoder decoder;
+        CHECK(decoder.DecodeFile(last.data(), last.size(), visitor));
+        CHECK(visitor.calls > 0);
+        CHECK(visitor.unnamedCalls == 0);
+        CHECK(visitor.unnamedFunctions == 0);
+        CHECK(visitor.unnamedResults == 0);
+        CHECK(visitor.views > 0);
+        calls += visitor.calls;
+        unlink(path.c_str());
+    }
+    rmdir(directory);
+
+    // As if the process died while a record was being copied in: the header stops at a record boundary partway
+    // through, and what comes after it is garbage.
+    TraceFileHeader header;
+    CHECK(last.size() > sizeof(header));
+    memcpy(&header, last.data(), sizeof(header));
+    const uint8_t* records = last.data() + header.headerSize;
+    TraceFileVisitor untilCut;
+    TraceDecoder cutDecoder;
+    size_t cut = 0;
+    while (cut < header.dataSize && untilCut.calls < calls / (2 * kMaxFiles))
+    {
+        size_t decoded = 0;
+        bool ok = cutDecoder.DecodeSome(records + cut, header.dataSize - cut, 1, untilCut, decoded);
+        CHECK(ok && decoded != 0);
+        if (!ok || decoded == 0)
+            break;
+        cut += decoded;
+    }
+    CHECK(cut < header.dataSize);
+    header.dataSize = cut;
+    memcpy(last.data(), &header, sizeof(header));
+    memset(last.data() + header.headerSize + cut, 0xFF, last.size() - header.headerSize - cut);
+
+    TraceFileVisitor partial;
+    TraceDecoder partialDecoder;
+    CHECK(partialDecoder.DecodeFile(last.data(), last.size(), partial));
+    printf("file sink    %u files rotated, %u calls in the last %u, %u of them before the cut\n", (uint32_t)(lastSequence - firstSequence), calls, kMaxFiles, partial.calls);
+    CHECK(partial.calls == untilCut.calls);
+    CHECK(partial.calls > 0);
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr = HookXrInstanceProcAddr(FakeGetInstanceProcAddr, 1024 * 1024, 64 * 1024, kDefaultThreadMemoryBudget, kDefaultSpillBudget);
+
+    HookedFunctions xr;
+    xr.pollEvent = Resolve<PFN_xrPollEvent>(getInstanceProcAddr, "xrPollEvent");
+    xr.waitFrame = Resolve<PFN_xrWaitFrame>(getInstanceProcAddr, "xrWaitFrame");
+    xr.beginFrame = Resolve<PFN_xrBeginFrame>(getInstanceProcAddr, "xrBeginFrame");
+    xr.endFrame = Resolve<PFN_xrEndFrame>(getInstanceProcAddr, "xrEndFrame");
+    xr.locateSpace = Resolve<PFN_xrLocateSpace>(getInstanceProcAddr, "xrLocateSpace");
+    xr.locateViews = Resolve<PFN_xrLocateViews>(getInstanceProcAddr, "xrLocateViews");
+    xr.enumerateSwapchainImages = Resolve<PFN_xrEnumerateSwapchainImages>(getInstanceProcAddr, "xrEnumerateSwapchainImages");
+
+    bool bench = argc < 2 || strcmp(argv[1], "--no-bench") != 0;
+    const struct
+    {
+        CaptureMode mode;
+        bool deferred;
+        const char* name;
+    } kModes[] = {{kCaptureModeFull, false, "full"}, {kCaptureModeFull, true, "deferred"}, {kCaptureModeStatistics, false, "statistics"}};
+
+    // In deferred mode only the calling thread is checked and timed, formatting happens on the formatter thread.
+    for (const auto& mode : kModes)
+    {
+        SetCaptureMode(mode.mode);
+        SetDeferredFormatting(mode.deferred);
+        CheckNoAllocations(xr, mode.name);
+        if (bench)
+            Benchmark(xr, mode.name);
+    }
+    if (bench)
+    {
+        SetCaptureMode(kCaptureModeFull);
+        SetDeferredFormatting(false);
+        BenchmarkReaderContention(xr);
+    }
+    if (bench)
+    {
+        SetDeferredFormatting(true);
+        BenchmarkPaced(xr, "deferred, 10 frame bursts");
+    }
+    SetDeferredFormatting(false);
+    SetCaptureMode(kCaptureModeFull);
+    if (bench)
+        BenchmarkDecode(xr);
+
+    CheckEnums(xr);
+    CheckStructs(xr);
+    CheckFrames(xr);
+    CheckDecodeInPieces(xr);
+    CheckChromeExport(xr);
+    CheckDeferredFormatting(xr);
+    CheckRecordedInputs(xr);
+    CheckFlightRecorder(xr);
+#if !defined(_WIN32)
+    CheckFileSink(xr);
+#endif
+    CheckOverhead(xr);
+    CheckFormatterDrains(xr);
+    CheckThreadChurn(xr);
+    CheckMemoryBudget(xr);
+    CheckLargeCalls(xr);
+    CheckPooledStreams(xr);
+
+    if (s_Failures != 0)
+    {
+        printf("%d checks failed\n", s_Failures);
+        return 1;
+    }
+    printf("all tests passed\n");
+    return 0;
+}
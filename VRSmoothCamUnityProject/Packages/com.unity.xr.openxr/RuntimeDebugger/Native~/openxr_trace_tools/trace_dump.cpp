@@ -0,0 +1,557 @@
+// Prints runtime debugger captures without the editor: as text, as JSON Lines or as CSV.
+// Build and run with for example:
+//   g++ -std=c++14 -O2 trace_dump.cpp -o trace_dump
+//   ./trace_dump --format jsonl --function xrEndFrame --frame 100-200 /sdcard/traces/openxr_trace_1234_*.oxrt
+// Inputs are trace files from StartFileSink or raw payloads saved from GetDataForRead, decoded in the order given.
+// --function and --thread pick calls, --frame picks calls, frame summaries and overhead reports.  CSV has a row per
+// call and no arguments.  Returns non-zero if an input can't be decoded or the output can't be written.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "../openxr_runtime_debugger/trace_json.h"
+#include "trace_file_reader.h"
+
+enum DumpFormat
+{
+    kFormatText,
+    kFormatJsonLines,
+    kFormatCsv,
+};
+
+struct DumpFilter
+{
+    // Empty for every function or thread.
+    std::vector<std::string> functions;
+    std::unordered_set<uint32_t> threads;
+    uint64_t firstFrame = 0;
+    uint64_t lastFrame = UINT64_MAX;
+
+    bool Function(StringSpan funcName) const
+    {
+        if (functions.empty())
+            return true;
+        for (const std::string& function : functions)
+        {
+            if (funcName == StringSpan(function.data(), function.size()))
+                return true;
+        }
+        return false;
+    }
+
+    bool Thread(uint32_t threadIndex) const
+    {
+        return threads.empty() || threads.count(threadIndex) != 0;
+    }
+
+    bool Frame(uint64_t frame) const
+    {
+        return frame >= firstFrame && frame <= lastFrame;
+    }
+
+    bool AllFrames() const
+    {
+        return firstFrame == 0 && lastFrame == UINT64_MAX;
+    }
+};
+
+class DumpWriter final : public JsonArgsWriter
+{
+public:
+    DumpWriter(FILE* out, DumpFormat format, const DumpFilter& filter) :
+        out(out), format(format), filter(filter)
+    {
+        if (format == kFormatCsv)
+            fputs("frame,thread,function,result,start_ns,duration_ns,cache_not_large_enough\n", out);
+    }
+
+    void OnThreadInfo(uint32_t threadIndex, uint64_t osThreadId, StringSpan threadName) override
+    {
+        if (!filter.Thread(threadIndex))
+            return;
+
+        if (format == kFormatText)
+        {
+            line = "thread " + std::to_string(threadIndex) + " = " + threadName.ToString() + " (" + std::to_string(osThreadId) + ")\n";
+            Write();
+        }
+        else if (format == kFormatJsonLines)
+        {
+            line = "{\"type\":\"thread\",\"thread\":" + std::to_string(threadIndex) + ",\"osThreadId\":";
+            AppendJsonUInt(line, osThreadId);
+            line += ",\"name\":";
+            AppendJsonString(line, threadName);
+            line += "}\n";
+            Write();
+        }
+    }
+
+    void OnStartFunctionCall(uint32_t threadIndex, StringSpan funcName) override
+    {
+        // The frame is only known at the end, everything else is filtered here so skipped calls aren't formatted.
+        skipping = !filter.Thread(threadIndex) || !filter.Function(funcName);
+        if (skipping)
+            return;
+
+        JsonArgsWriter::OnStartFunctionCall(threadIndex, funcName);
+        callThread = threadIndex;
+        callName.assign(funcName.data, funcName.size);
+        indent = 1;
+    }
+
+    void OnStartStruct(StringSpan fieldName, StringSpan structName) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnStartStruct(fieldName, structName);
+            return;
+        }
+        Indent();
+        args.append(fieldName.data, fieldName.size);
+        args += ' ';
+        args.append(structName.data, structName.size);
+        args += " {\n";
+        ++indent;
+    }
+
+    void OnEndStruct() override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnEndStruct();
+            return;
+        }
+        if (indent > 1)
+            --indent;
+        Indent();
+        args += "}\n";
+    }
+
+    void OnCallOutputs() override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnCallOutputs();
+            return;
+        }
+        // Everything so far was the call's inputs.
+        args.insert(0, "  inputs:\n");
+        indent = 1;
+        Indent();
+        args += "outputs:\n";
+    }
+
+    void OnFloat(StringSpan fieldName, float value) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnFloat(fieldName, value);
+            return;
+        }
+        TextKey(fieldName);
+        AppendFloat(args, value);
+        args += '\n';
+    }
+
+    void OnString(StringSpan fieldName, StringSpan value) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnString(fieldName, value);
+            return;
+        }
+        TextKey(fieldName);
+        args += '"';
+        args.append(value.data, value.size);
+        args += "\"\n";
+    }
+
+    void OnInt(StringSpan fieldName, int64_t value) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnInt(fieldName, value);
+            return;
+        }
+        TextKey(fieldName);
+        AppendJsonInt(args, value);
+        args += '\n';
+    }
+
+    void OnUInt(StringSpan fieldName, uint64_t value) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnUInt(fieldName, value);
+            return;
+        }
+        TextKey(fieldName);
+        AppendDecimal(args, value);
+        args += '\n';
+    }
+
+    void OnEnum(StringSpan fieldName, StringSpan typeName, int32_t value, StringSpan valueName) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnEnum(fieldName, typeName, value, valueName);
+            return;
+        }
+        TextKey(fieldName);
+        args.append(valueName.data, valueName.size);
+        args += '\n';
+    }
+
+    void OnLostValue(StringSpan fieldName) override
+    {
+        if (skipping || format == kFormatCsv)
+            return;
+        if (format == kFormatJsonLines)
+        {
+            JsonArgsWriter::OnLostValue(fieldName);
+            return;
+        }
+        TextKey(fieldName);
+        args += "<lost>\n";
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool startTimeKnown, uint64_t startTime, uint64_t duration, uint32_t frame) override
+    {
+        // A call whose start time was lost doesn't know its frame either.
+        if (skipping || (startTimeKnown ? !filter.Frame(frame) : !filter.AllFrames()))
+            return;
+        CloseArgs();
+        WriteCall(callThread, StringSpan(callName.data(), callName.size()), result, startTimeKnown, startTime, duration, frame, false);
+    }
+
+    void OnCacheNotLargeEnough(uint32_t threadIndex, StringSpan funcName, StringSpan result, uint64_t startTime, uint64_t duration, uint32_t frame) override
+    {
+        if (!filter.Thread(threadIndex) || !filter.Function(funcName) || !filter.Frame(frame))
+            return;
+        args.clear();
+        WriteCall(threadIndex, funcName, result, true, startTime, duration, frame, true);
+    }
+
+    void OnDroppedData(uint64_t droppedCalls, uint64_t bytes) override
+    {
+        if (format == kFormatText)
+            line = "dropped " + std::to_string(droppedCalls) + " calls, " + std::to_string(bytes) + " bytes\n";
+        else if (format == kFormatJsonLines)
+            line = "{\"type\":\"dropped\",\"calls\":" + std::to_string(droppedCalls) + ",\"bytes\":" + std::to_string(bytes) + "}\n";
+        else
+            return;
+        Write();
+    }
+
+    void OnFrameSummary(const FrameSummary& summary) override
+    {
+        if (!filter.Frame(summary.frame))
+            return;
+
+        if (format == kFormatText)
+        {
+            char text[256];
+            snprintf(text, sizeof(text), "frame %u summary: predicted display time %lld, period %.3f ms, submitted %+lld ns, wait %.3f us @ %.3f us, begin @ %.3f us, end %.3f us @ %.3f us\n",
+                summary.frame, (long long)summary.predictedDisplayTime, summary.predictedDisplayPeriod / 1e6,
+                (long long)(summary.submittedDisplayTime - summary.predictedDisplayTime), summary.waitDuration / 1e3, summary.waitStart / 1e3,
+                summary.beginStart / 1e3, summary.endDuration / 1e3, summary.endStart / 1e3);
+            line = text;
+            for (const FrameSummary::FunctionTime& function : summary.functions)
+            {
+                snprintf(text, sizeof(text), "  %s %llu calls %.3f us\n", function.funcName.c_str(), (unsigned long long)function.calls, function.duration / 1e3);
+                line += text;
+            }
+            Write();
+        }
+        else if (format == kFormatJsonLines)
+        {
+            line = "{\"type\":\"frame\",\"summary\":";
+            AppendFrameSummary(line, summary);
+            line += "}\n";
+            Write();
+        }
+    }
+
+    void OnOverheadReport(const OverheadReport& report) override
+    {
+        if (!filter.Frame(report.frame))
+            return;
+
+        if (format == kFormatText)
+        {
+            char text[256];
+            snprintf(text, sizeof(text), "frame %u debugger over budget: %.3f us of %.3f us in %llu calls, %.3f us draining, %.3f us waiting for locks, %.3f us in the runtime\n",
+                report.frame, report.overhead / 1e3, report.budget / 1e3, (unsigned long long)report.calls, report.drainTime / 1e3,
+                report.lockWaitTime / 1e3, report.runtimeTime / 1e3);
+            line = text;
+            Write();
+        }
+        else if (format == kFormatJsonLines)
+        {
+            line = "{\"type\":\"overhead\",\"report\":";
+            AppendOverheadReport(line, report);
+            line += "}\n";
+            Write();
+        }
+    }
+
+private:
+    void Indent()
+    {
+        args.append(2 * indent, ' ');
+    }
+
+    // Starts a text line for a value.
+    void TextKey(StringSpan fieldName)
+    {
+        Indent();
+        args.append(fieldName.data, fieldName.size);
+        args += " = ";
+    }
+
+    void WriteCall(uint32_t threadIndex, StringSpan funcName, StringSpan result, bool startTimeKnown, uint64_t startTime, uint64_t duration, uint32_t frame, bool cacheNotLargeEnough)
+    {
+        char text[96];
+        if (format == kFormatText)
+        {
+            // A call whose start time was lost only has its duration.
+            if (startTimeKnown)
+                snprintf(text, sizeof(text), "frame %u thread %u @ %.3f us +%.3f us ", frame, threadIndex, startTime / 1e3, duration / 1e3);
+            else
+                snprintf(text, sizeof(text), "frame ? thread %u @ ? +%.3f us ", threadIndex, duration / 1e3);
+            line = text;
+            line.append(funcName.data, funcName.size);
+            line += " = ";
+            line.append(result.data, result.size);
+            line += cacheNotLargeEnough ? " (cache not large enough)\n" : "\n";
+            line += args;
+        }
+        else if (format == kFormatJsonLines)
+        {
+            line = "{\"type\":\"call\",\"thread\":" + std::to_string(threadIndex) + ",\"function\":";
+            AppendJsonString(line, funcName);
+            line += ",\"result\":";
+            AppendJsonString(line, result);
+            if (startTimeKnown)
+            {
+                line += ",\"frame\":" + std::to_string(frame) + ",\"startNs\":";
+                AppendJsonUInt(line, startTime);
+            }
+            else
+            {
+                line += ",\"frame\":null,\"startNs\":null";
+            }
+            line += ",\"durationNs\":";
+            AppendJsonUInt(line, duration);
+            if (cacheNotLargeEnough)
+                line += ",\"cacheNotLargeEnough\":true";
+            line += ",\"args\":{";
+            line += args;
+            line += "}}\n";
+        }
+        else
+        {
+            line.clear();
+            if (startTimeKnown)
+                line += std::to_string(frame);
+            line += ',' + std::to_string(threadIndex) + ',';
+            AppendCsv(funcName);
+            line += ',';
+            AppendCsv(result);
+            line += ',';
+            if (startTimeKnown)
+                line += std::to_string(startTime);
+            line += ',' + std::to_string(duration) + (cacheNotLargeEnough ? ",1\n" : ",0\n");
+        }
+        Write();
+    }
+
+    void AppendCsv(StringSpan value)
+    {
+        if (memchr(value.data, ',', value.size) == nullptr && memchr(value.data, '"', value.size) == nullptr)
+        {
+            line.append(value.data, value.size);
+            return;
+        }
+        line += '"';
+        for (size_t i = 0; i < value.size; ++i)
+        {
+            if (value.data[i] == '"')
+                line += '"';
+            line += value.data[i];
+        }
+        line += '"';
+    }
+
+    void Write()
+    {
+        fwrite(line.data(), 1, line.size(), out);
+    }
+
+    FILE* out;
+    DumpFormat format;
+    const DumpFilter& filter;
+    // The record being written, reused so its capacity carries over.
+    std::string line;
+
+    // The call being decoded.
+    bool skipping = false;
+    uint32_t callThread = 0;
+    std::string callName;
+    // Indent of the next text line.
+    size_t indent = 1;
+};
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+        "usage: trace_dump [options] input...\n"
+        "  --format text|jsonl|csv  output format, text by default\n"
+        "  --function name          only calls to name, can be given more than once\n"
+        "  --thread index           only calls from the thread with that index, can be given more than once\n"
+        "  --frame n | n-m | n-     only calls, summaries and reports of frames n to m\n"
+        "  -o path                  write to path instead of stdout\n");
+}
+
+static bool ParseFrames(const char* text, DumpFilter& filter)
+{
+    char* end = nullptr;
+    filter.firstFrame = strtoull(text, &end, 10);
+    if (end == text)
+        return false;
+    if (*end == 0)
+    {
+        filter.lastFrame = filter.firstFrame;
+        return true;
+    }
+    if (*end != '-')
+        return false;
+    const char* last = end + 1;
+    if (*last == 0)
+        return true;
+    filter.lastFrame = strtoull(last, &end, 10);
+    return end != last && *end == 0 && filter.lastFrame >= filter.firstFrame;
+}
+
+int main(int argc, char** argv)
+{
+    DumpFormat format = kFormatText;
+    DumpFilter filter;
+    const char* outputPath = nullptr;
+    std::vector<const char*> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool takesValue = strcmp(arg, "--format") == 0 || strcmp(arg, "--function") == 0 || strcmp(arg, "--thread") == 0 ||
+            strcmp(arg, "--frame") == 0 || strcmp(arg, "-o") == 0;
+        if (!takesValue)
+        {
+            if (arg[0] == '-')
+            {
+                PrintUsage();
+                return 2;
+            }
+            inputs.push_back(arg);
+            continue;
+        }
+        if (value == nullptr)
+        {
+            PrintUsage();
+            return 2;
+        }
+        ++i;
+
+        if (strcmp(arg, "--format") == 0)
+        {
+            if (strcmp(value, "text") == 0)
+                format = kFormatText;
+            else if (strcmp(value, "jsonl") == 0)
+                format = kFormatJsonLines;
+            else if (strcmp(value, "csv") == 0)
+                format = kFormatCsv;
+            else
+            {
+                PrintUsage();
+                return 2;
+            }
+        }
+        else if (strcmp(arg, "--function") == 0)
+        {
+            filter.functions.push_back(value);
+        }
+        else if (strcmp(arg, "--thread") == 0)
+        {
+            filter.threads.insert((uint32_t)strtoul(value, nullptr, 10));
+        }
+        else if (strcmp(arg, "--frame") == 0)
+        {
+            if (!ParseFrames(value, filter))
+            {
+                PrintUsage();
+                return 2;
+            }
+        }
+        else
+        {
+            outputPath = value;
+        }
+    }
+    if (inputs.empty())
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    FILE* out = outputPath != nullptr ? fopen(outputPath, "wb") : stdout;
+    if (out == nullptr)
+    {
+        fprintf(stderr, "%s: %s\n", outputPath, strerror(errno));
+        return 1;
+    }
+    static char outputBuffer[1 << 20];
+    setvbuf(out, outputBuffer, _IOFBF, sizeof(outputBuffer));
+
+    int status = 0;
+    TraceDecoder decoder;
+    DumpWriter writer(out, format, filter);
+    for (const char* input : inputs)
+    {
+        std::string error;
+        if (!DecodeTracePath(decoder, input, writer, error))
+        {
+            // Everything decoded up to the error is kept.
+            fprintf(stderr, "%s\n", error.c_str());
+            status = 1;
+        }
+    }
+
+    if (fflush(out) != 0 || ferror(out))
+    {
+        fprintf(stderr, "%s: write failed\n", outputPath != nullptr ? outputPath : "stdout");
+        status = 1;
+    }
+    if (out != stdout)
+        fclose(out);
+    return status;
+}
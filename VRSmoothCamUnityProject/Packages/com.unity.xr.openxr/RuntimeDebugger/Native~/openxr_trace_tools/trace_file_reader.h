@@ -0,0 +1,139 @@
+#pragma once
+
+// Maps trace files from file_sink.h, or raw payloads saved from GetDataForRead, and decodes them with TraceDecoder.
+// Files are mapped read only, one at a time, so a capture of any size is read without copying it into memory.
+// Linux and other platforms with mmap only.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../openxr_runtime_debugger/trace_decoder.h"
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        Close();
+    }
+
+    bool Open(const char* path, std::string& error)
+    {
+        Close();
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            error = std::string(path) + ": " + strerror(errno);
+            return false;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            error = std::string(path) + ": " + strerror(errno);
+            close(fd);
+            return false;
+        }
+
+        size = (size_t)info.st_size;
+        if (size != 0)
+        {
+            void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED)
+            {
+                error = std::string(path) + ": " + strerror(errno);
+                close(fd);
+                size = 0;
+                return false;
+            }
+            data = (const uint8_t*)mapped;
+            madvise(mapped, size, MADV_SEQUENTIAL);
+        }
+        close(fd);
+        return true;
+    }
+
+    void Close()
+    {
+        if (data != nullptr)
+            munmap((void*)data, size);
+        data = nullptr;
+        size = 0;
+    }
+
+    const uint8_t* Data() const
+    {
+        return data;
+    }
+
+    size_t Size() const
+    {
+        return size;
+    }
+
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+// How much of a file is decoded before the pages behind it are handed back.
+static const size_t kDecodeWindow = 16 * 1024 * 1024;
+
+static bool IsTraceFile(const uint8_t* data, size_t size)
+{
+    return size >= sizeof(kTraceFileMagic) && memcmp(data, kTraceFileMagic, sizeof(kTraceFileMagic)) == 0;
+}
+
+// Decodes path with decoder, as a trace file if it starts with the trace file magic and as a raw payload otherwise.
+// A raw payload carries on from whatever decoder read before it, so pass the reads of one session in order.
+// Decodes kDecodeWindow at a time and drops the pages it's done with, so memory use doesn't grow with the file.
+template <typename Visitor>
+static bool DecodeTracePath(TraceDecoder& decoder, const char* path, Visitor& visitor, std::string& error)
+{
+    MappedFile file;
+    if (!file.Open(path, error))
+        return false;
+
+    size_t offset = 0, size = file.Size();
+    if (IsTraceFile(file.Data(), file.Size()))
+    {
+        if (!decoder.ReadFileHeader(file.Data(), file.Size(), offset, size))
+        {
+            error = std::string(path) + ": " + decoder.Error();
+            return false;
+        }
+        decoder.Reset();
+    }
+
+    const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    const uint8_t* data = file.Data() + offset;
+    const uint8_t* released = file.Data();
+    while (size != 0)
+    {
+        size_t decoded = 0;
+        if (!decoder.DecodeSome(data, size, kDecodeWindow, visitor, decoded))
+        {
+            error = std::string(path) + " at byte " + std::to_string((size_t)(data - file.Data()) + decoded) + ": " + decoder.Error();
+            return false;
+        }
+        data += decoded;
+        size -= decoded;
+
+        const uint8_t* done = (const uint8_t*)((uintptr_t)data & ~(uintptr_t)(pageSize - 1));
+        if (done > released)
+        {
+            madvise((void*)released, done - released, MADV_DONTNEED);
+            released = done;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,1181 @@
+// Replays runtime debugger captures against an OpenXR runtime and times every call, to reproduce a device's
+// performance problems on another machine, against the MockRuntime or any other runtime library.
+// Build and run with for example:
+//   g++ -std=c++14 -O2 -I<OpenXR-SDK>/include trace_replay.cpp -ldl -o trace_replay
+//   ./trace_replay --paced ./libmock_api.so /sdcard/traces/openxr_trace_1234_*.oxrt
+// Inputs are trace files from StartFileSink or raw payloads saved from GetDataForRead, decoded in the order given.
+// Build with the same XR_USE_* defines and reflection header as the runtime debugger, the arguments are rebuilt
+// from the capture with the same lists they were serialized with.
+//
+// Capture with SetRecordInputs on, see recorded_inputs.h.  Without it calls are rebuilt from the values the runtime
+// left behind, which only differ for output structs.
+// Calls are replayed on one thread, in the order they started.  Handles, paths and system ids the runtime handed out
+// during the capture are mapped to the ones it hands out this time, and XrTime values are moved by how far the
+// runtime's predicted display time is from the captured one.  A capture that starts after the app's setup calls
+// can't be mapped and shows up as failing calls.
+// Pointers a capture doesn't carry (graphics bindings, platform handles, function pointers) are passed as nullptr.
+// Calls without arguments (cache not large enough, values lost to dropped data) and functions the runtime doesn't
+// resolve are skipped.
+// Prints the replayed latency of every function next to the captured one.  Returns non-zero if an input can't be
+// decoded or the runtime can't be loaded.
+
+#include <algorithm>
+#include <chrono>
+#include <dlfcn.h>
+#include <memory>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "../openxr_runtime_debugger/platform_includes.h"
+
+#define XR_NO_PROTOTYPES
+#include <openxr/openxr.h>
+#include <openxr/openxr_platform.h>
+
+#if defined(__has_include)
+#if __has_include(<openxr/loader_interfaces.h>)
+#include <openxr/loader_interfaces.h>
+#define REPLAY_NEGOTIATE 1
+#endif
+#endif
+
+#include "../openxr_runtime_debugger/openxr/openxr_reflection_full.h"
+
+#include "trace_file_reader.h"
+
+static_assert(std::is_pointer<XrInstance>::value, "Handles are told apart by type, which needs a 64-bit build");
+
+// One value of a captured call, in the order the decoder reported it.  A struct's fields follow it, up to end.
+struct Value
+{
+    enum Kind : uint8_t
+    {
+        kNumber,
+        kFloat,
+        kString,
+        kStruct,
+        kLost,
+    };
+
+    Kind kind;
+    std::string name;
+    // kString: the string, kStruct: the struct's name, kNumber: the enum value's name, if it is one.
+    std::string text;
+    // Signed values as two's complement.
+    uint64_t number;
+    double real;
+    // Just past the last of a struct's fields, just past the value itself for everything else.
+    uint32_t end;
+};
+
+struct CapturedCall
+{
+    std::string funcName;
+    std::string result;
+    uint64_t startTime;
+    uint64_t duration;
+    std::vector<Value> values;
+    // values before it are the inputs, from it on the outputs.  0 for calls captured without their inputs, whose
+    // values are both.
+    uint32_t outputs;
+    // Nothing to rebuild the arguments from.
+    bool incomplete;
+
+    uint32_t InputsEnd() const
+    {
+        return outputs != 0 ? outputs : (uint32_t)values.size();
+    }
+};
+
+// Keeps every call of the capture, arguments included.
+class CallCollector final : public TraceVisitor
+{
+public:
+    std::vector<CapturedCall> calls;
+
+    void OnStartFunctionCall(uint32_t /*threadIndex*/, StringSpan funcName) override
+    {
+        calls.emplace_back();
+        call = &calls.back();
+        call->funcName = funcName.ToString();
+        call->outputs = 0;
+        call->incomplete = false;
+        open.clear();
+    }
+
+    void OnStartStruct(StringSpan fieldName, StringSpan structName) override
+    {
+        if (call == nullptr)
+            return;
+        Value& value = Add(Value::kStruct, fieldName);
+        value.text.assign(structName.data, structName.size);
+        open.push_back((uint32_t)call->values.size() - 1);
+    }
+
+    void OnEndStruct() override
+    {
+        if (call == nullptr || open.empty())
+            return;
+        call->values[open.back()].end = (uint32_t)call->values.size();
+        open.pop_back();
+    }
+
+    void OnFloat(StringSpan fieldName, float value) override
+    {
+        if (call != nullptr)
+            Add(Value::kFloat, fieldName).real = value;
+    }
+
+    void OnString(StringSpan fieldName, StringSpan value) override
+    {
+        if (call != nullptr)
+            Add(Value::kString, fieldName).text.assign(value.data, value.size);
+    }
+
+    void OnInt(StringSpan fieldName, int64_t value) override
+    {
+        if (call != nullptr)
+            Add(Value::kNumber, fieldName).number = (uint64_t)value;
+    }
+
+    void OnUInt(StringSpan fieldName, uint64_t value) override
+    {
+        if (call != nullptr)
+            Add(Value::kNumber, fieldName).number = value;
+    }
+
+    void OnEnum(StringSpan fieldName, StringSpan /*typeName*/, int32_t value, StringSpan valueName) override
+    {
+        if (call == nullptr)
+            return;
+        Value& added = Add(Value::kNumber, fieldName);
+        added.number = (uint64_t)(int64_t)value;
+        added.text.assign(valueName.data, valueName.size);
+    }
+
+    void OnLostValue(StringSpan fieldName) override
+    {
+        if (call == nullptr)
+            return;
+        Add(Value::kLost, fieldName);
+        call->incomplete = true;
+    }
+
+    void OnCallOutputs() override
+    {
+        if (call == nullptr)
+            return;
+        CloseStructs();
+        call->outputs = (uint32_t)call->values.size();
+    }
+
+    void OnEndFunctionCall(StringSpan result, bool startTimeKnown, uint64_t startTime, uint64_t duration, uint32_t /*frame*/) override
+    {
+        if (call == nullptr)
+            return;
+        CloseStructs();
+        // A call whose start time was lost goes right after the one decoded before it.
+        if (startTimeKnown)
+            lastStart = startTime;
+        call->startTime = lastStart;
+        call->duration = duration;
+        call->result = result.ToString();
+        call = nullptr;
+    }
+
+    void OnCacheNotLargeEnough(uint32_t /*threadIndex*/, StringSpan funcName, StringSpan result, uint64_t startTime, uint64_t duration, uint32_t /*frame*/) override
+    {
+        calls.emplace_back();
+        CapturedCall& skipped = calls.back();
+        skipped.funcName = funcName.ToString();
+        skipped.result = result.ToString();
+        skipped.startTime = lastStart = startTime;
+        skipped.duration = duration;
+        skipped.outputs = 0;
+        skipped.incomplete = true;
+        call = nullptr;
+    }
+
+private:
+    Value& Add(Value::Kind kind, StringSpan name)
+    {
+        call->values.emplace_back();
+        Value& value = call->values.back();
+        value.kind = kind;
+        value.name.assign(name.data, name.size);
+        value.number = 0;
+        value.real = 0;
+        value.end = (uint32_t)call->values.size();
+        return value;
+    }
+
+    void CloseStructs()
+    {
+        while (!open.empty())
+            OnEndStruct();
+    }
+
+    // calls is only appended to while a call is decoded, so the pointer stays valid until it ends.
+    CapturedCall* call = nullptr;
+    std::vector<uint32_t> open;
+    uint64_t lastStart = 0;
+};
+
+// What's mapped from the values of the capture to the ones of the replay: every handle type, paths and system ids.
+#define REMAP_KIND(handle) \
+    kRemap_##handle,
+
+enum RemapKind
+{
+    XR_LIST_HANDLES(REMAP_KIND)
+    kRemapPath,
+    kRemapSystemId,
+    kRemapKindCount
+};
+
+template <typename T>
+struct HandleRemap
+{
+    static const int kind = -1;
+};
+
+#define HANDLE_REMAP(handle)                     \
+    template <>                                  \
+    struct HandleRemap<handle>                   \
+    {                                            \
+        static const int kind = kRemap_##handle; \
+    };
+
+XR_LIST_HANDLES(HANDLE_REMAP)
+
+static bool EndsWith(const char* name, const char* suffix)
+{
+    size_t length = strlen(name), suffixLength = strlen(suffix);
+    return length >= suffixLength && strcmp(name + length - suffixLength, suffix) == 0;
+}
+
+// uint64_t values are paths, system ids or flags, only their names tell them apart.
+static int UInt64Remap(const char* name)
+{
+    if (strcmp(name, "systemId") == 0)
+        return kRemapSystemId;
+    if (strcmp(name, "flags") == 0 || EndsWith(name, "Flags"))
+        return -1;
+    return kRemapPath;
+}
+
+// XrTime and XrDuration are both int64_t.
+static bool IsTime(const char* name)
+{
+    return strcmp(name, "time") == 0 || EndsWith(name, "Time");
+}
+
+// State that carries over from call to call.
+struct ReplayState
+{
+    std::unordered_map<uint64_t, uint64_t> remaps[kRemapKindCount];
+    // Live predicted display time minus the captured one, from the last xrWaitFrame.
+    int64_t timeOffset = 0;
+    // The last instance the runtime created.
+    XrInstance instance = XR_NULL_HANDLE;
+};
+
+// Rebuilds the arguments of one call.  Everything it allocates lives until the call is done.
+class ArgBuilder
+{
+public:
+    ArgBuilder(ReplayState& state, const CapturedCall& call) :
+        state(state), call(call)
+    {
+    }
+
+    ReplayState& state;
+    const CapturedCall& call;
+    // Something couldn't be rebuilt and went in as nullptr or zero.
+    bool approximated = false;
+    // A handle from before the capture started.
+    bool unmapped = false;
+
+    const Value& At(uint32_t index) const
+    {
+        return call.values[index];
+    }
+
+    // Index of the value named name among the ones in [begin, end), end if there isn't one.
+    uint32_t Find(uint32_t begin, uint32_t end, const char* name) const
+    {
+        for (uint32_t i = begin; i < end; i = call.values[i].end)
+        {
+            if (call.values[i].name == name)
+                return i;
+        }
+        return end;
+    }
+
+    // Array elements are sent one after the other under the same name.
+    void Elements(uint32_t begin, uint32_t end, const char* name, std::vector<uint32_t>& elements) const
+    {
+        elements.clear();
+        for (uint32_t i = Find(begin, end, name); i < end && call.values[i].name == name; i = call.values[i].end)
+            elements.push_back(i);
+    }
+
+    void* Allocate(size_t size)
+    {
+        // Zeroed, and aligned for anything.
+        allocations.emplace_back(new uint64_t[(size + sizeof(uint64_t) - 1) / sizeof(uint64_t) + 1]());
+        return allocations.back().get();
+    }
+
+    uint64_t Remap(int kind, uint64_t value)
+    {
+        if (kind < 0 || value == 0)
+            return value;
+        auto it = state.remaps[kind].find(value);
+        if (it != state.remaps[kind].end())
+            return it->second;
+        if (kind != kRemapPath)
+            unmapped = true;
+        return value;
+    }
+
+private:
+    std::vector<std::unique_ptr<uint64_t[]>> allocations;
+};
+
+// Structs from the reflection lists, with a loader for each member.
+// begin, end is the struct's fields in the capture, count the array length for array members.
+typedef void (*LoadFieldFunc)(ArgBuilder& builder, void* member, uint32_t begin, uint32_t end, const char* name, uint32_t count);
+
+struct ReplayField
+{
+    const char* name;
+    size_t offset;
+    LoadFieldFunc load;
+    // Array members: the count member.
+    size_t countOffset;
+    size_t countSize;
+};
+
+struct ReplayStruct
+{
+    const char* name;
+    const ReplayField* fields;
+    size_t size;
+    XrStructureType type;
+};
+
+#define REPLAY_STRUCT_ID(structname, ...) \
+    kReplayStruct_##structname,
+
+enum ReplayStructId
+{
+    XR_LIST_BASIC_STRUCTS(REPLAY_STRUCT_ID)
+    XR_LIST_STRUCTURE_TYPES(REPLAY_STRUCT_ID)
+    kReplayStructCount
+};
+
+extern const ReplayStruct s_ReplayStructs[kReplayStructCount];
+
+template <typename T>
+struct StructOf
+{
+    static const bool listed = false;
+
+    static const ReplayStruct* Get()
+    {
+        return nullptr;
+    }
+};
+
+#define STRUCT_OF(structname, ...)                               \
+    template <>                                                  \
+    struct StructOf<structname>                                  \
+    {                                                            \
+        static const bool listed = true;                         \
+                                                                 \
+        static const ReplayStruct* Get()                         \
+        {                                                        \
+            return &s_ReplayStructs[kReplayStruct_##structname]; \
+        }                                                        \
+    };
+
+XR_LIST_BASIC_STRUCTS(STRUCT_OF)
+XR_LIST_STRUCTURE_TYPES(STRUCT_OF)
+
+static const ReplayStruct* FindStruct(const std::string& name)
+{
+    static const std::unordered_map<std::string, const ReplayStruct*> s_ByName = []() {
+        std::unordered_map<std::string, const ReplayStruct*> byName;
+        for (const ReplayStruct& info : s_ReplayStructs)
+            byName[info.name] = &info;
+        return byName;
+    }();
+    auto it = s_ByName.find(name);
+    return it != s_ByName.end() ? it->second : nullptr;
+}
+
+template <typename T, typename = void>
+struct IsCompleteType : std::false_type
+{
+};
+
+template <typename T>
+struct IsCompleteType<T, decltype(void(sizeof(T)))> : std::true_type
+{
+};
+
+static bool IsNull(const Value& value)
+{
+    return (value.kind == Value::kNumber && value.number == 0) || (value.kind == Value::kString && value.text == "nullptr");
+}
+
+static void LoadStruct(ArgBuilder& builder, void* t, const ReplayStruct& info, uint32_t index)
+{
+    uint32_t begin = index + 1, end = builder.At(index).end;
+    for (const ReplayField* field = info.fields; field->name != nullptr; ++field)
+    {
+        uint8_t* member = (uint8_t*)t + field->offset;
+        uint32_t count = 0;
+        if (field->countSize == sizeof(uint64_t))
+            count = (uint32_t)*(const uint64_t*)((uint8_t*)t + field->countOffset);
+        else if (field->countSize != 0)
+            count = *(const uint32_t*)((uint8_t*)t + field->countOffset);
+        field->load(builder, member, begin, end, field->name, count);
+    }
+}
+
+// A struct the capture names, or T if it doesn't name one.  nullptr if neither is in the reflection lists.
+template <typename T>
+static const ReplayStruct* StructFor(ArgBuilder& /*builder*/, const Value* value)
+{
+    const ReplayStruct* info = value != nullptr && value->kind == Value::kStruct ? FindStruct(value->text) : nullptr;
+    return info != nullptr ? info : StructOf<typename std::remove_cv<T>::type>::Get();
+}
+
+// Values, dispatched on what T is.  value is nullptr if the capture doesn't have it.
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* name);
+
+struct NumberTag
+{
+};
+struct HandleTag
+{
+};
+struct StructTag
+{
+};
+struct PointerTag
+{
+};
+struct OtherTag
+{
+};
+
+template <typename T>
+using ValueTag = typename std::conditional<HandleRemap<T>::kind >= 0, HandleTag,
+    typename std::conditional<std::is_arithmetic<T>::value || std::is_enum<T>::value, NumberTag,
+        typename std::conditional<std::is_pointer<T>::value, PointerTag,
+            typename std::conditional<StructOf<T>::listed, StructTag, OtherTag>::type>::type>::type>::type;
+
+template <typename T>
+static void LoadNumber(ArgBuilder& /*builder*/, T& t, const Value& value, const char* /*name*/)
+{
+    t = value.kind == Value::kFloat ? (T)value.real : (T)(int64_t)value.number;
+}
+
+static void LoadNumber(ArgBuilder& /*builder*/, float& t, const Value& value, const char* /*name*/)
+{
+    t = value.kind == Value::kFloat ? (float)value.real : (float)(int64_t)value.number;
+}
+
+static void LoadNumber(ArgBuilder& builder, uint64_t& t, const Value& value, const char* name)
+{
+    t = builder.Remap(UInt64Remap(name), value.number);
+}
+
+static void LoadNumber(ArgBuilder& builder, int64_t& t, const Value& value, const char* name)
+{
+    t = (int64_t)value.number;
+    if (t != 0 && IsTime(name))
+        t += builder.state.timeOffset;
+}
+
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* name, NumberTag)
+{
+    if (value != nullptr && (value->kind == Value::kNumber || value->kind == Value::kFloat))
+        LoadNumber(builder, t, *value, name);
+    else
+        t = T();
+}
+
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* /*name*/, HandleTag)
+{
+    t = value != nullptr && value->kind == Value::kNumber ? (T)builder.Remap(HandleRemap<T>::kind, value->number) : (T)XR_NULL_HANDLE;
+}
+
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* /*name*/, StructTag)
+{
+    if (value != nullptr && value->kind == Value::kStruct)
+        LoadStruct(builder, &t, *StructOf<T>::Get(), (uint32_t)(value - builder.call.values.data()));
+}
+
+// Values the capture can't describe stay zero.
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* name, OtherTag)
+{
+    if (value != nullptr && !IsNull(*value))
+        builder.approximated = true;
+}
+
+template <size_t N>
+static void LoadValue(ArgBuilder& /*builder*/, char (&t)[N], const Value* value, const char* /*name*/)
+{
+    if (value != nullptr && value->kind == Value::kString)
+        strncpy(t, value->text.c_str(), N - 1);
+}
+
+// A struct pointed to, of the type the capture names.  An output the capture doesn't have gets a zeroed T with its
+// structure type set.
+template <typename T>
+static T* LoadStructPointer(ArgBuilder& builder, const Value* value)
+{
+    if (value != nullptr && IsNull(*value))
+        return nullptr;
+
+    const ReplayStruct* info = StructFor<T>(builder, value);
+    size_t size = info != nullptr && info->size > sizeof(T) ? info->size : sizeof(T);
+    void* t = builder.Allocate(size);
+    if (value != nullptr && value->kind == Value::kStruct && info != nullptr)
+        LoadStruct(builder, t, *info, (uint32_t)(value - builder.call.values.data()));
+    else if (info != nullptr && info->type != XR_TYPE_UNKNOWN)
+        *(XrStructureType*)t = info->type;
+    else if (value != nullptr)
+        builder.approximated = true;
+    return (T*)t;
+}
+
+// Pointers to one value.
+template <typename T>
+static void LoadPointer(ArgBuilder& builder, T*& t, const Value* value)
+{
+    typedef typename std::remove_cv<T>::type Type;
+    LoadPointer(builder, t, value, std::integral_constant<bool, std::is_class<Type>::value && IsCompleteType<Type>::value>(),
+        std::integral_constant<bool, std::is_arithmetic<Type>::value || std::is_enum<Type>::value || HandleRemap<Type>::kind >= 0>());
+}
+
+template <typename T>
+static void LoadPointer(ArgBuilder& builder, T*& t, const Value* value, std::true_type /* struct */, std::false_type)
+{
+    t = LoadStructPointer<T>(builder, value);
+}
+
+// Handles are sent as 0 for nullptr, which can't be told apart from an output not written yet.
+template <typename T>
+static void LoadPointer(ArgBuilder& builder, T*& t, const Value* value, std::false_type, std::true_type /* value */)
+{
+    typedef typename std::remove_cv<T>::type Type;
+    if (value != nullptr && value->kind == Value::kString && value->text == "nullptr")
+    {
+        t = nullptr;
+        return;
+    }
+    Type* pointee = (Type*)builder.Allocate(sizeof(Type));
+    if (value != nullptr)
+        LoadValue(builder, *pointee, value, value->name.c_str());
+    t = pointee;
+}
+
+// Anything else, void pointers included, is passed as nullptr.
+template <typename T>
+static void LoadPointer(ArgBuilder& builder, T*& t, const Value* value, std::false_type, std::false_type)
+{
+    t = nullptr;
+    if (value != nullptr && !IsNull(*value))
+        builder.approximated = true;
+}
+
+// Next chains are sent as the structs they point to.
+static void LoadPointer(ArgBuilder& builder, const void*& t, const Value* value)
+{
+    const ReplayStruct* info = value != nullptr && value->kind == Value::kStruct ? FindStruct(value->text) : nullptr;
+    if (info == nullptr)
+    {
+        t = nullptr;
+        if (value != nullptr && !IsNull(*value))
+            builder.approximated = true;
+        return;
+    }
+    void* chained = builder.Allocate(info->size);
+    LoadStruct(builder, chained, *info, (uint32_t)(value - builder.call.values.data()));
+    t = chained;
+}
+
+static void LoadPointer(ArgBuilder& builder, void*& t, const Value* value)
+{
+    const void* chained = nullptr;
+    LoadPointer(builder, chained, value);
+    t = const_cast<void*>(chained);
+}
+
+static void LoadPointer(ArgBuilder& builder, const char*& t, const Value* value)
+{
+    if (value == nullptr || value->kind != Value::kString || value->text == "nullptr")
+    {
+        t = nullptr;
+        return;
+    }
+    char* copy = (char*)builder.Allocate(value->text.size() + 1);
+    memcpy(copy, value->text.c_str(), value->text.size() + 1);
+    t = copy;
+}
+
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* /*name*/, PointerTag)
+{
+    LoadPointer(builder, t, value);
+}
+
+template <typename T>
+static void LoadValue(ArgBuilder& builder, T& t, const Value* value, const char* name)
+{
+    LoadValue(builder, t, value, name, ValueTag<T>());
+}
+
+// Arrays of count elements, elements are the indices of the ones the capture has.  Elements past them are zeroed,
+// with their structure type set.  The elements of an array all have the type of the first one.
+template <typename T>
+static void LoadElements(ArgBuilder& builder, T*& t, const std::vector<uint32_t>& elements, uint32_t count, std::true_type /* struct */)
+{
+    const Value* first = elements.empty() ? nullptr : &builder.At(elements[0]);
+    const ReplayStruct* info = StructFor<T>(builder, first);
+    size_t stride = info != nullptr && info->size > sizeof(T) ? info->size : sizeof(T);
+    uint8_t* array = (uint8_t*)builder.Allocate(stride * count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (info == nullptr)
+            break;
+        if (i < elements.size() && builder.At(elements[i]).kind == Value::kStruct)
+            LoadStruct(builder, array + i * stride, *info, elements[i]);
+        else if (info->type != XR_TYPE_UNKNOWN)
+            *(XrStructureType*)(array + i * stride) = info->type;
+    }
+    t = (T*)array;
+}
+
+template <typename T>
+static void LoadElements(ArgBuilder& builder, T*& t, const std::vector<uint32_t>& elements, uint32_t count, std::false_type)
+{
+    typedef typename std::remove_cv<T>::type Type;
+    Type* array = (Type*)builder.Allocate(sizeof(Type) * count);
+    for (uint32_t i = 0; i < count && i < elements.size(); ++i)
+    {
+        const Value& value = builder.At(elements[i]);
+        LoadValue(builder, array[i], &value, value.name.c_str());
+    }
+    t = array;
+}
+
+template <typename T>
+static void LoadArray(ArgBuilder& builder, T*& t, const std::vector<uint32_t>& elements, uint32_t count, std::true_type /* array */)
+{
+    typedef typename std::remove_cv<T>::type Type;
+    if (count == 0)
+    {
+        t = nullptr;
+        return;
+    }
+    LoadElements(builder, t, elements, count, std::integral_constant<bool, std::is_class<Type>::value && IsCompleteType<Type>::value>());
+}
+
+// Only pointers are arrays, handles are pointers too.
+template <typename T>
+static void LoadArray(ArgBuilder& /*builder*/, T& t, const std::vector<uint32_t>& /*elements*/, uint32_t /*count*/, std::false_type)
+{
+    t = T();
+}
+
+template <typename T>
+static void LoadArray(ArgBuilder& builder, T& t, const std::vector<uint32_t>& elements, uint32_t count)
+{
+    LoadArray(builder, t, elements, count, std::integral_constant<bool, std::is_pointer<T>::value && HandleRemap<T>::kind < 0>());
+}
+
+template <typename T>
+static void LoadMember(ArgBuilder& builder, void* member, uint32_t begin, uint32_t end, const char* name, uint32_t /*count*/)
+{
+    uint32_t index = builder.Find(begin, end, name);
+    LoadValue(builder, *(T*)member, index < end ? &builder.At(index) : nullptr, name);
+}
+
+template <typename T>
+static void LoadArrayMember(ArgBuilder& builder, void* member, uint32_t begin, uint32_t end, const char* name, uint32_t count)
+{
+    std::vector<uint32_t> elements;
+    builder.Elements(begin, end, name, elements);
+    LoadArray(builder, *(T*)member, elements, count);
+}
+
+#define REPLAY_FIELD(member) \
+    {#member, offsetof(Struct, member), &LoadMember<decltype(Struct::member)>, 0, 0},
+
+#define REPLAY_ARRAY(member, lenMember) \
+    {#member, offsetof(Struct, member), &LoadArrayMember<decltype(Struct::member)>, offsetof(Struct, lenMember), sizeof(Struct::lenMember)},
+
+#define REPLAY_STRUCT_FIELDS(structname, ...)                 \
+    struct ReplayFields_##structname                          \
+    {                                                         \
+        typedef structname Struct;                            \
+        static const ReplayField fields[];                    \
+    };                                                        \
+    const ReplayField ReplayFields_##structname::fields[] = { \
+        XR_LIST_STRUCT_##structname(REPLAY_FIELD) XR_LIST_STRUCT_ARRAYS_##structname(REPLAY_ARRAY) ReplayField{}};
+
+XR_LIST_BASIC_STRUCTS(REPLAY_STRUCT_FIELDS)
+XR_LIST_STRUCTURE_TYPES(REPLAY_STRUCT_FIELDS)
+
+#define REPLAY_BASIC_STRUCT(structname) \
+    {#structname, ReplayFields_##structname::fields, sizeof(structname), XR_TYPE_UNKNOWN},
+
+#define REPLAY_STRUCTURE_TYPE(structname, structtype) \
+    {#structname, ReplayFields_##structname::fields, sizeof(structname), structtype},
+
+const ReplayStruct s_ReplayStructs[kReplayStructCount] = {
+    XR_LIST_BASIC_STRUCTS(REPLAY_BASIC_STRUCT)
+    XR_LIST_STRUCTURE_TYPES(REPLAY_STRUCTURE_TYPE)
+};
+
+// The parameters of a function, from its reflection lists.
+struct FuncParams
+{
+    std::vector<std::string> names;
+    // For each parameter, the one with its array length, -1 for parameters that aren't arrays.
+    std::vector<int> lengths;
+
+    FuncParams(const char* paramNames, const char* const* arrays)
+    {
+        for (const char* p = paramNames; *p != 0;)
+        {
+            while (*p == ' ' || *p == ',')
+                ++p;
+            const char* end = p;
+            while (*end != 0 && *end != ',' && *end != ' ')
+                ++end;
+            if (end != p)
+                names.emplace_back(p, end - p);
+            p = end;
+        }
+        lengths.assign(names.size(), -1);
+        for (; arrays[0] != nullptr; arrays += 2)
+        {
+            int array = Index(arrays[0]), length = Index(arrays[1]);
+            if (array >= 0)
+                lengths[array] = length;
+        }
+    }
+
+    int Index(const char* name) const
+    {
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            if (names[i] == name)
+                return (int)i;
+        }
+        return -1;
+    }
+};
+
+template <typename T>
+static void LoadParam(ArgBuilder& builder, T& arg, const FuncParams& params, size_t index)
+{
+    const char* name = params.names[index].c_str();
+    uint32_t inputsEnd = builder.call.InputsEnd();
+    int length = params.lengths[index];
+    if (length < 0)
+    {
+        uint32_t value = builder.Find(0, inputsEnd, name);
+        LoadValue(builder, arg, value < inputsEnd ? &builder.At(value) : nullptr, name);
+        return;
+    }
+
+    // Capacities and counts are sent as numbers, counts passed by pointer too.
+    uint32_t lengthValue = builder.Find(0, inputsEnd, params.names[length].c_str());
+    uint32_t count = lengthValue < inputsEnd && builder.At(lengthValue).kind == Value::kNumber ? (uint32_t)builder.At(lengthValue).number : 0;
+    std::vector<uint32_t> elements;
+    builder.Elements(0, inputsEnd, name, elements);
+    LoadArray(builder, arg, elements, count);
+}
+
+// Learns what the runtime handed out this time from what it handed out during the capture.
+template <typename T>
+static void LearnParam(ArgBuilder& /*builder*/, const T& /*arg*/, const char* /*name*/, std::false_type)
+{
+}
+
+template <typename T>
+static void LearnParam(ArgBuilder& builder, T* const& arg, const char* name, std::true_type /* output */)
+{
+    int kind = std::is_same<T, uint64_t>::value ? UInt64Remap(name) : HandleRemap<T>::kind;
+    uint32_t end = (uint32_t)builder.call.values.size();
+    uint32_t value = builder.Find(builder.call.outputs, end, name);
+    if (kind == kRemap_XrInstance && arg != nullptr)
+        builder.state.instance = (XrInstance)(uint64_t)*arg;
+    if (arg == nullptr || kind < 0 || value == end || builder.At(value).kind != Value::kNumber || builder.At(value).number == 0)
+        return;
+    builder.state.remaps[kind][builder.At(value).number] = (uint64_t)*arg;
+}
+
+template <typename T>
+static void LearnParam(ArgBuilder& builder, const T& arg, const char* name)
+{
+    typedef typename std::remove_pointer<T>::type Pointee;
+    LearnParam(builder, arg, name, std::integral_constant<bool, std::is_pointer<T>::value && !std::is_const<Pointee>::value && (HandleRemap<Pointee>::kind >= 0 || std::is_same<Pointee, uint64_t>::value)>());
+}
+
+// XrTime values are moved by how far the runtime's predicted display time is from the captured one.
+static void LearnParam(ArgBuilder& builder, XrFrameState* const& arg, const char* name)
+{
+    uint32_t end = (uint32_t)builder.call.values.size();
+    uint32_t frameState = builder.Find(builder.call.outputs, end, name);
+    if (arg == nullptr || frameState == end || builder.At(frameState).kind != Value::kStruct)
+        return;
+    uint32_t time = builder.Find(frameState + 1, builder.At(frameState).end, "predictedDisplayTime");
+    if (time == builder.At(frameState).end || builder.At(time).number == 0 || arg->predictedDisplayTime == 0)
+        return;
+    builder.state.timeOffset = arg->predictedDisplayTime - (int64_t)builder.At(time).number;
+}
+
+template <size_t... Indices>
+struct ArgIndices
+{
+};
+
+template <size_t Count, size_t... Indices>
+struct MakeArgIndices : MakeArgIndices<Count - 1, Count - 1, Indices...>
+{
+};
+
+template <size_t... Indices>
+struct MakeArgIndices<0, Indices...>
+{
+    typedef ArgIndices<Indices...> type;
+};
+
+template <typename Func>
+struct Caller;
+
+// Rebuilds the arguments of a function, calls it and times it.
+template <typename... Params>
+struct Caller<XrResult(XRAPI_PTR*)(Params...)>
+{
+    typedef XrResult(XRAPI_PTR* Func)(Params...);
+
+    template <size_t... Indices>
+    static XrResult Call(Func func, ArgBuilder& builder, const FuncParams& params, uint64_t& duration, ArgIndices<Indices...>)
+    {
+        std::tuple<typename std::remove_const<Params>::type...> args;
+        // Braced lists are evaluated in order.
+        int loads[] = {0, (LoadParam(builder, std::get<Indices>(args), params, Indices), 0)...};
+        (void)loads;
+
+        auto start = std::chrono::steady_clock::now();
+        XrResult result = func(std::get<Indices>(args)...);
+        duration = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        if (XR_SUCCEEDED(result))
+        {
+            int learns[] = {0, (LearnParam(builder, std::get<Indices>(args), params.names[Indices].c_str()), 0)...};
+            (void)learns;
+        }
+        return result;
+    }
+
+    static XrResult Call(PFN_xrVoidFunction func, ArgBuilder& builder, const FuncParams& params, uint64_t& duration)
+    {
+        return Call((Func)func, builder, params, duration, typename MakeArgIndices<sizeof...(Params)>::type());
+    }
+};
+
+typedef XrResult (*ReplayFunc)(PFN_xrVoidFunction func, ArgBuilder& builder, const FuncParams& params, uint64_t& duration);
+
+struct ReplayFuncInfo
+{
+    const char* name;
+    FuncParams params;
+    ReplayFunc replay;
+};
+
+#define REPLAY_PARAM_NAMES(...) \
+    #__VA_ARGS__
+
+#define REPLAY_FUNC_ARRAY(param, lenParam) \
+    #param, #lenParam,
+
+#define REPLAY_FUNC_ARRAYS(f, ...) \
+    static const char* const s_ReplayArrays_##f[] = {XR_LIST_FUNC_ARRAYS_##f(REPLAY_FUNC_ARRAY) nullptr};
+
+XR_LIST_FUNCS(REPLAY_FUNC_ARRAYS)
+
+#define REPLAY_FUNC_INFO(f, ...) \
+    {#f, FuncParams(XR_LIST_FUNC_PARAM_NAMES_##f(REPLAY_PARAM_NAMES), s_ReplayArrays_##f), &Caller<PFN_##f>::Call},
+
+static const std::vector<ReplayFuncInfo>& ReplayFuncs()
+{
+    static const std::vector<ReplayFuncInfo> s_Funcs = {
+        XR_LIST_FUNCS(REPLAY_FUNC_INFO)};
+    return s_Funcs;
+}
+
+static const ReplayFuncInfo* FindFunc(const std::string& name)
+{
+    static const std::unordered_map<std::string, const ReplayFuncInfo*> s_ByName = []() {
+        std::unordered_map<std::string, const ReplayFuncInfo*> byName;
+        for (const ReplayFuncInfo& info : ReplayFuncs())
+            byName[info.name] = &info;
+        return byName;
+    }();
+    auto it = s_ByName.find(name);
+    return it != s_ByName.end() ? it->second : nullptr;
+}
+
+#define RESULT_NAME(name, value) \
+    {value, #name},
+
+static const char* ResultName(XrResult result)
+{
+    static const std::unordered_map<int32_t, const char*> s_Names = {
+        XR_LIST_ENUM_XrResult(RESULT_NAME)};
+    auto it = s_Names.find((int32_t)result);
+    return it != s_Names.end() ? it->second : "unknown";
+}
+
+// The runtime library and its functions, resolved again once there's an instance.
+class Runtime
+{
+public:
+    bool Load(const char* path, std::string& error)
+    {
+        library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        if (library == nullptr)
+        {
+            error = dlerror();
+            return false;
+        }
+
+#ifdef REPLAY_NEGOTIATE
+        auto negotiate = (PFN_xrNegotiateLoaderRuntimeInterface)dlsym(library, "xrNegotiateLoaderRuntimeInterface");
+        if (negotiate != nullptr)
+        {
+            XrNegotiateLoaderInfo loaderInfo = {XR_LOADER_INTERFACE_STRUCT_LOADER_INFO, XR_LOADER_INFO_STRUCT_VERSION, sizeof(XrNegotiateLoaderInfo),
+                1, XR_CURRENT_LOADER_RUNTIME_VERSION, XR_MAKE_VERSION(1, 0, 0), XR_MAKE_VERSION(1, 0x3ff, 0xfff)};
+            XrNegotiateRuntimeRequest request = {XR_LOADER_INTERFACE_STRUCT_RUNTIME_REQUEST, XR_RUNTIME_INFO_STRUCT_VERSION, sizeof(XrNegotiateRuntimeRequest)};
+            if (negotiate(&loaderInfo, &request) == XR_SUCCESS)
+                getInstanceProcAddr = request.getInstanceProcAddr;
+        }
+#endif
+        if (getInstanceProcAddr == nullptr)
+            getInstanceProcAddr = (PFN_xrGetInstanceProcAddr)dlsym(library, "xrGetInstanceProcAddr");
+        if (getInstanceProcAddr == nullptr)
+        {
+            error = std::string(path) + ": neither xrNegotiateLoaderRuntimeInterface nor xrGetInstanceProcAddr is exported";
+            return false;
+        }
+        return true;
+    }
+
+    // nullptr if the runtime doesn't have name.
+    PFN_xrVoidFunction Resolve(const std::string& name)
+    {
+        auto it = resolved.find(name);
+        if (it != resolved.end())
+            return it->second;
+        PFN_xrVoidFunction func = nullptr;
+        if (XR_FAILED(getInstanceProcAddr(instance, name.c_str(), &func)))
+            func = nullptr;
+        resolved[name] = func;
+        return func;
+    }
+
+    void SetInstance(XrInstance newInstance)
+    {
+        if (newInstance == instance)
+            return;
+        instance = newInstance;
+        resolved.clear();
+    }
+
+private:
+    void* library = nullptr;
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr = nullptr;
+    XrInstance instance = XR_NULL_HANDLE;
+    std::unordered_map<std::string, PFN_xrVoidFunction> resolved;
+};
+
+struct FunctionReport
+{
+    std::vector<uint64_t> captured;
+    std::vector<uint64_t> replayed;
+    uint32_t differentResults = 0;
+};
+
+struct ReplayReport
+{
+    // By function, in the order they were first called.
+    std::vector<std::pair<std::string, FunctionReport>> functions;
+    std::unordered_map<std::string, size_t> indices;
+    uint32_t skipped = 0;
+    uint32_t unsupported = 0;
+    uint32_t approximated = 0;
+    uint32_t unmapped = 0;
+
+    FunctionReport& Function(const std::string& name)
+    {
+        auto it = indices.find(name);
+        if (it != indices.end())
+            return functions[it->second].second;
+        indices[name] = functions.size();
+        functions.emplace_back(name, FunctionReport());
+        return functions.back().second;
+    }
+};
+
+static void Replay(Runtime& runtime, const std::vector<CapturedCall>& calls, bool paced, ReplayReport& report)
+{
+    ReplayState state;
+    auto replayStart = std::chrono::steady_clock::now();
+    uint64_t captureStart = calls.empty() ? 0 : calls[0].startTime;
+    for (const CapturedCall& call : calls)
+    {
+        if (call.incomplete)
+        {
+            ++report.skipped;
+            continue;
+        }
+        const ReplayFuncInfo* info = FindFunc(call.funcName);
+        PFN_xrVoidFunction func = info != nullptr ? runtime.Resolve(call.funcName) : nullptr;
+        if (func == nullptr)
+        {
+            ++report.unsupported;
+            continue;
+        }
+
+        if (paced)
+            std::this_thread::sleep_until(replayStart + std::chrono::nanoseconds(call.startTime - captureStart));
+
+        ArgBuilder builder(state, call);
+        uint64_t duration = 0;
+        XrResult result = info->replay(func, builder, info->params, duration);
+        report.approximated += builder.approximated;
+        report.unmapped += builder.unmapped;
+
+        FunctionReport& function = report.Function(call.funcName);
+        function.captured.push_back(call.duration);
+        function.replayed.push_back(duration);
+        function.differentResults += call.result != ResultName(result);
+
+        // Functions past xrCreateInstance are resolved with the instance.
+        runtime.SetInstance(state.instance);
+    }
+}
+
+static double Mean(const std::vector<uint64_t>& durations)
+{
+    double sum = 0;
+    for (uint64_t duration : durations)
+        sum += (double)duration;
+    return durations.empty() ? 0 : sum / durations.size();
+}
+
+// durations sorted.
+static uint64_t Percentile(const std::vector<uint64_t>& durations, uint32_t percent)
+{
+    return durations.empty() ? 0 : durations[(durations.size() - 1) * percent / 100];
+}
+
+static void PrintReport(ReplayReport& report)
+{
+    printf("%-40s %8s %12s %12s %12s %12s %12s %8s\n", "function", "calls", "captured_us", "replayed_us", "p50_us", "p99_us", "max_us", "results");
+    for (auto& function : report.functions)
+    {
+        FunctionReport& times = function.second;
+        std::sort(times.replayed.begin(), times.replayed.end());
+        printf("%-40s %8zu %12.3f %12.3f %12.3f %12.3f %12.3f %8u\n", function.first.c_str(), times.replayed.size(), Mean(times.captured) / 1000,
+            Mean(times.replayed) / 1000, Percentile(times.replayed, 50) / 1000.0, Percentile(times.replayed, 99) / 1000.0,
+            times.replayed.back() / 1000.0, times.differentResults);
+    }
+    printf("skipped %u, unsupported %u, approximated %u, unmapped handles %u\n", report.skipped, report.unsupported, report.approximated, report.unmapped);
+}
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+        "usage: trace_replay [options] runtime input...\n"
+        "  --paced  start calls as far apart as they were captured instead of back to back\n");
+}
+
+int main(int argc, char** argv)
+{
+    bool paced = false;
+    const char* runtimePath = nullptr;
+    std::vector<const char*> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--paced") == 0)
+            paced = true;
+        else if (arg[0] == '-')
+        {
+            PrintUsage();
+            return 2;
+        }
+        else if (runtimePath == nullptr)
+            runtimePath = arg;
+        else
+            inputs.push_back(arg);
+    }
+    if (inputs.empty())
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    int status = 0;
+    TraceDecoder decoder;
+    CallCollector collector;
+    for (const char* input : inputs)
+    {
+        std::string error;
+        if (!DecodeTracePath(decoder, input, collector, error))
+        {
+            // Calls decoded up to the error are still replayed.
+            fprintf(stderr, "%s\n", error.c_str());
+            status = 1;
+        }
+    }
+    std::stable_sort(collector.calls.begin(), collector.calls.end(), [](const CapturedCall& a, const CapturedCall& b) { return a.startTime < b.startTime; });
+
+    Runtime runtime;
+    std::string error;
+    if (!runtime.Load(runtimePath, error))
+    {
+        fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    ReplayReport report;
+    Replay(runtime, collector.calls, paced, report);
+    PrintReport(report);
+    return status;
+}
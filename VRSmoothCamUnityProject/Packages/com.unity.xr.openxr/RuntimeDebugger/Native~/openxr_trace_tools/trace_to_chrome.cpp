@@ -0,0 +1,66 @@
+// Converts runtime debugger captures to Chrome trace event JSON, see trace_export_chrome.h.
+// Build and run with for example:
+//   g++ -std=c++14 -O2 trace_to_chrome.cpp -o trace_to_chrome
+//   ./trace_to_chrome -o capture.json /sdcard/traces/openxr_trace_1234_*.oxrt
+// Inputs are trace files from StartFileSink or raw payloads saved from GetDataForRead, decoded in the order given.
+// Returns non-zero if an input can't be decoded or the output can't be written.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../openxr_runtime_debugger/trace_export_chrome.h"
+#include "trace_file_reader.h"
+
+static void PrintUsage()
+{
+    fprintf(stderr, "usage: trace_to_chrome [-o output.json] input...\n");
+}
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = nullptr;
+    int firstInput = 1;
+    if (argc > 2 && strcmp(argv[1], "-o") == 0)
+    {
+        outputPath = argv[2];
+        firstInput = 3;
+    }
+    if (firstInput >= argc)
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    FILE* out = outputPath != nullptr ? fopen(outputPath, "wb") : stdout;
+    if (out == nullptr)
+    {
+        fprintf(stderr, "%s: %s\n", outputPath, strerror(errno));
+        return 1;
+    }
+
+    int status = 0;
+    TraceDecoder decoder;
+    ChromeTraceWriter writer(out);
+    for (int i = firstInput; i < argc; ++i)
+    {
+        std::string error;
+        if (!DecodeTracePath(decoder, argv[i], writer, error))
+        {
+            // Everything decoded up to the error is kept.
+            fprintf(stderr, "%s\n", error.c_str());
+            status = 1;
+        }
+    }
+
+    if (!writer.Finish())
+    {
+        fprintf(stderr, "%s: write failed\n", outputPath != nullptr ? outputPath : "stdout");
+        status = 1;
+    }
+    if (out != stdout)
+        fclose(out);
+
+    if (writer.LostCalls() != 0)
+        fprintf(stderr, "%llu calls skipped, their start time was lost to dropped data\n", (unsigned long long)writer.LostCalls());
+    return status;
+}
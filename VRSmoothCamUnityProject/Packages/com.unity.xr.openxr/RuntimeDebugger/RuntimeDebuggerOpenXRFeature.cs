@@ -0,0 +1,819 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using UnityEditor;
+using UnityEngine.Networking.PlayerConnection;
+
+#if UNITY_EDITOR
+using UnityEditor.XR.OpenXR.Features;
+using UnityEditor.XR.OpenXR.Features.RuntimeDebugger;
+#endif
+
+namespace UnityEngine.XR.OpenXR.Features.RuntimeDebugger
+{
+    /// <summary>
+    /// A runtime debugger feature.  Intercepts all OpenXR calls and forwards them over player connection to an editor window.
+    /// </summary>
+    #if UNITY_EDITOR
+    [OpenXRFeature(UiName = "Runtime Debugger",
+        BuildTargetGroups = new []{BuildTargetGroup.Standalone, BuildTargetGroup.WSA, BuildTargetGroup.Android},
+        Company = "Unity",
+        Desc = "Enables debugging of OpenXR calls and dumping runtime info.",
+        DocumentationLink = "",
+        FeatureId = "com.unity.openxr.features.runtimedebugger",
+        OpenxrExtensionStrings = "",
+        Version = "1")]
+    #endif
+    public class RuntimeDebuggerOpenXRFeature : OpenXRFeature
+    {
+        /// <summary>
+        /// What the debugger records for each intercepted call.
+        /// </summary>
+        public enum CaptureMode
+        {
+            /// <summary>
+            /// Every captured call is serialized with its parameters and sent to the debugger window.
+            /// </summary>
+            Full,
+
+            /// <summary>
+            /// Nothing is sent.  Every call is timed and aggregated per function, read with <see cref="GetStatistics"/>.
+            /// </summary>
+            Statistics,
+        }
+
+        /// <summary>
+        /// Aggregated statistics for one OpenXR function, across all threads.  Durations are in nanoseconds.
+        /// </summary>
+        public struct FunctionStatistics
+        {
+            /// <summary>OpenXR function name.</summary>
+            public string functionName;
+            /// <summary>Number of threads that called the function.</summary>
+            public UInt32 threadCount;
+            /// <summary>Number of calls.</summary>
+            public UInt64 calls;
+            /// <summary>Calls that returned an error.</summary>
+            public UInt64 errors;
+            /// <summary>Shortest call.</summary>
+            public UInt64 minDuration;
+            /// <summary>Longest call.</summary>
+            public UInt64 maxDuration;
+            /// <summary>Average call.</summary>
+            public UInt64 meanDuration;
+            /// <summary>Median call, accurate to the latency histogram's bucket size (about 40%).</summary>
+            public UInt64 p50Duration;
+            /// <summary>99th percentile call, accurate to the latency histogram's bucket size (about 40%).</summary>
+            public UInt64 p99Duration;
+            /// <summary>Estimate of the bytes full capture would have sent for these calls.</summary>
+            public UInt64 estimatedBytes;
+        }
+
+        // Matches FunctionStatsSnapshot in serialize_data_access.h.
+        [StructLayout(LayoutKind.Sequential)]
+        private struct NativeFunctionStatistics
+        {
+            public UInt32 functionId;
+            public UInt32 threadCount;
+            public UInt64 calls;
+            public UInt64 errors;
+            public UInt64 minDuration;
+            public UInt64 maxDuration;
+            public UInt64 meanDuration;
+            public UInt64 p50Duration;
+            public UInt64 p99Duration;
+            public UInt64 estimatedBytes;
+        }
+
+        /// <summary>
+        /// What the debugger cost one thread, see <see cref="GetOverheadStatistics"/>.  Times are in nanoseconds.
+        /// The histograms have a bucket per half power of two nanoseconds: buckets 0 and 1 hold 0 and 1 ns, bucket b from 2
+        /// on starts at 2^(b/2) ns, plus half of that if b is odd, and the last one holds everything over about 2 s.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct ThreadOverheadStatistics
+        {
+            /// <summary>The thread's index in the debugger window, 0xFFFFFFFF if none of its calls were captured.</summary>
+            public UInt32 threadIndex;
+            private UInt32 padding;
+            /// <summary>Calls timed on the thread.</summary>
+            public UInt64 calls;
+            /// <summary>Time spent in the runtime by those calls.</summary>
+            public UInt64 runtimeTime;
+            /// <summary>Time spent in the debugger by those calls, including <see cref="drainTime"/> and <see cref="lockWaitTime"/>.  The rest is capture and serialization.</summary>
+            public UInt64 overheadTime;
+            /// <summary>Most time spent in the debugger by one call.</summary>
+            public UInt64 maxOverhead;
+            /// <summary>Median time spent in the debugger by a call, accurate to the histogram's bucket size.</summary>
+            public UInt64 p50Overhead;
+            /// <summary>99th percentile time spent in the debugger by a call, accurate to the histogram's bucket size.</summary>
+            public UInt64 p99Overhead;
+            /// <summary>Times the thread moved every thread's calls to the main cache because its own buffer was filling up.</summary>
+            public UInt64 drains;
+            /// <summary>Time spent in those moves.</summary>
+            public UInt64 drainTime;
+            /// <summary>Times the thread skipped moving calls because another thread was already doing it.</summary>
+            public UInt64 contendedDrains;
+            /// <summary>Times the thread waited for another one sharing the overflow buffer, see <see cref="threadMemoryBudget"/>.</summary>
+            public UInt64 lockWaits;
+            /// <summary>Time spent in those waits.</summary>
+            public UInt64 lockWaitTime;
+            /// <summary>Calls by time spent in the debugger.</summary>
+            [MarshalAs(UnmanagedType.ByValArray, SizeConst = 64)]
+            public UInt32[] overheadHistogram;
+            /// <summary>Lock waits by time waited.</summary>
+            [MarshalAs(UnmanagedType.ByValArray, SizeConst = 64)]
+            public UInt32[] lockWaitHistogram;
+        }
+
+        /// <summary>
+        /// Memory used by the runtime debugger on device, see <see cref="GetMemoryStatistics"/>.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct MemoryStatistics
+        {
+            /// <summary>Bytes allocated by the debugger now: caches, per-thread buffers and statistics.</summary>
+            public UInt64 currentBytes;
+            /// <summary>Most bytes the debugger has had allocated at once.</summary>
+            public UInt64 highWaterBytes;
+            /// <summary>Bytes held by per-thread buffers, kept under <see cref="threadMemoryBudget"/>.</summary>
+            public UInt64 perThreadBytes;
+            /// <summary>The <see cref="threadMemoryBudget"/> in effect.</summary>
+            public UInt64 perThreadBudget;
+            /// <summary>Per-thread buffers created so far.  Buffers are reused by new threads once their thread exits.</summary>
+            public UInt32 perThreadBuffers;
+            /// <summary>Per-thread buffers waiting for a new thread.</summary>
+            public UInt32 freePerThreadBuffers;
+            /// <summary>Threads sharing the overflow buffer because the budget was reached.</summary>
+            public UInt32 overflowThreads;
+            private UInt32 padding;
+            /// <summary>Bytes held by calls too large for a per-thread cache, until they're copied to the main cache.</summary>
+            public UInt64 spillBytes;
+            /// <summary>The <see cref="spillBudget"/> in effect.</summary>
+            public UInt64 spillBudget;
+            /// <summary>Calls too large for a per-thread cache that were captured in full.</summary>
+            public UInt64 spilledCalls;
+            /// <summary>Calls too large for a per-thread cache that were only captured by name, because of <see cref="spillBudget"/> or <see cref="cacheSize"/>.</summary>
+            public UInt64 droppedSpilledCalls;
+        }
+
+        /// <summary>
+        /// What froze a flight recorder snapshot, see <see cref="StartFlightRecorder"/>.
+        /// </summary>
+        public enum FreezeTrigger : UInt32
+        {
+            /// <summary>No snapshot was frozen.</summary>
+            None,
+            /// <summary>A call failed while <see cref="SetFreezeOnError"/> was on.</summary>
+            Error,
+            /// <summary>A function passed to <see cref="SetFreezeOnFunctionFailure"/> failed.</summary>
+            FunctionFailure,
+            /// <summary>A frame took longer than <see cref="SetFreezeOnFrameInterval"/> from its xrWaitFrame to the end of its xrEndFrame.</summary>
+            FrameInterval,
+        }
+
+        /// <summary>
+        /// A snapshot frozen by the flight recorder, see <see cref="GetFlightRecorderSnapshot"/>.
+        /// </summary>
+        public class FlightRecorderSnapshot
+        {
+            /// <summary>The captured calls leading up to the trigger, in the format the debugger window reads.</summary>
+            public byte[] data;
+            /// <summary>What froze the snapshot.</summary>
+            public FreezeTrigger trigger;
+            /// <summary>The call that froze the snapshot.</summary>
+            public string functionName;
+            /// <summary>The XrResult it returned.</summary>
+            public Int32 result;
+            /// <summary>The frame it was made in.</summary>
+            public UInt32 frame;
+            /// <summary>Nanoseconds from the start of the session to the end of the call.</summary>
+            public UInt64 time;
+            /// <summary>For <see cref="FreezeTrigger.FrameInterval"/>, nanoseconds from xrWaitFrame to the end of xrEndFrame.</summary>
+            public UInt64 frameInterval;
+        }
+
+        // Matches FreezeCause in flight_recorder.h.
+        [StructLayout(LayoutKind.Sequential)]
+        private struct NativeFreezeCause
+        {
+            public FreezeTrigger trigger;
+            public UInt32 functionId;
+            public Int32 result;
+            public UInt32 frame;
+            public UInt64 time;
+            public UInt64 frameInterval;
+        }
+
+        /// <summary>
+        /// Flight recorder counters, see <see cref="GetFlightRecorderStatistics"/>.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct FlightRecorderStatistics
+        {
+            /// <summary>Snapshots frozen so far.</summary>
+            public UInt64 snapshots;
+            /// <summary>Triggers hit while a snapshot was held.</summary>
+            public UInt64 missedTriggers;
+            /// <summary>Snapshots written to the flight recorder's directory.</summary>
+            public UInt64 snapshotsWritten;
+            /// <summary>Snapshots that couldn't be written to the flight recorder's directory.</summary>
+            public UInt64 writeFailures;
+            /// <summary>1 if the next trigger freezes a snapshot, 0 if one is held.</summary>
+            public UInt32 armed;
+            /// <summary>Size of the snapshot buffer, 0 if the flight recorder isn't running.</summary>
+            public UInt32 snapshotCapacity;
+        }
+
+        internal static readonly Guid kEditorToPlayerRequestDebuggerOutput = new Guid("B3E6DED1-C6C7-411C-BE58-86031A0877E7");
+        internal static readonly Guid kPlayerToEditorSendDebuggerOutput = new Guid("B3E6DED1-C6C7-411C-BE58-86031A0877E8");
+
+        // First byte of a debugger output request.
+        internal const byte kRequestOutput = 0;
+        internal const byte kRequestOutputAndMetadata = 1;
+
+        /// <summary>
+        /// Size of main-thread cache on device for runtime debugger in bytes.
+        /// Two caches of this size are allocated, the editor reads from one while the other keeps filling.
+        /// On Linux and Android, keep it a multiple of the page size so the cache wraps without wasting space.
+        /// </summary>
+        public UInt32 cacheSize=1024*1024;
+
+        /// <summary>
+        /// Size of per-thread cache on device for runtime debugger in bytes.
+        /// </summary>
+        public UInt32 perThreadCacheSize=50*1024;
+
+        /// <summary>
+        /// Most memory the per-thread caches may use between them, in bytes.
+        /// Each thread that captures calls holds about twice <see cref="perThreadCacheSize"/> until it exits.
+        /// Threads that would go over the budget share a single overflow cache, and show up as one "over budget" thread.
+        /// </summary>
+        public UInt32 threadMemoryBudget=4*1024*1024;
+
+        /// <summary>
+        /// Most memory calls too large for <see cref="perThreadCacheSize"/> may hold at once, in bytes.
+        /// Such calls are kept in a separate block until they're copied to the main cache, instead of only being captured by name.
+        /// A single call can't be larger than <see cref="cacheSize"/>.
+        /// </summary>
+        public UInt32 spillBudget=4*1024*1024;
+
+        /// <inheritdoc/>
+        protected override IntPtr HookGetInstanceProcAddr(IntPtr func)
+        {
+            if (!NativeAbiMatches)
+                return func;
+
+            #if !UNITY_EDITOR
+            PlayerConnection.instance.Register(kEditorToPlayerRequestDebuggerOutput, RecvMsg);
+            #endif
+            return Native_HookGetInstanceProcAddr(func, cacheSize, perThreadCacheSize, threadMemoryBudget, spillBudget);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnInstanceDestroy(ulong xrInstance)
+        {
+            // Threads that captured calls and have since exited leave their caches pooled for the next thread.
+            if (NativeAbiMatches)
+                Native_ReleasePooledStreams();
+        }
+
+        // Must match kAbiVersion in runtime_debugger.cpp.
+        private const UInt32 kAbiVersion = 1;
+
+        private bool? nativeAbiMatches;
+
+        // Every call into the plugin checks this first, a stale plugin may not have the export or take other arguments.
+        private bool NativeAbiMatches
+        {
+            get
+            {
+                if (!nativeAbiMatches.HasValue)
+                    nativeAbiMatches = CheckNativeAbi();
+                return nativeAbiMatches.Value;
+            }
+        }
+
+        // Plugins built before GetAbiVersion was exported don't have it.
+        private static bool CheckNativeAbi()
+        {
+            UInt32 version = 0;
+            try
+            {
+                version = Native_GetAbiVersion();
+            }
+            catch (EntryPointNotFoundException)
+            {
+            }
+
+            if (version == kAbiVersion)
+                return true;
+
+            Debug.LogError($"Runtime debugger: the {Library} plugin has ABI version {version}, this package needs {kAbiVersion}. Rebuild it from Native~ with CMake, OpenXR calls won't be captured until then.");
+            return false;
+        }
+
+        /// <summary>
+        /// Turns capture off completely.  While dormant, intercepted calls are forwarded without being recorded or counted.
+        /// </summary>
+        /// <param name="dormant">True to stop capturing, false to resume.</param>
+        public void SetCaptureDormant(bool dormant)
+        {
+            if (NativeAbiMatches)
+                Native_SetCaptureDormant(dormant);
+        }
+
+        /// <summary>
+        /// Sets how often calls to an OpenXR function are captured.  Calls that aren't captured are still counted.
+        /// </summary>
+        /// <param name="functionName">OpenXR function name, for example "xrLocateSpace".</param>
+        /// <param name="sampleRate">0 to never capture, 1 to capture every call, N to capture 1 in N calls.</param>
+        /// <returns>False if the function isn't intercepted by the debugger.</returns>
+        public bool SetFunctionSampleRate(string functionName, UInt32 sampleRate)
+        {
+            if (!NativeAbiMatches)
+                return false;
+
+            return Native_SetFunctionSampleRate(Native_GetFunctionId(functionName), sampleRate);
+        }
+
+        /// <summary>
+        /// Sets how often calls to every OpenXR function are captured.
+        /// </summary>
+        /// <param name="sampleRate">0 to never capture, 1 to capture every call, N to capture 1 in N calls.</param>
+        public void SetAllFunctionsSampleRate(UInt32 sampleRate)
+        {
+            if (NativeAbiMatches)
+                Native_SetAllFunctionsSampleRate(sampleRate);
+        }
+
+        /// <summary>
+        /// Gets how many times an OpenXR function was called while capture wasn't dormant, and how many of those calls were captured.
+        /// </summary>
+        /// <param name="functionName">OpenXR function name, for example "xrLocateSpace".</param>
+        /// <param name="calls">Total calls, across all threads.</param>
+        /// <param name="captured">Calls that were captured, across all threads.</param>
+        /// <returns>False if the function isn't intercepted by the debugger.</returns>
+        public bool GetFunctionCallCounts(string functionName, out UInt64 calls, out UInt64 captured)
+        {
+            if (!NativeAbiMatches)
+            {
+                calls = 0;
+                captured = 0;
+                return false;
+            }
+
+            return Native_GetFunctionCallCounts(Native_GetFunctionId(functionName), out calls, out captured);
+        }
+
+        /// <summary>
+        /// Switches between sending full captures and only aggregating per-function statistics.
+        /// </summary>
+        /// <param name="mode">The new capture mode.</param>
+        /// <returns>False if the native plugin doesn't support the mode, capture carries on in the previous one.</returns>
+        public bool SetCaptureMode(CaptureMode mode)
+        {
+            if (!NativeAbiMatches)
+                return false;
+
+            if (Native_SetCaptureMode((UInt32)mode))
+                return true;
+
+            Debug.LogError($"Runtime debugger: capture mode {mode} isn't supported by the native plugin.");
+            return false;
+        }
+
+        /// <summary>
+        /// Moves serializing captured calls off the calling threads onto a background thread. The calling threads only copy
+        /// each call's arguments, calls that don't fit in the copy buffer are still serialized where they're made.
+        /// </summary>
+        /// <param name="deferred">True to format calls on the background thread, false to format them on the calling thread.</param>
+        public void SetDeferredFormatting(bool deferred)
+        {
+            if (NativeAbiMatches)
+                Native_SetDeferredFormatting(deferred);
+        }
+
+        /// <summary>
+        /// Records each captured call's parameters as they were passed in as well as how the runtime left them, so captures
+        /// can be replayed against a runtime with trace_replay.  Costs a copy of the parameters before every captured call.
+        /// </summary>
+        /// <param name="record">True to record the parameters passed in, false to only record them after the call.</param>
+        public void SetRecordInputs(bool record)
+        {
+            if (NativeAbiMatches)
+                Native_SetRecordInputs(record);
+        }
+
+        /// <summary>
+        /// Gets the statistics gathered in <see cref="CaptureMode.Statistics"/> mode since the last <see cref="ResetStatistics"/>.
+        /// </summary>
+        /// <returns>One entry per function that was called.</returns>
+        public FunctionStatistics[] GetStatistics()
+        {
+            if (!NativeAbiMatches)
+                return new FunctionStatistics[0];
+
+            var snapshots = new NativeFunctionStatistics[Native_GetFunctionCount()];
+            var count = Native_GetStatsSnapshot(snapshots, (UInt32)snapshots.Length);
+            var statistics = new FunctionStatistics[count];
+            for (int i = 0; i < count; ++i)
+            {
+                var snapshot = snapshots[i];
+                statistics[i] = new FunctionStatistics
+                {
+                    functionName = Marshal.PtrToStringAnsi(Native_GetFunctionName(snapshot.functionId)),
+                    threadCount = snapshot.threadCount,
+                    calls = snapshot.calls,
+                    errors = snapshot.errors,
+                    minDuration = snapshot.minDuration,
+                    maxDuration = snapshot.maxDuration,
+                    meanDuration = snapshot.meanDuration,
+                    p50Duration = snapshot.p50Duration,
+                    p99Duration = snapshot.p99Duration,
+                    estimatedBytes = snapshot.estimatedBytes,
+                };
+            }
+            return statistics;
+        }
+
+        /// <summary>
+        /// Times the debugger's own work in every captured or timed call, for <see cref="GetOverheadStatistics"/> and
+        /// <see cref="SetOverheadBudget"/>.  Off by default, measuring adds two timestamps to each call.
+        /// </summary>
+        /// <param name="measure">True to measure the debugger's overhead.</param>
+        public void SetMeasureOverhead(bool measure)
+        {
+            if (NativeAbiMatches)
+                Native_SetMeasureOverhead(measure);
+        }
+
+        /// <summary>
+        /// Gets what the debugger cost each thread since the last <see cref="ResetStatistics"/>: its time in the intercepted calls
+        /// on top of the runtime's, and how much of that was spent moving calls to the main cache or waiting for other threads.
+        /// Calls are only timed while <see cref="SetMeasureOverhead"/> is on, moving calls and waiting always are.
+        /// Calls that aren't captured or timed, see <see cref="SetFunctionSampleRate"/>, cost next to nothing and aren't counted.
+        /// </summary>
+        /// <returns>One entry per thread that made a call.</returns>
+        public ThreadOverheadStatistics[] GetOverheadStatistics()
+        {
+            if (!NativeAbiMatches)
+                return new ThreadOverheadStatistics[0];
+
+            // Threads that start in between are left out.
+            var size = Marshal.SizeOf<ThreadOverheadStatistics>();
+            var capacity = Native_GetThreadCount();
+            var buffer = Marshal.AllocHGlobal(size * (int)Math.Max(capacity, 1));
+            try
+            {
+                var count = Native_GetOverheadSnapshot(buffer, capacity);
+                var statistics = new ThreadOverheadStatistics[count];
+                for (int i = 0; i < count; ++i)
+                    statistics[i] = Marshal.PtrToStructure<ThreadOverheadStatistics>(buffer + i * size);
+                return statistics;
+            }
+            finally
+            {
+                Marshal.FreeHGlobal(buffer);
+            }
+        }
+
+        /// <summary>
+        /// Sends a report to the debugger window for every frame in which the debugger's own time, added up over every
+        /// thread, goes over a budget.  Needs <see cref="SetMeasureOverhead"/>.  Reports are sent by xrEndFrame, so only while it's captured.
+        /// </summary>
+        /// <param name="nanosecondsPerFrame">Debugger time allowed per frame, 0 to send no reports.</param>
+        public void SetOverheadBudget(UInt64 nanosecondsPerFrame)
+        {
+            if (NativeAbiMatches)
+                Native_SetOverheadBudget(nanosecondsPerFrame);
+        }
+
+        /// <summary>
+        /// Clears the statistics on every thread.
+        /// </summary>
+        public void ResetStatistics()
+        {
+            if (NativeAbiMatches)
+                Native_ResetStats();
+        }
+
+        /// <summary>
+        /// Starts streaming every captured call into memory-mapped trace files on the device, independently of the editor.
+        /// A new file is started every <paramref name="fileSize"/> bytes.  Not supported on Windows.
+        /// The sink can also be started without code by setting the OPENXR_RUNTIME_DEBUGGER_TRACE_DIR environment variable,
+        /// with OPENXR_RUNTIME_DEBUGGER_TRACE_FILE_SIZE and OPENXR_RUNTIME_DEBUGGER_TRACE_MAX_FILES optionally overriding the defaults.
+        /// </summary>
+        /// <param name="directory">Existing directory to write the trace files to.</param>
+        /// <param name="fileSize">Size of each trace file in bytes.</param>
+        /// <param name="maxFiles">Number of most recent files to keep, 0 to keep all of them.</param>
+        /// <returns>False if the first trace file couldn't be created.</returns>
+        public bool StartFileSink(string directory, UInt32 fileSize = 64 * 1024 * 1024, UInt32 maxFiles = 0)
+        {
+            if (!NativeAbiMatches)
+                return false;
+
+            return Native_StartFileSink(directory, fileSize, maxFiles);
+        }
+
+        /// <summary>
+        /// Writes out everything captured so far and stops the trace file sink.
+        /// </summary>
+        public void StopFileSink()
+        {
+            if (NativeAbiMatches)
+                Native_StopFileSink();
+        }
+
+        /// <summary>
+        /// Gets how many records the trace file sink dropped because the next trace file wasn't ready in time.
+        /// </summary>
+        /// <returns>Dropped records since the debugger was loaded.</returns>
+        public UInt64 GetFileSinkDroppedRecords()
+        {
+            if (!NativeAbiMatches)
+                return 0;
+
+            return Native_GetFileSinkDroppedRecords();
+        }
+
+        /// <summary>
+        /// Gets how much memory the debugger is using on device, and the most it has used at once.
+        /// </summary>
+        /// <returns>Current and high water memory use.</returns>
+        public MemoryStatistics GetMemoryStatistics()
+        {
+            if (!NativeAbiMatches)
+                return new MemoryStatistics();
+
+            Native_GetMemoryStats(out var stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Starts keeping a copy of the newest captured calls whenever a trigger is hit, so the calls leading up to an error
+        /// or a long frame can be looked at without the editor attached.  Capture carries on as usual.  Only captured calls
+        /// hit triggers, and the copy only has the calls the editor hasn't read yet.  The copy is made on a background thread
+        /// just after the trigger, so it can also have the first few calls after it.
+        /// A snapshot is held until <see cref="RearmFlightRecorder"/>.  With a directory, every snapshot is also written to it
+        /// as a trace file readable by trace_dump, and the flight recorder rearms once it's written.
+        /// Set the triggers with <see cref="SetFreezeOnError"/>, <see cref="SetFreezeOnFunctionFailure"/> and <see cref="SetFreezeOnFrameInterval"/>.
+        /// </summary>
+        /// <param name="snapshotSize">Bytes allocated up front for snapshots.  Newer calls are kept over older ones when they don't all fit.</param>
+        /// <param name="directory">Existing directory to write snapshots to, null to only keep them in memory.</param>
+        /// <returns>False if the snapshot buffer couldn't be allocated.</returns>
+        public bool StartFlightRecorder(UInt32 snapshotSize = 4 * 1024 * 1024, string directory = null)
+        {
+            if (!NativeAbiMatches)
+                return false;
+
+            return Native_StartFlightRecorder(snapshotSize, directory);
+        }
+
+        /// <summary>
+        /// Stops the flight recorder and frees its snapshot.
+        /// </summary>
+        public void StopFlightRecorder()
+        {
+            if (NativeAbiMatches)
+                Native_StopFlightRecorder();
+        }
+
+        /// <summary>
+        /// Freezes a snapshot when any captured call fails.
+        /// </summary>
+        /// <param name="freeze">True to freeze on every failure.</param>
+        public void SetFreezeOnError(bool freeze)
+        {
+            if (NativeAbiMatches)
+                Native_SetFreezeOnError(freeze);
+        }
+
+        /// <summary>
+        /// Freezes a snapshot when a captured call to an OpenXR function fails.
+        /// </summary>
+        /// <param name="functionName">OpenXR function name, for example "xrEndFrame".</param>
+        /// <param name="freeze">True to freeze when it fails.</param>
+        /// <returns>False if the function isn't intercepted by the debugger.</returns>
+        public bool SetFreezeOnFunctionFailure(string functionName, bool freeze)
+        {
+            if (!NativeAbiMatches)
+                return false;
+
+            return Native_SetFreezeOnFunctionFailure(Native_GetFunctionId(functionName), freeze);
+        }
+
+        /// <summary>
+        /// Freezes a snapshot when a frame takes longer than the given time from the start of its xrWaitFrame to the end of its xrEndFrame.
+        /// </summary>
+        /// <param name="nanoseconds">Longest frame allowed, 0 to turn the trigger off.</param>
+        public void SetFreezeOnFrameInterval(UInt64 nanoseconds)
+        {
+            if (NativeAbiMatches)
+                Native_SetFreezeOnFrameInterval(nanoseconds);
+        }
+
+        /// <summary>
+        /// Lets the next trigger freeze a new snapshot in place of the one held.
+        /// </summary>
+        public void RearmFlightRecorder()
+        {
+            if (NativeAbiMatches)
+                Native_RearmFlightRecorder();
+        }
+
+        /// <summary>
+        /// Gets a copy of the snapshot the flight recorder froze last.
+        /// </summary>
+        /// <returns>Null if no snapshot was frozen since the flight recorder started.</returns>
+        public FlightRecorderSnapshot GetFlightRecorderSnapshot()
+        {
+            if (!NativeAbiMatches || !Native_StartSnapshotAccess(out var ptr, out var size, out var cause))
+                return null;
+
+            var data = new byte[size];
+            if (size > 0)
+                Marshal.Copy(ptr, data, 0, (int)size);
+            Native_EndSnapshotAccess();
+
+            return new FlightRecorderSnapshot
+            {
+                data = data,
+                trigger = cause.trigger,
+                functionName = Marshal.PtrToStringAnsi(Native_GetFunctionName(cause.functionId)),
+                result = cause.result,
+                frame = cause.frame,
+                time = cause.time,
+                frameInterval = cause.frameInterval,
+            };
+        }
+
+        /// <summary>
+        /// Gets how many snapshots the flight recorder froze and wrote, and how many triggers it missed.
+        /// </summary>
+        /// <returns>Counters since the debugger was loaded.</returns>
+        public FlightRecorderStatistics GetFlightRecorderStatistics()
+        {
+            if (!NativeAbiMatches)
+                return new FlightRecorderStatistics();
+
+            Native_GetFlightRecorderStats(out var stats);
+            return stats;
+        }
+
+        internal void RecvMsg(MessageEventArgs args)
+        {
+            if (!NativeAbiMatches)
+                return;
+
+            if (args.data != null && args.data.Length > 0 && args.data[0] == kRequestOutputAndMetadata)
+                Native_RequestMetadata();
+
+            Native_StartDataAccess();
+
+            // metadata and ring buffer on native side, so might get several chunks of data
+            var chunks = new List<byte[]>();
+            int dataSize = 0;
+            bool more;
+            do
+            {
+                more = Native_GetDataForRead(out var ptr, out var size);
+                var chunk = new byte[size];
+                if (size > 0)
+                    Marshal.Copy(ptr, chunk, 0, (int)size);
+                chunks.Add(chunk);
+                dataSize += (int)size;
+            } while (more);
+
+            Native_EndDataAccess();
+
+            // Usually a single chunk, the cache is read in one piece where the native side can mirror it.
+            byte[] data = chunks.Count == 1 ? chunks[0] : new byte[dataSize];
+            if (chunks.Count > 1)
+            {
+                int offset = 0;
+                foreach (var chunk in chunks)
+                {
+                    Buffer.BlockCopy(chunk, 0, data, offset, chunk.Length);
+                    offset += chunk.Length;
+                }
+            }
+
+            #if !UNITY_EDITOR
+            PlayerConnection.instance.Send(kPlayerToEditorSendDebuggerOutput, data);
+            #else
+            DebuggerState.OnMessageEvent(new MessageEventArgs() { playerId = 0, data = data});
+            #endif
+        }
+
+        private const string Library = "openxr_runtime_debugger";
+        [DllImport(Library, EntryPoint = "GetAbiVersion")]
+        private static extern UInt32 Native_GetAbiVersion();
+
+        [DllImport(Library, EntryPoint = "HookXrInstanceProcAddr")]
+        private static extern IntPtr Native_HookGetInstanceProcAddr(IntPtr func, UInt32 cacheSize, UInt32 perThreadCacheSize, UInt32 threadMemoryBudget, UInt32 spillBudget);
+
+        [DllImport(Library, EntryPoint = "GetDataForRead")]
+        private static extern bool Native_GetDataForRead(out IntPtr ptr, out UInt32 size);
+
+        [DllImport(Library, EntryPoint = "StartDataAccess")]
+        private static extern void Native_StartDataAccess();
+
+        [DllImport(Library, EntryPoint = "EndDataAccess")]
+        private static extern void Native_EndDataAccess();
+
+        [DllImport(Library, EntryPoint = "RequestMetadata")]
+        private static extern void Native_RequestMetadata();
+
+        [DllImport(Library, EntryPoint = "SetCaptureDormant")]
+        private static extern void Native_SetCaptureDormant(bool dormant);
+
+        [DllImport(Library, EntryPoint = "GetFunctionId")]
+        private static extern UInt32 Native_GetFunctionId(string name);
+
+        [DllImport(Library, EntryPoint = "SetFunctionSampleRate")]
+        private static extern bool Native_SetFunctionSampleRate(UInt32 id, UInt32 rate);
+
+        [DllImport(Library, EntryPoint = "SetAllFunctionsSampleRate")]
+        private static extern void Native_SetAllFunctionsSampleRate(UInt32 rate);
+
+        [DllImport(Library, EntryPoint = "GetFunctionCallCounts")]
+        private static extern bool Native_GetFunctionCallCounts(UInt32 id, out UInt64 calls, out UInt64 captured);
+
+        [DllImport(Library, EntryPoint = "SetCaptureMode")]
+        private static extern bool Native_SetCaptureMode(UInt32 mode);
+
+        [DllImport(Library, EntryPoint = "SetDeferredFormatting")]
+        private static extern void Native_SetDeferredFormatting(bool deferred);
+
+        [DllImport(Library, EntryPoint = "SetRecordInputs")]
+        private static extern void Native_SetRecordInputs(bool record);
+
+        [DllImport(Library, EntryPoint = "GetFunctionCount")]
+        private static extern UInt32 Native_GetFunctionCount();
+
+        [DllImport(Library, EntryPoint = "GetFunctionName")]
+        private static extern IntPtr Native_GetFunctionName(UInt32 id);
+
+        [DllImport(Library, EntryPoint = "GetStatsSnapshot")]
+        private static extern UInt32 Native_GetStatsSnapshot([Out] NativeFunctionStatistics[] snapshots, UInt32 capacity);
+
+        [DllImport(Library, EntryPoint = "SetMeasureOverhead")]
+        private static extern void Native_SetMeasureOverhead(bool measure);
+
+        [DllImport(Library, EntryPoint = "GetThreadCount")]
+        private static extern UInt32 Native_GetThreadCount();
+
+        [DllImport(Library, EntryPoint = "GetOverheadSnapshot")]
+        private static extern UInt32 Native_GetOverheadSnapshot(IntPtr snapshots, UInt32 capacity);
+
+        [DllImport(Library, EntryPoint = "SetOverheadBudget")]
+        private static extern void Native_SetOverheadBudget(UInt64 nanosecondsPerFrame);
+
+        [DllImport(Library, EntryPoint = "ResetStats")]
+        private static extern void Native_ResetStats();
+
+        [DllImport(Library, EntryPoint = "StartFileSink")]
+        private static extern bool Native_StartFileSink(string directory, UInt32 fileSize, UInt32 maxFiles);
+
+        [DllImport(Library, EntryPoint = "StopFileSink")]
+        private static extern void Native_StopFileSink();
+
+        [DllImport(Library, EntryPoint = "GetFileSinkDroppedRecords")]
+        private static extern UInt64 Native_GetFileSinkDroppedRecords();
+
+        [DllImport(Library, EntryPoint = "GetMemoryStats")]
+        private static extern void Native_GetMemoryStats(out MemoryStatistics stats);
+
+        [DllImport(Library, EntryPoint = "ReleasePooledStreams")]
+        private static extern void Native_ReleasePooledStreams();
+
+        [DllImport(Library, EntryPoint = "StartFlightRecorder")]
+        private static extern bool Native_StartFlightRecorder(UInt32 snapshotSize, string directory);
+
+        [DllImport(Library, EntryPoint = "StopFlightRecorder")]
+        private static extern void Native_StopFlightRecorder();
+
+        [DllImport(Library, EntryPoint = "SetFreezeOnError")]
+        private static extern void Native_SetFreezeOnError(bool freeze);
+
+        [DllImport(Library, EntryPoint = "SetFreezeOnFunctionFailure")]
+        private static extern bool Native_SetFreezeOnFunctionFailure(UInt32 functionId, bool freeze);
+
+        [DllImport(Library, EntryPoint = "SetFreezeOnFrameInterval")]
+        private static extern void Native_SetFreezeOnFrameInterval(UInt64 nanoseconds);
+
+        [DllImport(Library, EntryPoint = "RearmFlightRecorder")]
+        private static extern void Native_RearmFlightRecorder();
+
+        [DllImport(Library, EntryPoint = "StartSnapshotAccess")]
+        private static extern bool Native_StartSnapshotAccess(out IntPtr ptr, out UInt32 size, out NativeFreezeCause cause);
+
+        [DllImport(Library, EntryPoint = "EndSnapshotAccess")]
+        private static extern void Native_EndSnapshotAccess();
+
+        [DllImport(Library, EntryPoint = "GetFlightRecorderStats")]
+        private static extern void Native_GetFlightRecorderStats(out FlightRecorderStatistics stats);
+    }
+}
+
@@ -0,0 +1,71 @@
+#include "IUnityInterface.h"
+#include "XR/IUnityXRMeshing.h"
+#include <cstring>
+
+static IUnityXRMeshInterface* s_Meshing = nullptr;
+
+float positionsTeapot[] =
+    {5.929688f, 4.125f, 0.0f, 5.387188f, 4.125f, 2.7475f, 5.2971f, 4.494141f, 2.70917f, 5.832031f, 4.494141f, 0.0f, 5.401602f, 4.617188f, 2.753633f, 5.945313f, 4.617188f, 0.0f, 5.614209f, 4.494141f, 2.844092f, 6.175781f, 4.494141f, 0.0f, 5.848437f, 4.125f, 2.94375f, 6.429688f, 4.125f, 0.0f, 3.899688f, 4.125f, 4.97f, 3.830352f, 4.494141f, 4.900664f, 3.910782f, 4.617188f, 4.981094f, 4.074414f, 4.494141f, 5.144727f, 4.254687f, 4.125f, 5.325f, 1.677188f, 4.125f, 6.4575f, 1.638858f, 4.494141f, 6.367412f, 1.68332f, 4.617188f, 6.471914f, 1.77378f, 4.494141f, 6.684522f, 1.873438f, 4.125f, 6.91875f, -1.070312f, 4.125f, 7.0f, -1.070312f, 4.494141f, 6.902344f, -1.070312f, 4.617188f, 7.015625f, -1.070312f, 4.494141f, 7.246094f, -1.070312f, 4.125f, 7.5f, -1.070312f, 4.125f, 7.0f, -4.007656f, 4.125f, 6.4575f, -3.859572f, 4.494141f, 6.367412f, -1.070312f, 4.494141f, 6.902344f, -3.847676f, 4.617188f, 6.471914f, -1.070312f, 4.617188f, 7.015625f, -3.917371f, 4.494141f, 6.684522f, -1.070312f, 4.494141f, 7.246094f, -4.014062f, 4.125f, 6.91875f, -1.070312f, 4.125f, 7.5f, -6.209063f, 4.125f, 4.97f, -6.042168f, 4.494141f, 4.900664f, -6.0725f, 4.617188f, 4.981094f, -6.217675f, 4.494141f, 5.144727f, -6.395312f, 4.125f, 5.325f, -7.591093f, 4.125f, 2.7475f, -7.464421f, 4.494141f, 2.70917f, -7.550137f, 4.617188f, 2.753633f, -7.755822f, 4.494141f, 2.844092f, -7.989062f, 4.125f, 2.94375f, -8.070313f, 4.125f, 0.0f, -7.972656f, 4.494141f, 0.0f, -8.085938f, 4.617188f, 0.0f, -8.316406f, 4.494141f, 0.0f, -8.570313f, 4.125f, 0.0f, -8.070313f, 4.125f, 0.0f, -7.527812f, 4.125f, -2.7475f, -7.437724f, 4.494141f, -2.70917f, -7.972656f, 4.494141f, 0.0f, -7.542227f, 4.617188f, -2.753633f, -8.085938f, 4.617188f, 0.0f, -7.754834f, 4.494141f, -2.844092f, -8.316406f, 4.494141f, 0.0f, -7.989062f, 4.125f, -2.94375f, -8.570313f, 4.125f, 0.0f, -6.040312f, 4.125f, -4.97f, -5.970977f, 4.494141f, -4.900664f, -6.051406f, 4.617188f, -4.981094f, -6.215039f, 4.494141f, -5.144727f, -6.395312f, 4.125f, -5.325f, -3.817812f, 4.125f, -6.4575f, -3.779482f, 4.494141f, -6.367412f, -3.823945f, 4.617188f, -6.471914f, -3.914404f, 4.494141f, -6.684522f, -4.014062f, 4.125f, -6.91875f, -1.070312f, 4.125f, -7.0f, -1.070312f, 4.494141f, -6.902344f, -1.070312f, 4.617188f, -7.015625f, -1.070312f, 4.494141f, -7.246094f, -1.070312f, 4.125f, -7.5f, -1.070312f, 4.125f, -7.0f, 1.677188f, 4.125f, -6.4575f, 1.638858f, 4.494141f, -6.367412f, -1.070312f, 4.494141f, -6.902344f, 1.68332f, 4.617188f, -6.471914f, -1.070312f, 4.617188f, -7.015625f, 1.77378f, 4.494141f, -6.684522f, -1.070312f, 4.494141f, -7.246094f, 1.873438f, 4.125f, -6.91875f, -1.070312f, 4.125f, -7.5f, 3.899688f, 4.125f, -4.97f, 3.830352f, 4.494141f, -4.900664f, 3.910782f, 4.617188f, -4.981094f, 4.074414f, 4.494141f, -5.144727f, 4.254687f, 4.125f, -5.325f, 5.387188f, 4.125f, -2.7475f, 5.2971f, 4.494141f, -2.70917f, 5.401602f, 4.617188f, -2.753633f, 5.614209f, 4.494141f, -2.844092f, 5.848437f, 4.125f, -2.94375f, 5.929688f, 4.125f, 0.0f, 5.832031f, 4.494141f, 0.0f, 5.945313f, 4.617188f, 0.0f, 6.175781f, 4.494141f, 0.0f, 6.429688f, 4.125f, 0.0f, 6.429688f, 4.125f, 0.0f, 5.848437f, 4.125f, 2.94375f, 6.695264f, 2.162109f, 3.304053f, 7.347656f, 2.162109f, 0.0f, 7.433985f, 0.234375f, 3.61836f, 8.148438f, 0.234375f, 0.0f, 7.956494f, -1.623047f, 3.840674f, 8.714844f, -1.623047f, 0.0f, 8.154688f, -3.375f, 3.925f, 8.929688f, -3.375f, 0.0f, 4.254687f, 4.125f, 5.325f, 4.906446f, 2.162109f, 5.976758f, 5.475f, 0.234375f, 6.545312f, 5.877149f, -1.623047f, 6.947461f, 6.029688f, -3.375f, 7.1f, 1.873438f, 4.125f, 6.91875f, 2.23374f, 2.162109f, 7.765576f, 2.548047f, 0.234375f, 8.504297f, 2.770362f, -1.623047f, 9.026807f, 2.854688f, -3.375f, 9.225f, -1.070312f, 4.125f, 7.5f, -1.070312f, 2.162109f, 8.417969f, -1.070312f, 0.234375f, 9.21875f, -1.070312f, -1.623047f, 9.785156f, -1.070312f, -3.375f, 10.0f, -1.070312f, 4.125f, 7.5f, -4.014062f, 4.125f, 6.91875f, -4.374365f, 2.162109f, 7.765576f, -1.070312f, 2.162109f, 8.417969f, -4.688672f, 0.234375f, 8.504297f, -1.070312f, 0.234375f, 9.21875f, -4.910986f, -1.623047f, 9.026807f, -1.070312f, -1.623047f, 9.785156f, -4.995313f, -3.375f, 9.225f, -1.070312f, -3.375f, 10.0f, -6.395312f, 4.125f, 5.325f, -7.047071f, 2.162109f, 5.976758f, -7.615624f, 0.234375f, 6.545312f, -8.017773f, -1.623047f, 6.947461f, -8.170312f, -3.375f, 7.1f, -7.989062f, 4.125f, 2.94375f, -8.835889f, 2.162109f, 3.304053f, -9.57461f, 0.234375f, 3.61836f, -10.097119f, -1.623047f, 3.840674f, -10.295313f, -3.375f, 3.925f, -8.570313f, 4.125f, 0.0f, -9.488281f, 2.162109f, 0.0f, -10.289063f, 0.234375f, 0.0f, -10.855469f, -1.623047f, 0.0f, -11.070313f, -3.375f, 0.0f, -8.570313f, 4.125f, 0.0f, -7.989062f, 4.125f, -2.94375f, -8.835889f, 2.162109f, -3.304053f, -9.488281f, 2.162109f, 0.0f, -9.57461f, 0.234375f, -3.61836f, -10.289063f, 0.234375f, 0.0f, -10.097119f, -1.623047f, -3.840674f, -10.855469f, -1.623047f, 0.0f, -10.295313f, -3.375f, -3.925f, -11.070313f, -3.375f, 0.0f, -6.395312f, 4.125f, -5.325f, -7.047071f, 2.162109f, -5.976758f, -7.615624f, 0.234375f, -6.545312f, -8.017773f, -1.623047f, -6.947461f, -8.170312f, -3.375f, -7.1f, -4.014062f, 4.125f, -6.91875f, -4.374365f, 2.162109f, -7.765576f, -4.688672f, 0.234375f, -8.504297f, -4.910986f, -1.623047f, -9.026807f, -4.995313f, -3.375f, -9.225f, -1.070312f, 4.125f, -7.5f, -1.070312f, 2.162109f, -8.417969f, -1.070312f, 0.234375f, -9.21875f, -1.070312f, -1.623047f, -9.785156f, -1.070312f, -3.375f, -10.0f, -1.070312f, 4.125f, -7.5f, 1.873438f, 4.125f, -6.91875f, 2.23374f, 2.162109f, -7.765576f, -1.070312f, 2.162109f, -8.417969f, 2.548047f, 0.234375f, -8.504297f, -1.070312f, 0.234375f, -9.21875f, 2.770362f, -1.623047f, -9.026807f, -1.070312f, -1.623047f, -9.785156f, 2.854688f, -3.375f, -9.225f, -1.070312f, -3.375f, -10.0f, 4.254687f, 4.125f, -5.325f, 4.906446f, 2.162109f, -5.976758f, 5.475f, 0.234375f, -6.545312f, 5.877149f, -1.623047f, -6.947461f, 6.029688f, -3.375f, -7.1f, 5.848437f, 4.125f, -2.94375f, 6.695264f, 2.162109f, -3.304053f, 7.433985f, 0.234375f, -3.61836f, 7.956494f, -1.623047f, -3.840674f, 8.154688f, -3.375f, -3.925f, 6.429688f, 4.125f, 0.0f, 7.347656f, 2.162109f, 0.0f, 8.148438f, 0.234375f, 0.0f, 8.714844f, -1.623047f, 0.0f, 8.929688f, -3.375f, 0.0f, 8.929688f, -3.375f, 0.0f, 8.154688f, -3.375f, 3.925f, 7.794336f, -4.857422f, 3.77168f, 8.539063f, -4.857422f, 0.0f, 7.001562f, -5.953125f, 3.434375f, 7.679688f, -5.953125f, 0.0f, 6.208789f, -6.697266f, 3.09707f, 6.820313f, -6.697266f, 0.0f, 5.848437f, -7.125f, 2.94375f, 6.429688f, -7.125f, 0.0f, 6.029688f, -3.375f, 7.1f, 5.752343f, -4.857422f, 6.822656f, 5.142187f, -5.953125f, 6.2125f, 4.532031f, -6.697266f, 5.602344f, 4.254687f, -7.125f, 5.325f, 2.854688f, -3.375f, 9.225f, 2.701367f, -4.857422f, 8.864649f, 2.364063f, -5.953125f, 8.071875f, 2.026758f, -6.697266f, 7.279101f, 1.873438f, -7.125f, 6.91875f, -1.070312f, -3.375f, 10.0f, -1.070312f, -4.857422f, 9.609375f, -1.070312f, -5.953125f, 8.75f, -1.070312f, -6.697266f, 7.890625f, -1.070312f, -7.125f, 7.5f, -1.070312f, -3.375f, 10.0f, -4.995313f, -3.375f, 9.225f, -4.841992f, -4.857422f, 8.864649f, -1.070312f, -4.857422f, 9.609375f, -4.504687f, -5.953125f, 8.071875f, -1.070312f, -5.953125f, 8.75f, -4.167383f, -6.697266f, 7.279101f, -1.070312f, -6.697266f, 7.890625f, -4.014062f, -7.125f, 6.91875f, -1.070312f, -7.125f, 7.5f, -8.170312f, -3.375f, 7.1f, -7.892968f, -4.857422f, 6.822656f, -7.282812f, -5.953125f, 6.2125f, -6.672656f, -6.697266f, 5.602344f, -6.395312f, -7.125f, 5.325f, -10.295313f, -3.375f, 3.925f, -9.934961f, -4.857422f, 3.77168f, -9.142187f, -5.953125f, 3.434375f, -8.349414f, -6.697266f, 3.09707f, -7.989062f, -7.125f, 2.94375f, -11.070313f, -3.375f, 0.0f, -10.679688f, -4.857422f, 0.0f, -9.820313f, -5.953125f, 0.0f, -8.960938f, -6.697266f, 0.0f, -8.570313f, -7.125f, 0.0f, -11.070313f, -3.375f, 0.0f, -10.295313f, -3.375f, -3.925f, -9.934961f, -4.857422f, -3.77168f, -10.679688f, -4.857422f, 0.0f, -9.142187f, -5.953125f, -3.434375f, -9.820313f, -5.953125f, 0.0f, -8.349414f, -6.697266f, -3.09707f, -8.960938f, -6.697266f, 0.0f, -7.989062f, -7.125f, -2.94375f, -8.570313f, -7.125f, 0.0f, -8.170312f, -3.375f, -7.1f, -7.892968f, -4.857422f, -6.822656f, -7.282812f, -5.953125f, -6.2125f, -6.672656f, -6.697266f, -5.602344f, -6.395312f, -7.125f, -5.325f, -4.995313f, -3.375f, -9.225f, -4.841992f, -4.857422f, -8.864649f, -4.504687f, -5.953125f, -8.071875f, -4.167383f, -6.697266f, -7.279101f, -4.014062f, -7.125f, -6.91875f, -1.070312f, -3.375f, -10.0f, -1.070312f, -4.857422f, -9.609375f, -1.070312f, -5.953125f, -8.75f, -1.070312f, -6.697266f, -7.890625f, -1.070312f, -7.125f, -7.5f, -1.070312f, -3.375f, -10.0f, 2.854688f, -3.375f, -9.225f, 2.701367f, -4.857422f, -8.864649f, -1.070312f, -4.857422f, -9.609375f, 2.364063f, -5.953125f, -8.071875f, -1.070312f, -5.953125f, -8.75f, 2.026758f, -6.697266f, -7.279101f, -1.070312f, -6.697266f, -7.890625f, 1.873438f, -7.125f, -6.91875f, -1.070312f, -7.125f, -7.5f, 6.029688f, -3.375f, -7.1f, 5.752343f, -4.857422f, -6.822656f, 5.142187f, -5.953125f, -6.2125f, 4.532031f, -6.697266f, -5.602344f, 4.254687f, -7.125f, -5.325f, 8.154688f, -3.375f, -3.925f, 7.794336f, -4.857422f, -3.77168f, 7.001562f, -5.953125f, -3.434375f, 6.208789f, -6.697266f, -3.09707f, 5.848437f, -7.125f, -2.94375f, 8.929688f, -3.375f, 0.0f, 8.539063f, -4.857422f, 0.0f, 7.679688f, -5.953125f, 0.0f, 6.820313f, -6.697266f, 0.0f, 6.429688f, -7.125f, 0.0f, 6.429688f, -7.125f, 0.0f, 5.848437f, -7.125f, 2.94375f, 5.691685f, -7.400391f, 2.877056f, 6.259766f, -7.400391f, 0.0f, 4.853868f, -7.640625f, 2.520586f, 5.351563f, -7.640625f, 0.0f, 2.783648f, -7.810547f, 1.639761f, 3.107422f, -7.810547f, 0.0f, -1.070312f, -7.875f, 0.0f, 4.254687f, -7.125f, 5.325f, 4.134043f, -7.400391f, 5.204355f, 3.489219f, -7.640625f, 4.559531f, 1.895879f, -7.810547f, 2.966191f, -1.070312f, -7.875f, 0.0f, 1.873438f, -7.125f, 6.91875f, 1.806743f, -7.400391f, 6.761997f, 1.450274f, -7.640625f, 5.92418f, 0.569448f, -7.810547f, 3.85396f, -1.070312f, -7.875f, 0.0f, -1.070312f, -7.125f, 7.5f, -1.070312f, -7.400391f, 7.330078f, -1.070312f, -7.640625f, 6.421875f, -1.070312f, -7.810547f, 4.177734f, -1.070312f, -7.875f, 0.0f, -1.070312f, -7.125f, 7.5f, -4.014062f, -7.125f, 6.91875f, -3.947368f, -7.400391f, 6.761997f, -1.070312f, -7.400391f, 7.330078f, -3.590898f, -7.640625f, 5.92418f, -1.070312f, -7.640625f, 6.421875f, -2.710073f, -7.810547f, 3.85396f, -1.070312f, -7.810547f, 4.177734f, -1.070312f, -7.875f, 0.0f, -6.395312f, -7.125f, 5.325f, -6.274668f, -7.400391f, 5.204355f, -5.629844f, -7.640625f, 4.559531f, -4.036504f, -7.810547f, 2.966191f, -1.070312f, -7.875f, 0.0f, -7.989062f, -7.125f, 2.94375f, -7.832309f, -7.400391f, 2.877056f, -6.994492f, -7.640625f, 2.520586f, -4.924272f, -7.810547f, 1.639761f, -1.070312f, -7.875f, 0.0f, -8.570313f, -7.125f, 0.0f, -8.400391f, -7.400391f, 0.0f, -7.492188f, -7.640625f, 0.0f, -5.248047f, -7.810547f, 0.0f, -1.070312f, -7.875f, 0.0f, -8.570313f, -7.125f, 0.0f, -7.989062f, -7.125f, -2.94375f, -7.832309f, -7.400391f, -2.877056f, -8.400391f, -7.400391f, 0.0f, -6.994492f, -7.640625f, -2.520586f, -7.492188f, -7.640625f, 0.0f, -4.924272f, -7.810547f, -1.639761f, -5.248047f, -7.810547f, 0.0f, -1.070312f, -7.875f, 0.0f, -6.395312f, -7.125f, -5.325f, -6.274668f, -7.400391f, -5.204355f, -5.629844f, -7.640625f, -4.559531f, -4.036504f, -7.810547f, -2.966191f, -1.070312f, -7.875f, 0.0f, -4.014062f, -7.125f, -6.91875f, -3.947368f, -7.400391f, -6.761997f, -3.590898f, -7.640625f, -5.92418f, -2.710073f, -7.810547f, -3.85396f, -1.070312f, -7.875f, 0.0f, -1.070312f, -7.125f, -7.5f, -1.070312f, -7.400391f, -7.330078f, -1.070312f, -7.640625f, -6.421875f, -1.070312f, -7.810547f, -4.177734f, -1.070312f, -7.875f, 0.0f, -1.070312f, -7.125f, -7.5f, 1.873438f, -7.125f, -6.91875f, 1.806743f, -7.400391f, -6.761997f, -1.070312f, -7.400391f, -7.330078f, 1.450274f, -7.640625f, -5.92418f, -1.070312f, -7.640625f, -6.421875f, 0.569448f, -7.810547f, -3.85396f, -1.070312f, -7.810547f, -4.177734f, -1.070312f, -7.875f, 0.0f, 4.254687f, -7.125f, -5.325f, 4.134043f, -7.400391f, -5.204355f, 3.489219f, -7.640625f, -4.559531f, 1.895879f, -7.810547f, -2.966191f, -1.070312f, -7.875f, 0.0f, 5.848437f, -7.125f, -2.94375f, 5.691685f, -7.400391f, -2.877056f, 4.853868f, -7.640625f, -2.520586f, 2.783648f, -7.810547f, -1.639761f, -1.070312f, -7.875f, 0.0f, 6.429688f, -7.125f, 0.0f, 6.259766f, -7.400391f, 0.0f, 5.351563f, -7.640625f, 0.0f, 3.107422f, -7.810547f, 0.0f, -1.070312f, -7.875f, 0.0f, -9.070313f, 2.25f, 0.0f, -8.992188f, 2.425781f, 0.84375f, -11.47583f, 2.405457f, 0.84375f, -11.40625f, 2.232422f, 0.0f, -13.298828f, 2.263184f, 0.84375f, -13.132813f, 2.109375f, 0.0f, -14.421631f, 1.877014f, 0.84375f, -14.203125f, 1.775391f, 0.0f, -14.804688f, 1.125f, 0.84375f, -14.570313f, 1.125f, 0.0f, -8.820313f, 2.8125f, 1.125f, -11.628906f, 2.786134f, 1.125f, -13.664063f, 2.601563f, 1.125f, -14.902344f, 2.100586f, 1.125f, -15.320313f, 1.125f, 1.125f, -8.648438f, 3.199219f, 0.84375f, -11.781982f, 3.166809f, 0.84375f, -14.029297f, 2.939941f, 0.84375f, -15.383057f, 2.324158f, 0.84375f, -15.835938f, 1.125f, 0.84375f, -8.570313f, 3.375f, 0.0f, -11.851563f, 3.339844f, 0.0f, -14.195313f, 3.09375f, 0.0f, -15.601563f, 2.425781f, 0.0f, -16.070313f, 1.125f, 0.0f, -8.570313f, 3.375f, 0.0f, -8.648438f, 3.199219f, -0.84375f, -11.781982f, 3.166809f, -0.84375f, -11.851563f, 3.339844f, 0.0f, -14.029297f, 2.939941f, -0.84375f, -14.195313f, 3.09375f, 0.0f, -15.383057f, 2.324158f, -0.84375f, -15.601563f, 2.425781f, 0.0f, -15.835938f, 1.125f, -0.84375f, -16.070313f, 1.125f, 0.0f, -8.820313f, 2.8125f, -1.125f, -11.628906f, 2.786134f, -1.125f, -13.664063f, 2.601563f, -1.125f, -14.902344f, 2.100586f, -1.125f, -15.320313f, 1.125f, -1.125f, -8.992188f, 2.425781f, -0.84375f, -11.47583f, 2.405457f, -0.84375f, -13.298828f, 2.263184f, -0.84375f, -14.421631f, 1.877014f, -0.84375f, -14.804688f, 1.125f, -0.84375f, -9.070313f, 2.25f, 0.0f, -11.40625f, 2.232422f, 0.0f, -13.132813f, 2.109375f, 0.0f, -14.203125f, 1.775391f, 0.0f, -14.570313f, 1.125f, 0.0f, -14.570313f, 1.125f, 0.0f, -14.804688f, 1.125f, 0.84375f, -14.588013f, 0.00705f, 0.84375f, -14.375f, 0.105469f, 0.0f, -13.90918f, -1.275146f, 0.84375f, -13.757813f, -1.125f, 0.0f, -12.724976f, -2.540863f, 0.84375f, -12.671875f, -2.355469f, 0.0f, -10.992188f, -3.609375f, 0.84375f, -11.070313f, -3.375f, 0.0f, -15.320313f, 1.125f, 1.125f, -15.056641f, -0.209473f, 1.125f, -14.242188f, -1.605469f, 1.125f, -12.841797f, -2.94873f, 1.125f, -10.820313f, -4.125f, 1.125f, -15.835938f, 1.125f, 0.84375f, -15.525269f, -0.425995f, 0.84375f, -14.575195f, -1.935791f, 0.84375f, -12.958618f, -3.356598f, 0.84375f, -10.648438f, -4.640625f, 0.84375f, -16.070313f, 1.125f, 0.0f, -15.738281f, -0.524414f, 0.0f, -14.726563f, -2.085938f, 0.0f, -13.011719f, -3.541992f, 0.0f, -10.570313f, -4.875f, 0.0f, -16.070313f, 1.125f, 0.0f, -15.835938f, 1.125f, -0.84375f, -15.525269f, -0.425995f, -0.84375f, -15.738281f, -0.524414f, 0.0f, -14.575195f, -1.935791f, -0.84375f, -14.726563f, -2.085938f, 0.0f, -12.958618f, -3.356598f, -0.84375f, -13.011719f, -3.541992f, 0.0f, -10.648438f, -4.640625f, -0.84375f, -10.570313f, -4.875f, 0.0f, -15.320313f, 1.125f, -1.125f, -15.056641f, -0.209473f, -1.125f, -14.242188f, -1.605469f, -1.125f, -12.841797f, -2.94873f, -1.125f, -10.820313f, -4.125f, -1.125f, -14.804688f, 1.125f, -0.84375f, -14.588013f, 0.00705f, -0.84375f, -13.90918f, -1.275146f, -0.84375f, -12.724976f, -2.540863f, -0.84375f, -10.992188f, -3.609375f, -0.84375f, -14.570313f, 1.125f, 0.0f, -14.375f, 0.105469f, 0.0f, -13.757813f, -1.125f, 0.0f, -12.671875f, -2.355469f, 0.0f, -11.070313f, -3.375f, 0.0f, 7.429688f, -0.75f, 0.0f, 7.429688f, -1.394531f, 1.85625f, 10.01123f, -0.677124f, 1.676074f, 9.828125f, -0.199219f, 0.0f, 11.101563f, 0.84668f, 1.279688f, 10.867188f, 1.125f, 0.0f, 11.723145f, 2.629761f, 0.883301f, 11.4375f, 2.730469f, 0.0f, 12.898438f, 4.125f, 0.703125f, 12.429688f, 4.125f, 0.0f, 7.429688f, -2.8125f, 2.475f, 10.414063f, -1.728516f, 2.234766f, 11.617188f, 0.234375f, 1.70625f, 12.351563f, 2.408203f, 1.177734f, 13.929688f, 4.125f, 0.9375f, 7.429688f, -4.230469f, 1.85625f, 10.816895f, -2.779907f, 1.676074f, 12.132813f, -0.37793f, 1.279688f, 12.97998f, 2.186646f, 0.883301f, 14.960938f, 4.125f, 0.703125f, 7.429688f, -4.875f, 0.0f, 11.0f, -3.257813f, 0.0f, 12.367188f, -0.65625f, 0.0f, 13.265625f, 2.085938f, 0.0f, 15.429688f, 4.125f, 0.0f, 7.429688f, -4.875f, 0.0f, 7.429688f, -4.230469f, -1.85625f, 10.816895f, -2.779907f, -1.676074f, 11.0f, -3.257813f, 0.0f, 12.132813f, -0.37793f, -1.279688f, 12.367188f, -0.65625f, 0.0f, 12.97998f, 2.186646f, -0.883301f, 13.265625f, 2.085938f, 0.0f, 14.960938f, 4.125f, -0.703125f, 15.429688f, 4.125f, 0.0f, 7.429688f, -2.8125f, -2.475f, 10.414063f, -1.728516f, -2.234766f, 11.617188f, 0.234375f, -1.70625f, 12.351563f, 2.408203f, -1.177734f, 13.929688f, 4.125f, -0.9375f, 7.429688f, -1.394531f, -1.85625f, 10.01123f, -0.677124f, -1.676074f, 11.101563f, 0.84668f, -1.279688f, 11.723145f, 2.629761f, -0.883301f, 12.898438f, 4.125f, -0.703125f, 7.429688f, -0.75f, 0.0f, 9.828125f, -0.199219f, 0.0f, 10.867188f, 1.125f, 0.0f, 11.4375f, 2.730469f, 0.0f, 12.429688f, 4.125f, 0.0f, 12.429688f, 4.125f, 0.0f, 12.898438f, 4.125f, 0.703125f, 13.291077f, 4.346237f, 0.65918f, 12.789063f, 4.335938f, 0.0f, 13.525879f, 4.422729f, 0.5625f, 13.054688f, 4.40625f, 0.0f, 13.532898f, 4.350357f, 0.46582f, 13.132813f, 4.335938f, 0.0f, 13.242188f, 4.125f, 0.421875f, 12.929688f, 4.125f, 0.0f, 13.929688f, 4.125f, 0.9375f, 14.395508f, 4.368896f, 0.878906f, 14.5625f, 4.458984f, 0.75f, 14.413086f, 4.38208f, 0.621094f, 13.929688f, 4.125f, 0.5625f, 14.960938f, 4.125f, 0.703125f, 15.499939f, 4.391556f, 0.65918f, 15.599121f, 4.495239f, 0.5625f, 15.293274f, 4.413804f, 0.46582f, 14.617188f, 4.125f, 0.421875f, 15.429688f, 4.125f, 0.0f, 16.001953f, 4.401855f, 0.0f, 16.070313f, 4.511719f, 0.0f, 15.693359f, 4.428224f, 0.0f, 14.929688f, 4.125f, 0.0f, 15.429688f, 4.125f, 0.0f, 14.960938f, 4.125f, -0.703125f, 15.499939f, 4.391556f, -0.65918f, 16.001953f, 4.401855f, 0.0f, 15.599121f, 4.495239f, -0.5625f, 16.070313f, 4.511719f, 0.0f, 15.293274f, 4.413804f, -0.46582f, 15.693359f, 4.428224f, 0.0f, 14.617188f, 4.125f, -0.421875f, 14.929688f, 4.125f, 0.0f, 13.929688f, 4.125f, -0.9375f, 14.395508f, 4.368896f, -0.878906f, 14.5625f, 4.458984f, -0.75f, 14.413086f, 4.38208f, -0.621094f, 13.929688f, 4.125f, -0.5625f, 12.898438f, 4.125f, -0.703125f, 13.291077f, 4.346237f, -0.65918f, 13.525879f, 4.422729f, -0.5625f, 13.532898f, 4.350357f, -0.46582f, 13.242188f, 4.125f, -0.421875f, 12.429688f, 4.125f, 0.0f, 12.789063f, 4.335938f, 0.0f, 13.054688f, 4.40625f, 0.0f, 13.132813f, 4.335938f, 0.0f, 12.929688f, 4.125f, 0.0f, 0.501414f, 7.628906f, 0.670256f, 0.632813f, 7.628906f, 0.0f, -1.070312f, 7.875f, 0.0f, 0.429278f, 7.03125f, 0.639395f, 0.554688f, 7.03125f, 0.0f, -0.162029f, 6.292969f, 0.38696f, -0.085937f, 6.292969f, 0.0f, -0.147812f, 5.625f, 0.3925f, -0.070312f, 5.625f, 0.0f, 0.140489f, 7.628906f, 1.210801f, -1.070312f, 7.875f, 0.0f, 0.084844f, 7.03125f, 1.155156f, -0.370879f, 6.292969f, 0.699434f, -0.360312f, 5.625f, 0.71f, -0.400056f, 7.628906f, 1.571726f, -1.070312f, 7.875f, 0.0f, -0.430918f, 7.03125f, 1.49959f, -0.683352f, 6.292969f, 0.908284f, -0.677812f, 5.625f, 0.9225f, -1.070312f, 7.628906f, 1.703125f, -1.070312f, 7.875f, 0.0f, -1.070312f, 7.03125f, 1.625f, -1.070312f, 6.292969f, 0.984375f, -1.070312f, 5.625f, 1.0f, -1.740569f, 7.628906f, 1.571726f, -1.070312f, 7.628906f, 1.703125f, -1.070312f, 7.875f, 0.0f, -1.709707f, 7.03125f, 1.49959f, -1.070312f, 7.03125f, 1.625f, -1.457273f, 6.292969f, 0.908284f, -1.070312f, 6.292969f, 0.984375f, -1.462812f, 5.625f, 0.9225f, -1.070312f, 5.625f, 1.0f, -2.281113f, 7.628906f, 1.210801f, -1.070312f, 7.875f, 0.0f, -2.225469f, 7.03125f, 1.155156f, -1.769746f, 6.292969f, 0.699434f, -1.780312f, 5.625f, 0.71f, -2.642038f, 7.628906f, 0.670256f, -1.070312f, 7.875f, 0.0f, -2.569902f, 7.03125f, 0.639395f, -1.978596f, 6.292969f, 0.38696f, -1.992812f, 5.625f, 0.3925f, -2.773438f, 7.628906f, 0.0f, -1.070312f, 7.875f, 0.0f, -2.695313f, 7.03125f, 0.0f, -2.054687f, 6.292969f, 0.0f, -2.070312f, 5.625f, 0.0f, -2.642038f, 7.628906f, -0.670256f, -2.773438f, 7.628906f, 0.0f, -1.070312f, 7.875f, 0.0f, -2.569902f, 7.03125f, -0.639395f, -2.695313f, 7.03125f, 0.0f, -1.978596f, 6.292969f, -0.38696f, -2.054687f, 6.292969f, 0.0f, -1.992812f, 5.625f, -0.3925f, -2.070312f, 5.625f, 0.0f, -2.281113f, 7.628906f, -1.210801f, -1.070312f, 7.875f, 0.0f, -2.225469f, 7.03125f, -1.155156f, -1.769746f, 6.292969f, -0.699434f, -1.780312f, 5.625f, -0.71f, -1.740569f, 7.628906f, -1.571726f, -1.070312f, 7.875f, 0.0f, -1.709707f, 7.03125f, -1.49959f, -1.457273f, 6.292969f, -0.908284f, -1.462812f, 5.625f, -0.9225f, -1.070312f, 7.628906f, -1.703125f, -1.070312f, 7.875f, 0.0f, -1.070312f, 7.03125f, -1.625f, -1.070312f, 6.292969f, -0.984375f, -1.070312f, 5.625f, -1.0f, -0.400056f, 7.628906f, -1.571726f, -1.070312f, 7.628906f, -1.703125f, -1.070312f, 7.875f, 0.0f, -0.430918f, 7.03125f, -1.49959f, -1.070312f, 7.03125f, -1.625f, -0.683352f, 6.292969f, -0.908284f, -1.070312f, 6.292969f, -0.984375f, -0.677812f, 5.625f, -0.9225f, -1.070312f, 5.625f, -1.0f, 0.140489f, 7.628906f, -1.210801f, -1.070312f, 7.875f, 0.0f, 0.084844f, 7.03125f, -1.155156f, -0.370879f, 6.292969f, -0.699434f, -0.360312f, 5.625f, -0.71f, 0.501414f, 7.628906f, -0.670256f, -1.070312f, 7.875f, 0.0f, 0.429278f, 7.03125f, -0.639395f, -0.162029f, 6.292969f, -0.38696f, -0.147812f, 5.625f, -0.3925f, 0.632813f, 7.628906f, 0.0f, -1.070312f, 7.875f, 0.0f, 0.554688f, 7.03125f, 0.0f, -0.085937f, 6.292969f, 0.0f, -0.070312f, 5.625f, 0.0f, -0.070312f, 5.625f, 0.0f, -0.147812f, 5.625f, 0.3925f, 1.034141f, 5.179688f, 0.895391f, 1.210938f, 5.179688f, 0.0f, 2.735f, 4.875f, 1.619062f, 3.054688f, 4.875f, 0.0f, 4.262891f, 4.570313f, 2.26914f, 4.710938f, 4.570313f, 0.0f, 4.925938f, 4.125f, 2.55125f, 5.429688f, 4.125f, 0.0f, -0.360312f, 5.625f, 0.71f, 0.549375f, 5.179688f, 1.619688f, 1.858438f, 4.875f, 2.92875f, 3.034375f, 4.570313f, 4.104687f, 3.544688f, 4.125f, 4.615f, -0.677812f, 5.625f, 0.9225f, -0.174922f, 5.179688f, 2.104453f, 0.54875f, 4.875f, 3.805313f, 1.198828f, 4.570313f, 5.333203f, 1.480938f, 4.125f, 5.99625f, -1.070312f, 5.625f, 1.0f, -1.070312f, 5.179688f, 2.28125f, -1.070312f, 4.875f, 4.125f, -1.070312f, 4.570313f, 5.78125f, -1.070312f, 4.125f, 6.5f, -1.070312f, 5.625f, 1.0f, -1.462812f, 5.625f, 0.9225f, -1.965703f, 5.179688f, 2.104453f, -1.070312f, 5.179688f, 2.28125f, -2.689375f, 4.875f, 3.805313f, -1.070312f, 4.875f, 4.125f, -3.339453f, 4.570313f, 5.333203f, -1.070312f, 4.570313f, 5.78125f, -3.621562f, 4.125f, 5.99625f, -1.070312f, 4.125f, 6.5f, -1.780312f, 5.625f, 0.71f, -2.69f, 5.179688f, 1.619688f, -3.999062f, 4.875f, 2.92875f, -5.174999f, 4.570313f, 4.104687f, -5.685312f, 4.125f, 4.615f, -1.992812f, 5.625f, 0.3925f, -3.174765f, 5.179688f, 0.895391f, -4.875625f, 4.875f, 1.619062f, -6.403516f, 4.570313f, 2.26914f, -7.066563f, 4.125f, 2.55125f, -2.070312f, 5.625f, 0.0f, -3.351562f, 5.179688f, 0.0f, -5.195313f, 4.875f, 0.0f, -6.851563f, 4.570313f, 0.0f, -7.570313f, 4.125f, 0.0f, -2.070312f, 5.625f, 0.0f, -1.992812f, 5.625f, -0.3925f, -3.174765f, 5.179688f, -0.895391f, -3.351562f, 5.179688f, 0.0f, -4.875625f, 4.875f, -1.619062f, -5.195313f, 4.875f, 0.0f, -6.403516f, 4.570313f, -2.26914f, -6.851563f, 4.570313f, 0.0f, -7.066563f, 4.125f, -2.55125f, -7.570313f, 4.125f, 0.0f, -1.780312f, 5.625f, -0.71f, -2.69f, 5.179688f, -1.619688f, -3.999062f, 4.875f, -2.92875f, -5.174999f, 4.570313f, -4.104687f, -5.685312f, 4.125f, -4.615f, -1.462812f, 5.625f, -0.9225f, -1.965703f, 5.179688f, -2.104453f, -2.689375f, 4.875f, -3.805313f, -3.339453f, 4.570313f, -5.333203f, -3.621562f, 4.125f, -5.99625f, -1.070312f, 5.625f, -1.0f, -1.070312f, 5.179688f, -2.28125f, -1.070312f, 4.875f, -4.125f, -1.070312f, 4.570313f, -5.78125f, -1.070312f, 4.125f, -6.5f, -1.070312f, 5.625f, -1.0f, -0.677812f, 5.625f, -0.9225f, -0.174922f, 5.179688f, -2.104453f, -1.070312f, 5.179688f, -2.28125f, 0.54875f, 4.875f, -3.805313f, -1.070312f, 4.875f, -4.125f, 1.198828f, 4.570313f, -5.333203f, -1.070312f, 4.570313f, -5.78125f, 1.480938f, 4.125f, -5.99625f, -1.070312f, 4.125f, -6.5f, -0.360312f, 5.625f, -0.71f, 0.549375f, 5.179688f, -1.619688f, 1.858438f, 4.875f, -2.92875f, 3.034375f, 4.570313f, -4.104687f, 3.544688f, 4.125f, -4.615f, -0.147812f, 5.625f, -0.3925f, 1.034141f, 5.179688f, -0.895391f, 2.735f, 4.875f, -1.619062f, 4.262891f, 4.570313f, -2.26914f, 4.925938f, 4.125f, -2.55125f, -0.070312f, 5.625f, 0.0f, 1.210938f, 5.179688f, 0.0f, 3.054688f, 4.875f, 0.0f, 4.710938f, 4.570313f, 0.0f, 5.429688f, 4.125f, 0.0f};
+
+float normalsTeapot[] =
+    {-0.966742f, -0.255752f, 0.0f, -0.893014f, -0.256345f, -0.369882f, -0.893437f, 0.255996f, -0.369102f, -0.966824f, 0.255443f, 0.0f, -0.083877f, 0.995843f, -0.035507f, -0.092052f, 0.995754f, 0.0f, 0.629724f, 0.73186f, 0.260439f, 0.68205f, 0.731305f, 0.0f, 0.803725f, 0.49337f, 0.332584f, 0.870301f, 0.492521f, 0.0f, -0.683407f, -0.256728f, -0.683407f, -0.683531f, 0.256068f, -0.683531f, -0.064925f, 0.995776f, -0.064925f, 0.481399f, 0.732469f, 0.481399f, 0.614804f, 0.493997f, 0.614804f, -0.369882f, -0.256345f, -0.893014f, -0.369102f, 0.255996f, -0.893437f, -0.035507f, 0.995843f, -0.083877f, 0.260439f, 0.73186f, 0.629724f, 0.332584f, 0.493369f, 0.803725f, -0.002848f, -0.257863f, -0.966177f, -0.001923f, 0.254736f, -0.967009f, -0.000266f, 0.995734f, -0.09227f, 0.000024f, 0.731295f, 0.682061f, 0.0f, 0.492521f, 0.870301f, -0.002848f, -0.257863f, -0.966177f, 0.379058f, -0.3593f, -0.852771f, 0.37711f, 0.149085f, -0.914091f, -0.001923f, 0.254736f, -0.967009f, 0.027502f, 0.992081f, -0.122552f, -0.000266f, 0.995734f, -0.09227f, -0.26101f, 0.726762f, 0.635367f, 0.000024f, 0.731295f, 0.682061f, -0.332485f, 0.492546f, 0.804271f, 0.0f, 0.492521f, 0.870301f, 0.663548f, -0.41079f, -0.625264f, 0.712664f, 0.073722f, -0.697621f, 0.099726f, 0.987509f, -0.121983f, -0.48732f, 0.723754f, 0.488569f, -0.615242f, 0.492602f, 0.615484f, 0.880028f, -0.332906f, -0.338709f, 0.917276f, 0.167113f, -0.361493f, 0.113584f, 0.992365f, -0.04807f, -0.63415f, 0.727508f, 0.261889f, -0.804126f, 0.492634f, 0.332705f, 0.96669f, -0.255738f, 0.010454f, 0.967442f, 0.252962f, 0.008103f, 0.093436f, 0.995624f, 0.001281f, -0.682167f, 0.731196f, -0.000343f, -0.870322f, 0.492483f, -0.000054f, 0.96669f, -0.255738f, 0.010454f, 0.893014f, -0.256345f, 0.369882f, 0.893437f, 0.255996f, 0.369102f, 0.967442f, 0.252962f, 0.008103f, 0.083877f, 0.995843f, 0.035507f, 0.093436f, 0.995624f, 0.001281f, -0.629724f, 0.73186f, -0.260439f, -0.682167f, 0.731196f, -0.000343f, -0.803725f, 0.49337f, -0.332584f, -0.870322f, 0.492483f, -0.000054f, 0.683407f, -0.256728f, 0.683407f, 0.683531f, 0.256068f, 0.683531f, 0.064925f, 0.995776f, 0.064925f, -0.481399f, 0.732469f, -0.481399f, -0.614804f, 0.493997f, -0.614804f, 0.369882f, -0.256345f, 0.893014f, 0.369102f, 0.255996f, 0.893437f, 0.035507f, 0.995843f, 0.083877f, -0.260439f, 0.73186f, -0.629724f, -0.332584f, 0.493369f, -0.803725f, 0.0f, -0.255752f, 0.966742f, 0.0f, 0.255443f, 0.966824f, 0.0f, 0.995754f, 0.092052f, 0.0f, 0.731305f, -0.68205f, 0.0f, 0.492521f, -0.870301f, 0.0f, -0.255752f, 0.966742f, -0.369882f, -0.256345f, 0.893014f, -0.369102f, 0.255996f, 0.893437f, 0.0f, 0.255443f, 0.966824f, -0.035507f, 0.995843f, 0.083877f, 0.0f, 0.995754f, 0.092052f, 0.260439f, 0.73186f, -0.629724f, 0.0f, 0.731305f, -0.68205f, 0.332584f, 0.49337f, -0.803725f, 0.0f, 0.492521f, -0.870301f, -0.683407f, -0.256728f, 0.683407f, -0.683531f, 0.256068f, 0.683531f, -0.064925f, 0.995776f, 0.064925f, 0.481399f, 0.732469f, -0.481399f, 0.614804f, 0.493997f, -0.614804f, -0.893014f, -0.256345f, 0.369882f, -0.893437f, 0.255996f, 0.369102f, -0.083877f, 0.995843f, 0.035507f, 0.629724f, 0.73186f, -0.260439f, 0.803725f, 0.493369f, -0.332584f, -0.966742f, -0.255752f, 0.0f, -0.966824f, 0.255443f, 0.0f, -0.092052f, 0.995754f, 0.0f, 0.68205f, 0.731305f, 0.0f, 0.870301f, 0.492521f, 0.0f, 0.870301f, 0.492521f, 0.0f, 0.803725f, 0.49337f, 0.332584f, 0.845438f, 0.403546f, 0.349835f, 0.915321f, 0.402725f, 0.0f, 0.869996f, 0.336859f, 0.360047f, 0.941808f, 0.336151f, 0.0f, 0.904193f, 0.205791f, 0.37428f, 0.97869f, 0.205342f, 0.0f, 0.921879f, -0.06637f, 0.381752f, 0.997804f, -0.06624f, 0.0f, 0.614804f, 0.493997f, 0.614804f, 0.646802f, 0.404096f, 0.646802f, 0.665655f, 0.337351f, 0.665655f, 0.691923f, 0.20612f, 0.691923f, 0.705543f, -0.06648f, 0.705542f, 0.332584f, 0.493369f, 0.803725f, 0.349835f, 0.403546f, 0.845438f, 0.360047f, 0.336859f, 0.869996f, 0.37428f, 0.205791f, 0.904193f, 0.381752f, -0.066369f, 0.921879f, 0.0f, 0.492521f, 0.870301f, 0.0f, 0.402725f, 0.915321f, 0.0f, 0.336151f, 0.941808f, 0.0f, 0.205342f, 0.97869f, 0.0f, -0.06624f, 0.997804f, 0.0f, 0.492521f, 0.870301f, -0.332485f, 0.492546f, 0.804271f, -0.349835f, 0.403546f, 0.845438f, 0.0f, 0.402725f, 0.915321f, -0.360047f, 0.336859f, 0.869996f, 0.0f, 0.336151f, 0.941808f, -0.37428f, 0.205791f, 0.904193f, 0.0f, 0.205342f, 0.97869f, -0.381752f, -0.06637f, 0.921879f, 0.0f, -0.06624f, 0.997804f, -0.615242f, 0.492602f, 0.615484f, -0.646802f, 0.404096f, 0.646802f, -0.665655f, 0.337351f, 0.665655f, -0.691923f, 0.20612f, 0.691923f, -0.705542f, -0.06648f, 0.705543f, -0.804126f, 0.492634f, 0.332705f, -0.845438f, 0.403546f, 0.349835f, -0.869996f, 0.336859f, 0.360047f, -0.904193f, 0.205791f, 0.37428f, -0.921879f, -0.066369f, 0.381752f, -0.870322f, 0.492483f, -0.000054f, -0.915321f, 0.402725f, 0.0f, -0.941808f, 0.336151f, 0.0f, -0.97869f, 0.205342f, 0.0f, -0.997804f, -0.06624f, 0.0f, -0.870322f, 0.492483f, -0.000054f, -0.803725f, 0.49337f, -0.332584f, -0.845438f, 0.403546f, -0.349835f, -0.915321f, 0.402725f, 0.0f, -0.869996f, 0.336859f, -0.360047f, -0.941808f, 0.336151f, 0.0f, -0.904193f, 0.205791f, -0.37428f, -0.97869f, 0.205342f, 0.0f, -0.921879f, -0.06637f, -0.381752f, -0.997804f, -0.06624f, 0.0f, -0.614804f, 0.493997f, -0.614804f, -0.646802f, 0.404096f, -0.646802f, -0.665655f, 0.337351f, -0.665655f, -0.691923f, 0.20612f, -0.691923f, -0.705543f, -0.06648f, -0.705542f, -0.332584f, 0.493369f, -0.803725f, -0.349835f, 0.403546f, -0.845438f, -0.360047f, 0.336859f, -0.869996f, -0.37428f, 0.205791f, -0.904193f, -0.381752f, -0.066369f, -0.921879f, 0.0f, 0.492521f, -0.870301f, 0.0f, 0.402725f, -0.915321f, 0.0f, 0.336151f, -0.941808f, 0.0f, 0.205342f, -0.97869f, 0.0f, -0.06624f, -0.997804f, 0.0f, 0.492521f, -0.870301f, 0.332584f, 0.49337f, -0.803725f, 0.349835f, 0.403546f, -0.845438f, 0.0f, 0.402725f, -0.915321f, 0.360047f, 0.336859f, -0.869996f, 0.0f, 0.336151f, -0.941808f, 0.37428f, 0.205791f, -0.904193f, 0.0f, 0.205342f, -0.97869f, 0.381752f, -0.06637f, -0.921879f, 0.0f, -0.06624f, -0.997804f, 0.614804f, 0.493997f, -0.614804f, 0.646802f, 0.404096f, -0.646802f, 0.665655f, 0.337351f, -0.665655f, 0.691923f, 0.20612f, -0.691923f, 0.705542f, -0.06648f, -0.705543f, 0.803725f, 0.493369f, -0.332584f, 0.845438f, 0.403546f, -0.349835f, 0.869996f, 0.336859f, -0.360047f, 0.904193f, 0.205791f, -0.37428f, 0.921879f, -0.066369f, -0.381752f, 0.870301f, 0.492521f, 0.0f, 0.915321f, 0.402725f, 0.0f, 0.941808f, 0.336151f, 0.0f, 0.97869f, 0.205342f, 0.0f, 0.997804f, -0.06624f, 0.0f, 0.997804f, -0.06624f, 0.0f, 0.921879f, -0.06637f, 0.381752f, 0.831437f, -0.43618f, 0.344179f, 0.900182f, -0.435513f, 0.0f, 0.673512f, -0.684666f, 0.278594f, 0.729611f, -0.683863f, 0.0f, 0.640399f, -0.720924f, 0.264874f, 0.693951f, -0.720022f, 0.0f, 0.732949f, -0.608995f, 0.303167f, 0.79395f, -0.607983f, 0.0f, 0.705543f, -0.06648f, 0.705542f, 0.636092f, -0.436778f, 0.636092f, 0.514965f, -0.68529f, 0.514965f, 0.489651f, -0.721446f, 0.489651f, 0.560555f, -0.609554f, 0.560555f, 0.381752f, -0.066369f, 0.921879f, 0.344179f, -0.43618f, 0.831437f, 0.278595f, -0.684666f, 0.673512f, 0.264874f, -0.720924f, 0.640399f, 0.303167f, -0.608995f, 0.732949f, 0.0f, -0.06624f, 0.997804f, 0.0f, -0.435513f, 0.900182f, 0.0f, -0.683863f, 0.729611f, 0.0f, -0.720022f, 0.693951f, 0.0f, -0.607983f, 0.79395f, 0.0f, -0.06624f, 0.997804f, -0.381752f, -0.06637f, 0.921879f, -0.344179f, -0.43618f, 0.831437f, 0.0f, -0.435513f, 0.900182f, -0.278594f, -0.684666f, 0.673512f, 0.0f, -0.683863f, 0.729611f, -0.264874f, -0.720924f, 0.640399f, 0.0f, -0.720022f, 0.693951f, -0.303167f, -0.608995f, 0.732949f, 0.0f, -0.607983f, 0.79395f, -0.705542f, -0.06648f, 0.705543f, -0.636092f, -0.436778f, 0.636092f, -0.514965f, -0.68529f, 0.514965f, -0.489651f, -0.721446f, 0.489651f, -0.560555f, -0.609554f, 0.560555f, -0.921879f, -0.066369f, 0.381752f, -0.831437f, -0.43618f, 0.344179f, -0.673512f, -0.684666f, 0.278595f, -0.640399f, -0.720924f, 0.264874f, -0.732949f, -0.608995f, 0.303167f, -0.997804f, -0.06624f, 0.0f, -0.900182f, -0.435513f, 0.0f, -0.729611f, -0.683863f, 0.0f, -0.693951f, -0.720022f, 0.0f, -0.79395f, -0.607983f, 0.0f, -0.997804f, -0.06624f, 0.0f, -0.921879f, -0.06637f, -0.381752f, -0.831437f, -0.43618f, -0.344179f, -0.900182f, -0.435513f, 0.0f, -0.673512f, -0.684666f, -0.278594f, -0.729611f, -0.683863f, 0.0f, -0.640399f, -0.720924f, -0.264874f, -0.693951f, -0.720022f, 0.0f, -0.732949f, -0.608995f, -0.303167f, -0.79395f, -0.607983f, 0.0f, -0.705543f, -0.06648f, -0.705542f, -0.636092f, -0.436778f, -0.636092f, -0.514965f, -0.68529f, -0.514965f, -0.489651f, -0.721446f, -0.489651f, -0.560555f, -0.609554f, -0.560555f, -0.381752f, -0.066369f, -0.921879f, -0.344179f, -0.43618f, -0.831437f, -0.278595f, -0.684666f, -0.673512f, -0.264874f, -0.720924f, -0.640399f, -0.303167f, -0.608995f, -0.732949f, 0.0f, -0.06624f, -0.997804f, 0.0f, -0.435513f, -0.900182f, 0.0f, -0.683863f, -0.729611f, 0.0f, -0.720022f, -0.693951f, 0.0f, -0.607983f, -0.79395f, 0.0f, -0.06624f, -0.997804f, 0.381752f, -0.06637f, -0.921879f, 0.344179f, -0.43618f, -0.831437f, 0.0f, -0.435513f, -0.900182f, 0.278594f, -0.684666f, -0.673512f, 0.0f, -0.683863f, -0.729611f, 0.264874f, -0.720924f, -0.640399f, 0.0f, -0.720022f, -0.693951f, 0.303167f, -0.608995f, -0.732949f, 0.0f, -0.607983f, -0.79395f, 0.705542f, -0.06648f, -0.705543f, 0.636092f, -0.436778f, -0.636092f, 0.514965f, -0.68529f, -0.514965f, 0.489651f, -0.721446f, -0.489651f, 0.560555f, -0.609554f, -0.560555f, 0.921879f, -0.066369f, -0.381752f, 0.831437f, -0.43618f, -0.344179f, 0.673512f, -0.684666f, -0.278595f, 0.640399f, -0.720924f, -0.264874f, 0.732949f, -0.608995f, -0.303167f, 0.997804f, -0.06624f, 0.0f, 0.900182f, -0.435513f, 0.0f, 0.729611f, -0.683863f, 0.0f, 0.693951f, -0.720022f, 0.0f, 0.79395f, -0.607983f, 0.0f, 0.79395f, -0.607983f, 0.0f, 0.732949f, -0.608995f, 0.303167f, 0.57623f, -0.781801f, 0.238217f, 0.62386f, -0.781536f, 0.0f, 0.163628f, -0.984208f, 0.067527f, 0.177291f, -0.984159f, 0.0f, 0.045422f, -0.998792f, 0.018736f, 0.049207f, -0.998789f, 0.0f, 0.0f, -1.0f, 0.0f, 0.560555f, -0.609554f, 0.560555f, 0.440416f, -0.782348f, 0.440416f, 0.124903f, -0.984276f, 0.124903f, 0.034662f, -0.998798f, 0.034662f, 0.0f, -1.0f, 0.0f, 0.303167f, -0.608995f, 0.732949f, 0.238217f, -0.781801f, 0.57623f, 0.067527f, -0.984208f, 0.163628f, 0.018736f, -0.998792f, 0.045422f, 0.0f, -1.0f, 0.0f, 0.0f, -0.607983f, 0.79395f, 0.0f, -0.781536f, 0.62386f, 0.0f, -0.984159f, 0.177291f, 0.0f, -0.998789f, 0.049207f, 0.0f, -1.0f, 0.0f, 0.0f, -0.607983f, 0.79395f, -0.303167f, -0.608995f, 0.732949f, -0.238217f, -0.781801f, 0.57623f, 0.0f, -0.781536f, 0.62386f, -0.067527f, -0.984208f, 0.163628f, 0.0f, -0.984159f, 0.177291f, -0.018736f, -0.998792f, 0.045422f, 0.0f, -0.998789f, 0.049207f, 0.0f, -1.0f, 0.0f, -0.560555f, -0.609554f, 0.560555f, -0.440416f, -0.782348f, 0.440416f, -0.124903f, -0.984276f, 0.124903f, -0.034662f, -0.998798f, 0.034662f, 0.0f, -1.0f, 0.0f, -0.732949f, -0.608995f, 0.303167f, -0.57623f, -0.781801f, 0.238217f, -0.163628f, -0.984208f, 0.067527f, -0.045422f, -0.998792f, 0.018736f, 0.0f, -1.0f, 0.0f, -0.79395f, -0.607983f, 0.0f, -0.62386f, -0.781536f, 0.0f, -0.177291f, -0.984159f, 0.0f, -0.049207f, -0.998789f, 0.0f, 0.0f, -1.0f, 0.0f, -0.79395f, -0.607983f, 0.0f, -0.732949f, -0.608995f, -0.303167f, -0.57623f, -0.781801f, -0.238217f, -0.62386f, -0.781536f, 0.0f, -0.163628f, -0.984208f, -0.067527f, -0.177291f, -0.984159f, 0.0f, -0.045422f, -0.998792f, -0.018736f, -0.049207f, -0.998789f, 0.0f, 0.0f, -1.0f, 0.0f, -0.560555f, -0.609554f, -0.560555f, -0.440416f, -0.782348f, -0.440416f, -0.124903f, -0.984276f, -0.124903f, -0.034662f, -0.998798f, -0.034662f, 0.0f, -1.0f, 0.0f, -0.303167f, -0.608995f, -0.732949f, -0.238217f, -0.781801f, -0.57623f, -0.067527f, -0.984208f, -0.163628f, -0.018736f, -0.998792f, -0.045422f, 0.0f, -1.0f, 0.0f, 0.0f, -0.607983f, -0.79395f, 0.0f, -0.781536f, -0.62386f, 0.0f, -0.984159f, -0.177291f, 0.0f, -0.998789f, -0.049207f, 0.0f, -1.0f, 0.0f, 0.0f, -0.607983f, -0.79395f, 0.303167f, -0.608995f, -0.732949f, 0.238217f, -0.781801f, -0.57623f, 0.0f, -0.781536f, -0.62386f, 0.067527f, -0.984208f, -0.163628f, 0.0f, -0.984159f, -0.177291f, 0.018736f, -0.998792f, -0.045422f, 0.0f, -0.998789f, -0.049207f, 0.0f, -1.0f, 0.0f, 0.560555f, -0.609554f, -0.560555f, 0.440416f, -0.782348f, -0.440416f, 0.124903f, -0.984276f, -0.124903f, 0.034662f, -0.998798f, -0.034662f, 0.0f, -1.0f, 0.0f, 0.732949f, -0.608995f, -0.303167f, 0.57623f, -0.781801f, -0.238217f, 0.163628f, -0.984208f, -0.067527f, 0.045422f, -0.998792f, -0.018736f, 0.0f, -1.0f, 0.0f, 0.79395f, -0.607983f, 0.0f, 0.62386f, -0.781536f, 0.0f, 0.177291f, -0.984159f, 0.0f, 0.049207f, -0.998789f, 0.0f, 0.0f, -1.0f, 0.0f, 0.007786f, -0.99997f, -0.000216f, 0.007039f, -0.812495f, 0.582926f, 0.036127f, -0.837257f, 0.545614f, 0.039138f, -0.999233f, -0.000989f, 0.161846f, -0.810421f, 0.563048f, 0.179512f, -0.983746f, -0.004369f, 0.482365f, -0.595148f, 0.642746f, 0.612299f, -0.790557f, -0.01046f, 0.73872f, -0.114594f, 0.664199f, 0.986152f, -0.165708f, -0.00667f, -0.001909f, 0.162121f, 0.986769f, 0.002762f, 0.017107f, 0.99985f, 0.010533f, 0.073398f, 0.997247f, -0.066041f, 0.13007f, 0.989303f, -0.094427f, 0.016594f, 0.995393f, -0.009203f, 0.871509f, 0.490293f, -0.048606f, 0.840609f, 0.539457f, -0.223298f, 0.80288f, 0.552739f, -0.596365f, 0.559971f, 0.575135f, -0.803337f, 0.068236f, 0.591603f, -0.010561f, 0.999944f, 0.000103f, -0.058798f, 0.99827f, 0.00071f, -0.28071f, 0.959787f, 0.003269f, -0.749723f, 0.661738f, 0.004268f, -0.997351f, 0.072714f, 0.002059f, -0.010561f, 0.999944f, 0.000103f, -0.008792f, 0.871493f, -0.49033f, -0.046494f, 0.841178f, -0.538756f, -0.058798f, 0.99827f, 0.00071f, -0.217909f, 0.806807f, -0.549161f, -0.28071f, 0.959787f, 0.003269f, -0.597291f, 0.560026f, -0.574121f, -0.749723f, 0.661738f, 0.004268f, -0.804f, 0.062913f, -0.591292f, -0.997351f, 0.072714f, 0.002059f, -0.001806f, 0.161691f, -0.98684f, 0.002031f, 0.014555f, -0.999892f, 0.009215f, 0.060069f, -0.998152f, -0.059334f, 0.113865f, -0.991723f, -0.086899f, 0.01229f, -0.996141f, 0.006418f, -0.812379f, -0.583095f, 0.033783f, -0.837512f, -0.545373f, 0.157113f, -0.811947f, -0.56219f, 0.484406f, -0.589366f, -0.646528f, 0.73887f, -0.10132f, -0.666187f, 0.007786f, -0.99997f, -0.000216f, 0.039138f, -0.999233f, -0.000989f, 0.179512f, -0.983746f, -0.004369f, 0.612299f, -0.790557f, -0.01046f, 0.986152f, -0.165708f, -0.00667f, 0.986152f, -0.165708f, -0.00667f, 0.73872f, -0.114594f, 0.664199f, 0.725608f, 0.259351f, 0.637361f, 0.946512f, 0.32265f, -0.003357f, 0.645945f, 0.461988f, 0.607719f, 0.82583f, 0.56387f, -0.007452f, 0.531615f, 0.63666f, 0.558614f, 0.650011f, 0.759893f, -0.006937f, 0.424964f, 0.681717f, 0.59554f, 0.532429f, 0.846459f, -0.005245f, -0.094427f, 0.016594f, 0.995393f, -0.049562f, -0.019755f, 0.998576f, -0.037816f, -0.035624f, 0.99865f, -0.037914f, -0.036512f, 0.998614f, -0.168854f, -0.297945f, 0.93953f, -0.803337f, 0.068236f, 0.591603f, -0.742342f, -0.299166f, 0.599523f, -0.619602f, -0.529406f, 0.579502f, -0.483708f, -0.68576f, 0.543837f, -0.445293f, -0.794355f, 0.413177f, -0.997351f, 0.072714f, 0.002059f, -0.926513f, -0.376258f, 0.001996f, -0.75392f, -0.656952f, 0.004317f, -0.566224f, -0.824244f, 0.003461f, -0.481804f, -0.876277f, 0.00185f, -0.997351f, 0.072714f, 0.002059f, -0.804f, 0.062913f, -0.591292f, -0.744675f, -0.294425f, -0.598977f, -0.926513f, -0.376258f, 0.001996f, -0.621949f, -0.528114f, -0.578165f, -0.75392f, -0.656952f, 0.004317f, -0.481171f, -0.68834f, -0.542828f, -0.566224f, -0.824244f, 0.003461f, -0.438055f, -0.797035f, -0.415744f, -0.481804f, -0.876277f, 0.00185f, -0.086899f, 0.01229f, -0.996141f, -0.044337f, -0.017056f, -0.998871f, -0.026176f, -0.028166f, -0.99926f, -0.025294f, -0.028332f, -0.999278f, -0.157482f, -0.289392f, -0.944167f, 0.73887f, -0.10132f, -0.666187f, 0.728244f, 0.25241f, -0.637142f, 0.647055f, 0.459725f, -0.608254f, 0.522994f, 0.640657f, -0.56217f, 0.409978f, 0.682857f, -0.604669f, 0.986152f, -0.165708f, -0.00667f, 0.946512f, 0.32265f, -0.003357f, 0.82583f, 0.56387f, -0.007452f, 0.650011f, 0.759893f, -0.006937f, 0.532429f, 0.846459f, -0.005245f, -0.230787f, 0.972982f, -0.006523f, -0.152877f, 0.687211f, 0.71019f, -0.316721f, 0.63775f, 0.702113f, -0.548936f, 0.835863f, -0.001511f, -0.601067f, 0.471452f, 0.64533f, -0.875671f, 0.482806f, 0.009893f, -0.635889f, 0.44609f, 0.629801f, -0.877554f, 0.479097f, 0.019092f, -0.435746f, 0.601008f, 0.670011f, -0.69619f, 0.717439f, 0.024497f, 0.111113f, -0.08507f, 0.99016f, 0.22331f, 0.00654f, 0.974726f, 0.190097f, 0.154964f, 0.969458f, 0.005271f, 0.189482f, 0.98187f, -0.011752f, 0.246688f, 0.969024f, 0.343906f, -0.722796f, 0.599412f, 0.572489f, -0.567656f, 0.591627f, 0.787436f, -0.256459f, 0.560512f, 0.647097f, -0.306374f, 0.698141f, 0.427528f, -0.499343f, 0.753576f, 0.410926f, -0.911668f, 0.001284f, 0.67152f, -0.740986f, -0.000899f, 0.922026f, -0.38706f, -0.007253f, 0.84691f, -0.531556f, -0.013854f, 0.535924f, -0.844201f, -0.010505f, 0.410926f, -0.911668f, 0.001284f, 0.341188f, -0.722823f, -0.600931f, 0.578664f, -0.561139f, -0.591838f, 0.67152f, -0.740986f, -0.000899f, 0.784869f, -0.25102f, -0.566542f, 0.922026f, -0.38706f, -0.007253f, 0.642681f, -0.302257f, -0.70399f, 0.84691f, -0.531556f, -0.013854f, 0.418589f, -0.500042f, -0.758117f, 0.535924f, -0.844201f, -0.010505f, 0.115806f, -0.079139f, -0.990114f, 0.232811f, 0.012565f, -0.972441f, 0.206662f, 0.153601f, -0.96628f, 0.0245f, 0.161443f, -0.986578f, 0.003382f, 0.211115f, -0.977455f, -0.134912f, 0.687491f, -0.713551f, -0.31954f, 0.633073f, -0.705063f, -0.603902f, 0.461442f, -0.649903f, -0.631815f, 0.437169f, -0.640072f, -0.424306f, 0.612706f, -0.66675f, -0.230787f, 0.972982f, -0.006523f, -0.548936f, 0.835863f, -0.001511f, -0.875671f, 0.482806f, 0.009893f, -0.877554f, 0.479097f, 0.019092f, -0.69619f, 0.717439f, 0.024497f, -0.69619f, 0.717439f, 0.024497f, -0.435746f, 0.601008f, 0.670011f, -0.259858f, 0.791937f, 0.552548f, -0.425801f, 0.904753f, 0.010805f, 0.009539f, 0.99972f, -0.021674f, 0.022046f, 0.999756f, 0.001623f, 0.410157f, 0.332912f, -0.849082f, 0.999598f, 0.025875f, 0.011556f, 0.541523f, -0.548619f, -0.637001f, 0.709587f, -0.704552f, 0.009672f, -0.011752f, 0.246688f, 0.969024f, 0.046311f, 0.455223f, 0.889172f, -0.010688f, 0.988794f, 0.1489f, -0.044376f, 0.682946f, -0.72912f, 0.122824f, 0.009233f, -0.992385f, 0.427528f, -0.499343f, 0.753576f, 0.481839f, -0.18044f, 0.85748f, 0.455272f, 0.736752f, 0.499925f, -0.220542f, 0.907193f, -0.358277f, -0.235919f, 0.65725f, -0.715797f, 0.535924f, -0.844201f, -0.010505f, 0.728094f, -0.6853f, -0.015585f, 0.888738f, 0.458112f, -0.016679f, -0.260098f, 0.965582f, 0.0008f, -0.371611f, 0.928378f, -0.004418f, 0.535924f, -0.844201f, -0.010505f, 0.418589f, -0.500042f, -0.758117f, 0.480165f, -0.178362f, -0.858853f, 0.728094f, -0.6853f, -0.015585f, 0.488102f, 0.716802f, -0.497947f, 0.888738f, 0.458112f, -0.016679f, -0.222004f, 0.905399f, 0.361892f, -0.260098f, 0.965582f, 0.0008f, -0.235405f, 0.66318f, 0.710477f, -0.371611f, 0.928378f, -0.004418f, 0.003382f, 0.211115f, -0.977455f, 0.05872f, 0.437702f, -0.8972f, 0.001326f, 0.986459f, -0.164002f, -0.04419f, 0.681675f, 0.730319f, 0.138801f, -0.034188f, 0.98973f, -0.424306f, 0.612706f, -0.66675f, -0.25889f, 0.797206f, -0.54538f, 0.01227f, 0.999739f, 0.019287f, 0.398632f, 0.35489f, 0.845663f, 0.537564f, -0.581398f, 0.610738f, -0.69619f, 0.717439f, 0.024497f, -0.425801f, 0.904753f, 0.010805f, 0.022046f, 0.999756f, 0.001623f, 0.999598f, 0.025875f, 0.011556f, 0.709587f, -0.704552f, 0.009672f, 0.76264f, 0.565035f, 0.314825f, 0.82454f, 0.565804f, 0.000017f, 0.0f, 1.0f, 0.0f, 0.847982f, -0.397998f, 0.350034f, 0.917701f, -0.397272f, 0.000034f, 0.864141f, -0.355261f, 0.356441f, 0.935269f, -0.353939f, 0.000113f, 0.720992f, 0.625625f, 0.297933f, 0.780712f, 0.62489f, 0.000075f, 0.583357f, 0.565165f, 0.583338f, 0.0f, 1.0f, 0.0f, 0.648485f, -0.398726f, 0.648448f, 0.660872f, -0.355894f, 0.660748f, 0.551862f, 0.62529f, 0.55178f, 0.314824f, 0.565051f, 0.762629f, 0.0f, 1.0f, 0.0f, 0.350045f, -0.397976f, 0.847988f, 0.356474f, -0.355199f, 0.864153f, 0.297983f, 0.625515f, 0.721067f, -0.000017f, 0.565804f, 0.82454f, 0.0f, 1.0f, 0.0f, -0.000034f, -0.397272f, 0.917701f, -0.000113f, -0.353939f, 0.935269f, -0.000075f, 0.62489f, 0.780712f, -0.314825f, 0.565035f, 0.76264f, -0.000017f, 0.565804f, 0.82454f, 0.0f, 1.0f, 0.0f, -0.350034f, -0.397998f, 0.847982f, -0.000034f, -0.397272f, 0.917701f, -0.356441f, -0.355261f, 0.864141f, -0.000113f, -0.353939f, 0.935269f, -0.297933f, 0.625625f, 0.720992f, -0.000075f, 0.62489f, 0.780712f, -0.583338f, 0.565165f, 0.583357f, 0.0f, 1.0f, 0.0f, -0.648448f, -0.398726f, 0.648485f, -0.660748f, -0.355894f, 0.660872f, -0.55178f, 0.62529f, 0.551862f, -0.762629f, 0.565051f, 0.314824f, 0.0f, 1.0f, 0.0f, -0.847988f, -0.397976f, 0.350045f, -0.864153f, -0.355199f, 0.356474f, -0.721067f, 0.625515f, 0.297983f, -0.82454f, 0.565804f, -0.000017f, 0.0f, 1.0f, 0.0f, -0.917701f, -0.397272f, -0.000034f, -0.935269f, -0.353939f, -0.000113f, -0.780712f, 0.62489f, -0.000075f, -0.76264f, 0.565035f, -0.314825f, -0.82454f, 0.565804f, -0.000017f, 0.0f, 1.0f, 0.0f, -0.847982f, -0.397998f, -0.350034f, -0.917701f, -0.397272f, -0.000034f, -0.864141f, -0.355261f, -0.356441f, -0.935269f, -0.353939f, -0.000113f, -0.720992f, 0.625625f, -0.297933f, -0.780712f, 0.62489f, -0.000075f, -0.583357f, 0.565165f, -0.583338f, 0.0f, 1.0f, 0.0f, -0.648485f, -0.398726f, -0.648448f, -0.660872f, -0.355894f, -0.660748f, -0.551862f, 0.62529f, -0.55178f, -0.314824f, 0.565051f, -0.762629f, 0.0f, 1.0f, 0.0f, -0.350045f, -0.397976f, -0.847988f, -0.356474f, -0.355199f, -0.864153f, -0.297983f, 0.625515f, -0.721067f, 0.000017f, 0.565804f, -0.82454f, 0.0f, 1.0f, 0.0f, 0.000034f, -0.397272f, -0.917701f, 0.000113f, -0.353939f, -0.935269f, 0.000075f, 0.62489f, -0.780712f, 0.314825f, 0.565035f, -0.76264f, 0.000017f, 0.565804f, -0.82454f, 0.0f, 1.0f, 0.0f, 0.350034f, -0.397998f, -0.847982f, 0.000034f, -0.397272f, -0.917701f, 0.356441f, -0.355261f, -0.864141f, 0.000113f, -0.353939f, -0.935269f, 0.297933f, 0.625625f, -0.720992f, 0.000075f, 0.62489f, -0.780712f, 0.583338f, 0.565165f, -0.583357f, 0.0f, 1.0f, 0.0f, 0.648448f, -0.398726f, -0.648485f, 0.660748f, -0.355894f, -0.660872f, 0.55178f, 0.62529f, -0.551862f, 0.762629f, 0.565051f, -0.314824f, 0.0f, 1.0f, 0.0f, 0.847988f, -0.397976f, -0.350045f, 0.864153f, -0.355199f, -0.356474f, 0.721067f, 0.625515f, -0.297983f, 0.82454f, 0.565804f, 0.000017f, 0.0f, 1.0f, 0.0f, 0.917701f, -0.397272f, 0.000034f, 0.935269f, -0.353939f, 0.000113f, 0.780712f, 0.62489f, 0.000075f, 0.780712f, 0.62489f, 0.000075f, 0.720992f, 0.625625f, 0.297933f, 0.217978f, 0.971775f, 0.090216f, 0.236583f, 0.971611f, 0.0f, 0.159589f, 0.984977f, 0.065961f, 0.173084f, 0.984907f, 0.0f, 0.350498f, 0.925311f, 0.14474f, 0.379703f, 0.925108f, 0.0f, 0.48559f, 0.850653f, 0.201474f, 0.526673f, 0.850068f, 0.0f, 0.551862f, 0.62529f, 0.55178f, 0.166631f, 0.971838f, 0.166631f, 0.121908f, 0.985026f, 0.121908f, 0.267668f, 0.925585f, 0.267668f, 0.371315f, 0.851029f, 0.371315f, 0.297983f, 0.625515f, 0.721067f, 0.090216f, 0.971775f, 0.217978f, 0.065961f, 0.984977f, 0.159589f, 0.14474f, 0.925311f, 0.350498f, 0.201475f, 0.850653f, 0.48559f, -0.000075f, 0.62489f, 0.780712f, 0.0f, 0.971611f, 0.236583f, 0.0f, 0.984907f, 0.173084f, 0.0f, 0.925108f, 0.379703f, 0.0f, 0.850068f, 0.526673f, -0.000075f, 0.62489f, 0.780712f, -0.297933f, 0.625625f, 0.720992f, -0.090216f, 0.971775f, 0.217978f, 0.0f, 0.971611f, 0.236583f, -0.065961f, 0.984977f, 0.159589f, 0.0f, 0.984907f, 0.173084f, -0.14474f, 0.925311f, 0.350498f, 0.0f, 0.925108f, 0.379703f, -0.201474f, 0.850653f, 0.48559f, 0.0f, 0.850068f, 0.526673f, -0.55178f, 0.62529f, 0.551862f, -0.166631f, 0.971838f, 0.166631f, -0.121908f, 0.985026f, 0.121908f, -0.267668f, 0.925585f, 0.267668f, -0.371315f, 0.851029f, 0.371315f, -0.721067f, 0.625515f, 0.297983f, -0.217978f, 0.971775f, 0.090216f, -0.159589f, 0.984977f, 0.065961f, -0.350498f, 0.925311f, 0.14474f, -0.48559f, 0.850653f, 0.201475f, -0.780712f, 0.62489f, -0.000075f, -0.236583f, 0.971611f, 0.0f, -0.173084f, 0.984907f, 0.0f, -0.379703f, 0.925108f, 0.0f, -0.526673f, 0.850068f, 0.0f, -0.780712f, 0.62489f, -0.000075f, -0.720992f, 0.625625f, -0.297933f, -0.217978f, 0.971775f, -0.090216f, -0.236583f, 0.971611f, 0.0f, -0.159589f, 0.984977f, -0.065961f, -0.173084f, 0.984907f, 0.0f, -0.350498f, 0.925311f, -0.14474f, -0.379703f, 0.925108f, 0.0f, -0.48559f, 0.850653f, -0.201474f, -0.526673f, 0.850068f, 0.0f, -0.551862f, 0.62529f, -0.55178f, -0.166631f, 0.971838f, -0.166631f, -0.121908f, 0.985026f, -0.121908f, -0.267668f, 0.925585f, -0.267668f, -0.371315f, 0.851029f, -0.371315f, -0.297983f, 0.625515f, -0.721067f, -0.090216f, 0.971775f, -0.217978f, -0.065961f, 0.984977f, -0.159589f, -0.14474f, 0.925311f, -0.350498f, -0.201475f, 0.850653f, -0.48559f, 0.000075f, 0.62489f, -0.780712f, 0.0f, 0.971611f, -0.236583f, 0.0f, 0.984907f, -0.173084f, 0.0f, 0.925108f, -0.379703f, 0.0f, 0.850068f, -0.526673f, 0.000075f, 0.62489f, -0.780712f, 0.297933f, 0.625625f, -0.720992f, 0.090216f, 0.971775f, -0.217978f, 0.0f, 0.971611f, -0.236583f, 0.065961f, 0.984977f, -0.159589f, 0.0f, 0.984907f, -0.173084f, 0.14474f, 0.925311f, -0.350498f, 0.0f, 0.925108f, -0.379703f, 0.201474f, 0.850653f, -0.48559f, 0.0f, 0.850068f, -0.526673f, 0.55178f, 0.62529f, -0.551862f, 0.166631f, 0.971838f, -0.166631f, 0.121908f, 0.985026f, -0.121908f, 0.267668f, 0.925585f, -0.267668f, 0.371315f, 0.851029f, -0.371315f, 0.721067f, 0.625515f, -0.297983f, 0.217978f, 0.971775f, -0.090216f, 0.159589f, 0.984977f, -0.065961f, 0.350498f, 0.925311f, -0.14474f, 0.48559f, 0.850653f, -0.201475f, 0.780712f, 0.62489f, 0.000075f, 0.236583f, 0.971611f, 0.0f, 0.173084f, 0.984907f, 0.0f, 0.379703f, 0.925108f, 0.0f, 0.526673f, 0.850068f, 0.0f};
+
+float uvsTeapot[] =
+    {2.0f, 2.0f, 1.75f, 2.0f, 1.75f, 1.975f, 2.0f, 1.975f, 1.75f, 1.95f, 2.0f, 1.95f, 1.75f, 1.925f, 2.0f, 1.925f, 1.75f, 1.9f, 2.0f, 1.9f, 1.5f, 2.0f, 1.5f, 1.975f, 1.5f, 1.95f, 1.5f, 1.925f, 1.5f, 1.9f, 1.25f, 2.0f, 1.25f, 1.975f, 1.25f, 1.95f, 1.25f, 1.925f, 1.25f, 1.9f, 1.0f, 2.0f, 1.0f, 1.975f, 1.0f, 1.95f, 1.0f, 1.925f, 1.0f, 1.9f, 1.0f, 2.0f, 0.75f, 2.0f, 0.75f, 1.975f, 1.0f, 1.975f, 0.75f, 1.95f, 1.0f, 1.95f, 0.75f, 1.925f, 1.0f, 1.925f, 0.75f, 1.9f, 1.0f, 1.9f, 0.5f, 2.0f, 0.5f, 1.975f, 0.5f, 1.95f, 0.5f, 1.925f, 0.5f, 1.9f, 0.25f, 2.0f, 0.25f, 1.975f, 0.25f, 1.95f, 0.25f, 1.925f, 0.25f, 1.9f, 0.0f, 2.0f, 0.0f, 1.975f, 0.0f, 1.95f, 0.0f, 1.925f, 0.0f, 1.9f, 2.0f, 2.0f, 1.75f, 2.0f, 1.75f, 1.975f, 2.0f, 1.975f, 1.75f, 1.95f, 2.0f, 1.95f, 1.75f, 1.925f, 2.0f, 1.925f, 1.75f, 1.9f, 2.0f, 1.9f, 1.5f, 2.0f, 1.5f, 1.975f, 1.5f, 1.95f, 1.5f, 1.925f, 1.5f, 1.9f, 1.25f, 2.0f, 1.25f, 1.975f, 1.25f, 1.95f, 1.25f, 1.925f, 1.25f, 1.9f, 1.0f, 2.0f, 1.0f, 1.975f, 1.0f, 1.95f, 1.0f, 1.925f, 1.0f, 1.9f, 1.0f, 2.0f, 0.75f, 2.0f, 0.75f, 1.975f, 1.0f, 1.975f, 0.75f, 1.95f, 1.0f, 1.95f, 0.75f, 1.925f, 1.0f, 1.925f, 0.75f, 1.9f, 1.0f, 1.9f, 0.5f, 2.0f, 0.5f, 1.975f, 0.5f, 1.95f, 0.5f, 1.925f, 0.5f, 1.9f, 0.25f, 2.0f, 0.25f, 1.975f, 0.25f, 1.95f, 0.25f, 1.925f, 0.25f, 1.9f, 0.0f, 2.0f, 0.0f, 1.975f, 0.0f, 1.95f, 0.0f, 1.925f, 0.0f, 1.9f, 2.0f, 1.9f, 1.75f, 1.9f, 1.75f, 1.675f, 2.0f, 1.675f, 1.75f, 1.45f, 2.0f, 1.45f, 1.75f, 1.225f, 2.0f, 1.225f, 1.75f, 1.0f, 2.0f, 1.0f, 1.5f, 1.9f, 1.5f, 1.675f, 1.5f, 1.45f, 1.5f, 1.225f, 1.5f, 1.0f, 1.25f, 1.9f, 1.25f, 1.675f, 1.25f, 1.45f, 1.25f, 1.225f, 1.25f, 1.0f, 1.0f, 1.9f, 1.0f, 1.675f, 1.0f, 1.45f, 1.0f, 1.225f, 1.0f, 1.0f, 1.0f, 1.9f, 0.75f, 1.9f, 0.75f, 1.675f, 1.0f, 1.675f, 0.75f, 1.45f, 1.0f, 1.45f, 0.75f, 1.225f, 1.0f, 1.225f, 0.75f, 1.0f, 1.0f, 1.0f, 0.5f, 1.9f, 0.5f, 1.675f, 0.5f, 1.45f, 0.5f, 1.225f, 0.5f, 1.0f, 0.25f, 1.9f, 0.25f, 1.675f, 0.25f, 1.45f, 0.25f, 1.225f, 0.25f, 1.0f, 0.0f, 1.9f, 0.0f, 1.675f, 0.0f, 1.45f, 0.0f, 1.225f, 0.0f, 1.0f, 2.0f, 1.9f, 1.75f, 1.9f, 1.75f, 1.675f, 2.0f, 1.675f, 1.75f, 1.45f, 2.0f, 1.45f, 1.75f, 1.225f, 2.0f, 1.225f, 1.75f, 1.0f, 2.0f, 1.0f, 1.5f, 1.9f, 1.5f, 1.675f, 1.5f, 1.45f, 1.5f, 1.225f, 1.5f, 1.0f, 1.25f, 1.9f, 1.25f, 1.675f, 1.25f, 1.45f, 1.25f, 1.225f, 1.25f, 1.0f, 1.0f, 1.9f, 1.0f, 1.675f, 1.0f, 1.45f, 1.0f, 1.225f, 1.0f, 1.0f, 1.0f, 1.9f, 0.75f, 1.9f, 0.75f, 1.675f, 1.0f, 1.675f, 0.75f, 1.45f, 1.0f, 1.45f, 0.75f, 1.225f, 1.0f, 1.225f, 0.75f, 1.0f, 1.0f, 1.0f, 0.5f, 1.9f, 0.5f, 1.675f, 0.5f, 1.45f, 0.5f, 1.225f, 0.5f, 1.0f, 0.25f, 1.9f, 0.25f, 1.675f, 0.25f, 1.45f, 0.25f, 1.225f, 0.25f, 1.0f, 0.0f, 1.9f, 0.0f, 1.675f, 0.0f, 1.45f, 0.0f, 1.225f, 0.0f, 1.0f, 2.0f, 1.0f, 1.75f, 1.0f, 1.75f, 0.85f, 2.0f, 0.85f, 1.75f, 0.7f, 2.0f, 0.7f, 1.75f, 0.55f, 2.0f, 0.55f, 1.75f, 0.4f, 2.0f, 0.4f, 1.5f, 1.0f, 1.5f, 0.85f, 1.5f, 0.7f, 1.5f, 0.55f, 1.5f, 0.4f, 1.25f, 1.0f, 1.25f, 0.85f, 1.25f, 0.7f, 1.25f, 0.55f, 1.25f, 0.4f, 1.0f, 1.0f, 1.0f, 0.85f, 1.0f, 0.7f, 1.0f, 0.55f, 1.0f, 0.4f, 1.0f, 1.0f, 0.75f, 1.0f, 0.75f, 0.85f, 1.0f, 0.85f, 0.75f, 0.7f, 1.0f, 0.7f, 0.75f, 0.55f, 1.0f, 0.55f, 0.75f, 0.4f, 1.0f, 0.4f, 0.5f, 1.0f, 0.5f, 0.85f, 0.5f, 0.7f, 0.5f, 0.55f, 0.5f, 0.4f, 0.25f, 1.0f, 0.25f, 0.85f, 0.25f, 0.7f, 0.25f, 0.55f, 0.25f, 0.4f, 0.0f, 1.0f, 0.0f, 0.85f, 0.0f, 0.7f, 0.0f, 0.55f, 0.0f, 0.4f, 2.0f, 1.0f, 1.75f, 1.0f, 1.75f, 0.85f, 2.0f, 0.85f, 1.75f, 0.7f, 2.0f, 0.7f, 1.75f, 0.55f, 2.0f, 0.55f, 1.75f, 0.4f, 2.0f, 0.4f, 1.5f, 1.0f, 1.5f, 0.85f, 1.5f, 0.7f, 1.5f, 0.55f, 1.5f, 0.4f, 1.25f, 1.0f, 1.25f, 0.85f, 1.25f, 0.7f, 1.25f, 0.55f, 1.25f, 0.4f, 1.0f, 1.0f, 1.0f, 0.85f, 1.0f, 0.7f, 1.0f, 0.55f, 1.0f, 0.4f, 1.0f, 1.0f, 0.75f, 1.0f, 0.75f, 0.85f, 1.0f, 0.85f, 0.75f, 0.7f, 1.0f, 0.7f, 0.75f, 0.55f, 1.0f, 0.55f, 0.75f, 0.4f, 1.0f, 0.4f, 0.5f, 1.0f, 0.5f, 0.85f, 0.5f, 0.7f, 0.5f, 0.55f, 0.5f, 0.4f, 0.25f, 1.0f, 0.25f, 0.85f, 0.25f, 0.7f, 0.25f, 0.55f, 0.25f, 0.4f, 0.0f, 1.0f, 0.0f, 0.85f, 0.0f, 0.7f, 0.0f, 0.55f, 0.0f, 0.4f, 2.0f, 0.4f, 1.75f, 0.4f, 1.75f, 0.3f, 2.0f, 0.3f, 1.75f, 0.2f, 2.0f, 0.2f, 1.75f, 0.1f, 2.0f, 0.1f, 1.75f, 0.0f, 1.5f, 0.4f, 1.5f, 0.3f, 1.5f, 0.2f, 1.5f, 0.1f, 1.5f, 0.0f, 1.25f, 0.4f, 1.25f, 0.3f, 1.25f, 0.2f, 1.25f, 0.1f, 1.25f, 0.0f, 1.0f, 0.4f, 1.0f, 0.3f, 1.0f, 0.2f, 1.0f, 0.1f, 1.0f, 0.0f, 1.0f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f, 1.0f, 0.3f, 0.75f, 0.2f, 1.0f, 0.2f, 0.75f, 0.1f, 1.0f, 0.1f, 0.75f, 0.0f, 0.5f, 0.4f, 0.5f, 0.3f, 0.5f, 0.2f, 0.5f, 0.1f, 0.5f, 0.0f, 0.25f, 0.4f, 0.25f, 0.3f, 0.25f, 0.2f, 0.25f, 0.1f, 0.25f, 0.0f, 0.0f, 0.4f, 0.0f, 0.3f, 0.0f, 0.2f, 0.0f, 0.1f, 0.0f, 0.0f, 2.0f, 0.4f, 1.75f, 0.4f, 1.75f, 0.3f, 2.0f, 0.3f, 1.75f, 0.2f, 2.0f, 0.2f, 1.75f, 0.1f, 2.0f, 0.1f, 1.75f, 0.0f, 1.5f, 0.4f, 1.5f, 0.3f, 1.5f, 0.2f, 1.5f, 0.1f, 1.5f, 0.0f, 1.25f, 0.4f, 1.25f, 0.3f, 1.25f, 0.2f, 1.25f, 0.1f, 1.25f, 0.0f, 1.0f, 0.4f, 1.0f, 0.3f, 1.0f, 0.2f, 1.0f, 0.1f, 1.0f, 0.0f, 1.0f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f, 1.0f, 0.3f, 0.75f, 0.2f, 1.0f, 0.2f, 0.75f, 0.1f, 1.0f, 0.1f, 0.75f, 0.0f, 0.5f, 0.4f, 0.5f, 0.3f, 0.5f, 0.2f, 0.5f, 0.1f, 0.5f, 0.0f, 0.25f, 0.4f, 0.25f, 0.3f, 0.25f, 0.2f, 0.25f, 0.1f, 0.25f, 0.0f, 0.0f, 0.4f, 0.0f, 0.3f, 0.0f, 0.2f, 0.0f, 0.1f, 0.0f, 0.0f, 1.0f, 1.0f, 0.875f, 1.0f, 0.875f, 0.875f, 1.0f, 0.875f, 0.875f, 0.75f, 1.0f, 0.75f, 0.875f, 0.625f, 1.0f, 0.625f, 0.875f, 0.5f, 1.0f, 0.5f, 0.75f, 1.0f, 0.75f, 0.875f, 0.75f, 0.75f, 0.75f, 0.625f, 0.75f, 0.5f, 0.625f, 1.0f, 0.625f, 0.875f, 0.625f, 0.75f, 0.625f, 0.625f, 0.625f, 0.5f, 0.5f, 1.0f, 0.5f, 0.875f, 0.5f, 0.75f, 0.5f, 0.625f, 0.5f, 0.5f, 0.5f, 1.0f, 0.375f, 1.0f, 0.375f, 0.875f, 0.5f, 0.875f, 0.375f, 0.75f, 0.5f, 0.75f, 0.375f, 0.625f, 0.5f, 0.625f, 0.375f, 0.5f, 0.5f, 0.5f, 0.25f, 1.0f, 0.25f, 0.875f, 0.25f, 0.75f, 0.25f, 0.625f, 0.25f, 0.5f, 0.125f, 1.0f, 0.125f, 0.875f, 0.125f, 0.75f, 0.125f, 0.625f, 0.125f, 0.5f, 0.0f, 1.0f, 0.0f, 0.875f, 0.0f, 0.75f, 0.0f, 0.625f, 0.0f, 0.5f, 1.0f, 0.5f, 0.875f, 0.5f, 0.875f, 0.375f, 1.0f, 0.375f, 0.875f, 0.25f, 1.0f, 0.25f, 0.875f, 0.125f, 1.0f, 0.125f, 0.875f, 0.0f, 1.0f, 0.0f, 0.75f, 0.5f, 0.75f, 0.375f, 0.75f, 0.25f, 0.75f, 0.125f, 0.75f, 0.0f, 0.625f, 0.5f, 0.625f, 0.375f, 0.625f, 0.25f, 0.625f, 0.125f, 0.625f, 0.0f, 0.5f, 0.5f, 0.5f, 0.375f, 0.5f, 0.25f, 0.5f, 0.125f, 0.5f, 0.0f, 0.5f, 0.5f, 0.375f, 0.5f, 0.375f, 0.375f, 0.5f, 0.375f, 0.375f, 0.25f, 0.5f, 0.25f, 0.375f, 0.125f, 0.5f, 0.125f, 0.375f, 0.0f, 0.5f, 0.0f, 0.25f, 0.5f, 0.25f, 0.375f, 0.25f, 0.25f, 0.25f, 0.125f, 0.25f, 0.0f, 0.125f, 0.5f, 0.125f, 0.375f, 0.125f, 0.25f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.5f, 0.0f, 0.375f, 0.0f, 0.25f, 0.0f, 0.125f, 0.0f, 0.0f, 0.5f, 0.0f, 0.625f, 0.0f, 0.625f, 0.225f, 0.5f, 0.225f, 0.625f, 0.45f, 0.5f, 0.45f, 0.625f, 0.675f, 0.5f, 0.675f, 0.625f, 0.9f, 0.5f, 0.9f, 0.75f, 0.0f, 0.75f, 0.225f, 0.75f, 0.45f, 0.75f, 0.675f, 0.75f, 0.9f, 0.875f, 0.0f, 0.875f, 0.225f, 0.875f, 0.45f, 0.875f, 0.675f, 0.875f, 0.9f, 1.0f, 0.0f, 1.0f, 0.225f, 1.0f, 0.45f, 1.0f, 0.675f, 1.0f, 0.9f, 0.0f, 0.0f, 0.125f, 0.0f, 0.125f, 0.225f, 0.0f, 0.225f, 0.125f, 0.45f, 0.0f, 0.45f, 0.125f, 0.675f, 0.0f, 0.675f, 0.125f, 0.9f, 0.0f, 0.9f, 0.25f, 0.0f, 0.25f, 0.225f, 0.25f, 0.45f, 0.25f, 0.675f, 0.25f, 0.9f, 0.375f, 0.0f, 0.375f, 0.225f, 0.375f, 0.45f, 0.375f, 0.675f, 0.375f, 0.9f, 0.5f, 0.0f, 0.5f, 0.225f, 0.5f, 0.45f, 0.5f, 0.675f, 0.5f, 0.9f, 0.5f, 0.9f, 0.625f, 0.9f, 0.625f, 0.925f, 0.5f, 0.925f, 0.625f, 0.95f, 0.5f, 0.95f, 0.625f, 0.975f, 0.5f, 0.975f, 0.625f, 1.0f, 0.5f, 1.0f, 0.75f, 0.9f, 0.75f, 0.925f, 0.75f, 0.95f, 0.75f, 0.975f, 0.75f, 1.0f, 0.875f, 0.9f, 0.875f, 0.925f, 0.875f, 0.95f, 0.875f, 0.975f, 0.875f, 1.0f, 1.0f, 0.9f, 1.0f, 0.925f, 1.0f, 0.95f, 1.0f, 0.975f, 1.0f, 1.0f, 0.0f, 0.9f, 0.125f, 0.9f, 0.125f, 0.925f, 0.0f, 0.925f, 0.125f, 0.95f, 0.0f, 0.95f, 0.125f, 0.975f, 0.0f, 0.975f, 0.125f, 1.0f, 0.0f, 1.0f, 0.25f, 0.9f, 0.25f, 0.925f, 0.25f, 0.95f, 0.25f, 0.975f, 0.25f, 1.0f, 0.375f, 0.9f, 0.375f, 0.925f, 0.375f, 0.95f, 0.375f, 0.975f, 0.375f, 1.0f, 0.5f, 0.9f, 0.5f, 0.925f, 0.5f, 0.95f, 0.5f, 0.975f, 0.5f, 1.0f, 0.875f, 0.75f, 1.0f, 0.75f, 1.0f, 1.0f, 0.875f, 0.5f, 1.0f, 0.5f, 0.875f, 0.25f, 1.0f, 0.25f, 0.875f, 0.0f, 1.0f, 0.0f, 0.75f, 0.75f, 0.875f, 1.0f, 0.75f, 0.5f, 0.75f, 0.25f, 0.75f, 0.0f, 0.625f, 0.75f, 0.75f, 1.0f, 0.625f, 0.5f, 0.625f, 0.25f, 0.625f, 0.0f, 0.5f, 0.75f, 0.625f, 1.0f, 0.5f, 0.5f, 0.5f, 0.25f, 0.5f, 0.0f, 0.375f, 0.75f, 0.5f, 0.75f, 0.5f, 1.0f, 0.375f, 0.5f, 0.5f, 0.5f, 0.375f, 0.25f, 0.5f, 0.25f, 0.375f, 0.0f, 0.5f, 0.0f, 0.25f, 0.75f, 0.375f, 1.0f, 0.25f, 0.5f, 0.25f, 0.25f, 0.25f, 0.0f, 0.125f, 0.75f, 0.25f, 1.0f, 0.125f, 0.5f, 0.125f, 0.25f, 0.125f, 0.0f, 0.0f, 0.75f, 0.125f, 1.0f, 0.0f, 0.5f, 0.0f, 0.25f, 0.0f, 0.0f, 0.875f, 0.75f, 1.0f, 0.75f, 1.0f, 1.0f, 0.875f, 0.5f, 1.0f, 0.5f, 0.875f, 0.25f, 1.0f, 0.25f, 0.875f, 0.0f, 1.0f, 0.0f, 0.75f, 0.75f, 0.875f, 1.0f, 0.75f, 0.5f, 0.75f, 0.25f, 0.75f, 0.0f, 0.625f, 0.75f, 0.75f, 1.0f, 0.625f, 0.5f, 0.625f, 0.25f, 0.625f, 0.0f, 0.5f, 0.75f, 0.625f, 1.0f, 0.5f, 0.5f, 0.5f, 0.25f, 0.5f, 0.0f, 0.375f, 0.75f, 0.5f, 0.75f, 0.5f, 1.0f, 0.375f, 0.5f, 0.5f, 0.5f, 0.375f, 0.25f, 0.5f, 0.25f, 0.375f, 0.0f, 0.5f, 0.0f, 0.25f, 0.75f, 0.375f, 1.0f, 0.25f, 0.5f, 0.25f, 0.25f, 0.25f, 0.0f, 0.125f, 0.75f, 0.25f, 1.0f, 0.125f, 0.5f, 0.125f, 0.25f, 0.125f, 0.0f, 0.0f, 0.75f, 0.125f, 1.0f, 0.0f, 0.5f, 0.0f, 0.25f, 0.0f, 0.0f, 1.0f, 1.0f, 0.875f, 1.0f, 0.875f, 0.75f, 1.0f, 0.75f, 0.875f, 0.5f, 1.0f, 0.5f, 0.875f, 0.25f, 1.0f, 0.25f, 0.875f, 0.0f, 1.0f, 0.0f, 0.75f, 1.0f, 0.75f, 0.75f, 0.75f, 0.5f, 0.75f, 0.25f, 0.75f, 0.0f, 0.625f, 1.0f, 0.625f, 0.75f, 0.625f, 0.5f, 0.625f, 0.25f, 0.625f, 0.0f, 0.5f, 1.0f, 0.5f, 0.75f, 0.5f, 0.5f, 0.5f, 0.25f, 0.5f, 0.0f, 0.5f, 1.0f, 0.375f, 1.0f, 0.375f, 0.75f, 0.5f, 0.75f, 0.375f, 0.5f, 0.5f, 0.5f, 0.375f, 0.25f, 0.5f, 0.25f, 0.375f, 0.0f, 0.5f, 0.0f, 0.25f, 1.0f, 0.25f, 0.75f, 0.25f, 0.5f, 0.25f, 0.25f, 0.25f, 0.0f, 0.125f, 1.0f, 0.125f, 0.75f, 0.125f, 0.5f, 0.125f, 0.25f, 0.125f, 0.0f, 0.0f, 1.0f, 0.0f, 0.75f, 0.0f, 0.5f, 0.0f, 0.25f, 0.0f, 0.0f, 1.0f, 1.0f, 0.875f, 1.0f, 0.875f, 0.75f, 1.0f, 0.75f, 0.875f, 0.5f, 1.0f, 0.5f, 0.875f, 0.25f, 1.0f, 0.25f, 0.875f, 0.0f, 1.0f, 0.0f, 0.75f, 1.0f, 0.75f, 0.75f, 0.75f, 0.5f, 0.75f, 0.25f, 0.75f, 0.0f, 0.625f, 1.0f, 0.625f, 0.75f, 0.625f, 0.5f, 0.625f, 0.25f, 0.625f, 0.0f, 0.5f, 1.0f, 0.5f, 0.75f, 0.5f, 0.5f, 0.5f, 0.25f, 0.5f, 0.0f, 0.5f, 1.0f, 0.375f, 1.0f, 0.375f, 0.75f, 0.5f, 0.75f, 0.375f, 0.5f, 0.5f, 0.5f, 0.375f, 0.25f, 0.5f, 0.25f, 0.375f, 0.0f, 0.5f, 0.0f, 0.25f, 1.0f, 0.25f, 0.75f, 0.25f, 0.5f, 0.25f, 0.25f, 0.25f, 0.0f, 0.125f, 1.0f, 0.125f, 0.75f, 0.125f, 0.5f, 0.125f, 0.25f, 0.125f, 0.0f, 0.0f, 1.0f, 0.0f, 0.75f, 0.0f, 0.5f, 0.0f, 0.25f, 0.0f, 0.0f};
+
+uint16_t indicesTeapot[] =
+    {0, 1, 2, 2, 3, 0, 3, 2, 4, 4, 5, 3, 5, 4, 6, 6, 7, 5, 7, 6, 8, 8, 9, 7, 1, 10, 11, 11, 2, 1, 2, 11, 12, 12, 4, 2, 4, 12, 13, 13, 6, 4, 6, 13, 14, 14, 8, 6, 10, 15, 16, 16, 11, 10, 11, 16, 17, 17, 12, 11, 12, 17, 18, 18, 13, 12, 13, 18, 19, 19, 14, 13, 15, 20, 21, 21, 16, 15, 16, 21, 22, 22, 17, 16, 17, 22, 23, 23, 18, 17, 18, 23, 24, 24, 19, 18, 25, 26, 27, 27, 28, 25, 28, 27, 29, 29, 30, 28, 30, 29, 31, 31, 32, 30, 32, 31, 33, 33, 34, 32, 26, 35, 36, 36, 27, 26, 27, 36, 37, 37, 29, 27, 29, 37, 38, 38, 31, 29, 31, 38, 39, 39, 33, 31, 35, 40, 41, 41, 36, 35, 36, 41, 42, 42, 37, 36, 37, 42, 43, 43, 38, 37, 38, 43, 44, 44, 39, 38, 40, 45, 46, 46, 41, 40, 41, 46, 47, 47, 42, 41, 42, 47, 48, 48, 43, 42, 43, 48, 49, 49, 44, 43, 50, 51, 52, 52, 53, 50, 53, 52, 54, 54, 55, 53, 55, 54, 56, 56, 57, 55, 57, 56, 58, 58, 59, 57, 51, 60, 61, 61, 52, 51, 52, 61, 62, 62, 54, 52, 54, 62, 63, 63, 56, 54, 56, 63, 64, 64, 58, 56, 60, 65, 66, 66, 61, 60, 61, 66, 67, 67, 62, 61, 62, 67, 68, 68, 63, 62, 63, 68, 69, 69, 64, 63, 65, 70, 71, 71, 66, 65, 66, 71, 72, 72, 67, 66, 67, 72, 73, 73, 68, 67, 68, 73, 74, 74, 69, 68, 75, 76, 77, 77, 78, 75, 78, 77, 79, 79, 80, 78, 80, 79, 81, 81, 82, 80, 82, 81, 83, 83, 84, 82, 76, 85, 86, 86, 77, 76, 77, 86, 87, 87, 79, 77, 79, 87, 88, 88, 81, 79, 81, 88, 89, 89, 83, 81, 85, 90, 91, 91, 86, 85, 86, 91, 92, 92, 87, 86, 87, 92, 93, 93, 88, 87, 88, 93, 94, 94, 89, 88, 90, 95, 96, 96, 91, 90, 91, 96, 97, 97, 92, 91, 92, 97, 98, 98, 93, 92, 93, 98, 99, 99, 94, 93, 100, 101, 102, 102, 103, 100, 103, 102, 104, 104, 105, 103, 105, 104, 106, 106, 107, 105, 107, 106, 108, 108, 109, 107, 101, 110, 111, 111, 102, 101, 102, 111, 112, 112, 104, 102, 104, 112, 113, 113, 106, 104, 106, 113, 114, 114, 108, 106, 110, 115, 116, 116, 111, 110, 111, 116, 117, 117, 112, 111, 112, 117, 118, 118, 113, 112, 113, 118, 119, 119, 114, 113, 115, 120, 121, 121, 116, 115, 116, 121, 122, 122, 117, 116, 117, 122, 123, 123, 118, 117, 118, 123, 124, 124, 119, 118, 125, 126, 127, 127, 128, 125, 128, 127, 129, 129, 130, 128, 130, 129, 131, 131, 132, 130, 132, 131, 133, 133, 134, 132, 126, 135, 136, 136, 127, 126, 127, 136, 137, 137, 129, 127, 129, 137, 138, 138, 131, 129, 131, 138, 139, 139, 133, 131, 135, 140, 141, 141, 136, 135, 136, 141, 142, 142, 137, 136, 137, 142, 143, 143, 138, 137, 138, 143, 144, 144, 139, 138, 140, 145, 146, 146, 141, 140, 141, 146, 147, 147, 142, 141, 142, 147, 148, 148, 143, 142, 143, 148, 149, 149, 144, 143, 150, 151, 152, 152, 153, 150, 153, 152, 154, 154, 155, 153, 155, 154, 156, 156, 157, 155, 157, 156, 158, 158, 159, 157, 151, 160, 161, 161, 152, 151, 152, 161, 162, 162, 154, 152, 154, 162, 163, 163, 156, 154, 156, 163, 164, 164, 158, 156, 160, 165, 166, 166, 161, 160, 161, 166, 167, 167, 162, 161, 162, 167, 168, 168, 163, 162, 163, 168, 169, 169, 164, 163, 165, 170, 171, 171, 166, 165, 166, 171, 172, 172, 167, 166, 167, 172, 173, 173, 168, 167, 168, 173, 174, 174, 169, 168, 175, 176, 177, 177, 178, 175, 178, 177, 179, 179, 180, 178, 180, 179, 181, 181, 182, 180, 182, 181, 183, 183, 184, 182, 176, 185, 186, 186, 177, 176, 177, 186, 187, 187, 179, 177, 179, 187, 188, 188, 181, 179, 181, 188, 189, 189, 183, 181, 185, 190, 191, 191, 186, 185, 186, 191, 192, 192, 187, 186, 187, 192, 193, 193, 188, 187, 188, 193, 194, 194, 189, 188, 190, 195, 196, 196, 191, 190, 191, 196, 197, 197, 192, 191, 192, 197, 198, 198, 193, 192, 193, 198, 199, 199, 194, 193, 200, 201, 202, 202, 203, 200, 203, 202, 204, 204, 205, 203, 205, 204, 206, 206, 207, 205, 207, 206, 208, 208, 209, 207, 201, 210, 211, 211, 202, 201, 202, 211, 212, 212, 204, 202, 204, 212, 213, 213, 206, 204, 206, 213, 214, 214, 208, 206, 210, 215, 216, 216, 211, 210, 211, 216, 217, 217, 212, 211, 212, 217, 218, 218, 213, 212, 213, 218, 219, 219, 214, 213, 215, 220, 221, 221, 216, 215, 216, 221, 222, 222, 217, 216, 217, 222, 223, 223, 218, 217, 218, 223, 224, 224, 219, 218, 225, 226, 227, 227, 228, 225, 228, 227, 229, 229, 230, 228, 230, 229, 231, 231, 232, 230, 232, 231, 233, 233, 234, 232, 226, 235, 236, 236, 227, 226, 227, 236, 237, 237, 229, 227, 229, 237, 238, 238, 231, 229, 231, 238, 239, 239, 233, 231, 235, 240, 241, 241, 236, 235, 236, 241, 242, 242, 237, 236, 237, 242, 243, 243, 238, 237, 238, 243, 244, 244, 239, 238, 240, 245, 246, 246, 241, 240, 241, 246, 247, 247, 242, 241, 242, 247, 248, 248, 243, 242, 243, 248, 249, 249, 244, 243, 250, 251, 252, 252, 253, 250, 253, 252, 254, 254, 255, 253, 255, 254, 256, 256, 257, 255, 257, 256, 258, 258, 259, 257, 251, 260, 261, 261, 252, 251, 252, 261, 262, 262, 254, 252, 254, 262, 263, 263, 256, 254, 256, 263, 264, 264, 258, 256, 260, 265, 266, 266, 261, 260, 261, 266, 267, 267, 262, 261, 262, 267, 268, 268, 263, 262, 263, 268, 269, 269, 264, 263, 265, 270, 271, 271, 266, 265, 266, 271, 272, 272, 267, 266, 267, 272, 273, 273, 268, 267, 268, 273, 274, 274, 269, 268, 275, 276, 277, 277, 278, 275, 278, 277, 279, 279, 280, 278, 280, 279, 281, 281, 282, 280, 282, 281, 283, 283, 284, 282, 276, 285, 286, 286, 277, 276, 277, 286, 287, 287, 279, 277, 279, 287, 288, 288, 281, 279, 281, 288, 289, 289, 283, 281, 285, 290, 291, 291, 286, 285, 286, 291, 292, 292, 287, 286, 287, 292, 293, 293, 288, 287, 288, 293, 294, 294, 289, 288, 290, 295, 296, 296, 291, 290, 291, 296, 297, 297, 292, 291, 292, 297, 298, 298, 293, 292, 293, 298, 299, 299, 294, 293, 300, 301, 302, 302, 303, 300, 303, 302, 304, 304, 305, 303, 305, 304, 306, 306, 307, 305, 307, 306, 308, 301, 309, 310, 310, 302, 301, 302, 310, 311, 311, 304, 302, 304, 311, 312, 312, 306, 304, 306, 312, 313, 309, 314, 315, 315, 310, 309, 310, 315, 316, 316, 311, 310, 311, 316, 317, 317, 312, 311, 312, 317, 318, 314, 319, 320, 320, 315, 314, 315, 320, 321, 321, 316, 315, 316, 321, 322, 322, 317, 316, 317, 322, 323, 324, 325, 326, 326, 327, 324, 327, 326, 328, 328, 329, 327, 329, 328, 330, 330, 331, 329, 331, 330, 332, 325, 333, 334, 334, 326, 325, 326, 334, 335, 335, 328, 326, 328, 335, 336, 336, 330, 328, 330, 336, 337, 333, 338, 339, 339, 334, 333, 334, 339, 340, 340, 335, 334, 335, 340, 341, 341, 336, 335, 336, 341, 342, 338, 343, 344, 344, 339, 338, 339, 344, 345, 345, 340, 339, 340, 345, 346, 346, 341, 340, 341, 346, 347, 348, 349, 350, 350, 351, 348, 351, 350, 352, 352, 353, 351, 353, 352, 354, 354, 355, 353, 355, 354, 356, 349, 357, 358, 358, 350, 349, 350, 358, 359, 359, 352, 350, 352, 359, 360, 360, 354, 352, 354, 360, 361, 357, 362, 363, 363, 358, 357, 358, 363, 364, 364, 359, 358, 359, 364, 365, 365, 360, 359, 360, 365, 366, 362, 367, 368, 368, 363, 362, 363, 368, 369, 369, 364, 363, 364, 369, 370, 370, 365, 364, 365, 370, 371, 372, 373, 374, 374, 375, 372, 375, 374, 376, 376, 377, 375, 377, 376, 378, 378, 379, 377, 379, 378, 380, 373, 381, 382, 382, 374, 373, 374, 382, 383, 383, 376, 374, 376, 383, 384, 384, 378, 376, 378, 384, 385, 381, 386, 387, 387, 382, 381, 382, 387, 388, 388, 383, 382, 383, 388, 389, 389, 384, 383, 384, 389, 390, 386, 391, 392, 392, 387, 386, 387, 392, 393, 393, 388, 387, 388, 393, 394, 394, 389, 388, 389, 394, 395, 396, 397, 398, 398, 399, 396, 399, 398, 400, 400, 401, 399, 401, 400, 402, 402, 403, 401, 403, 402, 404, 404, 405, 403, 397, 406, 407, 407, 398, 397, 398, 407, 408, 408, 400, 398, 400, 408, 409, 409, 402, 400, 402, 409, 410, 410, 404, 402, 406, 411, 412, 412, 407, 406, 407, 412, 413, 413, 408, 407, 408, 413, 414, 414, 409, 408, 409, 414, 415, 415, 410, 409, 411, 416, 417, 417, 412, 411, 412, 417, 418, 418, 413, 412, 413, 418, 419, 419, 414, 413, 414, 419, 420, 420, 415, 414, 421, 422, 423, 423, 424, 421, 424, 423, 425, 425, 426, 424, 426, 425, 427, 427, 428, 426, 428, 427, 429, 429, 430, 428, 422, 431, 432, 432, 423, 422, 423, 432, 433, 433, 425, 423, 425, 433, 434, 434, 427, 425, 427, 434, 435, 435, 429, 427, 431, 436, 437, 437, 432, 431, 432, 437, 438, 438, 433, 432, 433, 438, 439, 439, 434, 433, 434, 439, 440, 440, 435, 434, 436, 441, 442, 442, 437, 436, 437, 442, 443, 443, 438, 437, 438, 443, 444, 444, 439, 438, 439, 444, 445, 445, 440, 439, 446, 447, 448, 448, 449, 446, 449, 448, 450, 450, 451, 449, 451, 450, 452, 452, 453, 451, 453, 452, 454, 454, 455, 453, 447, 456, 457, 457, 448, 447, 448, 457, 458, 458, 450, 448, 450, 458, 459, 459, 452, 450, 452, 459, 460, 460, 454, 452, 456, 461, 462, 462, 457, 456, 457, 462, 463, 463, 458, 457, 458, 463, 464, 464, 459, 458, 459, 464, 465, 465, 460, 459, 461, 466, 467, 467, 462, 461, 462, 467, 468, 468, 463, 462, 463, 468, 469, 469, 464, 463, 464, 469, 470, 470, 465, 464, 471, 472, 473, 473, 474, 471, 474, 473, 475, 475, 476, 474, 476, 475, 477, 477, 478, 476, 478, 477, 479, 479, 480, 478, 472, 481, 482, 482, 473, 472, 473, 482, 483, 483, 475, 473, 475, 483, 484, 484, 477, 475, 477, 484, 485, 485, 479, 477, 481, 486, 487, 487, 482, 481, 482, 487, 488, 488, 483, 482, 483, 488, 489, 489, 484, 483, 484, 489, 490, 490, 485, 484, 486, 491, 492, 492, 487, 486, 487, 492, 493, 493, 488, 487, 488, 493, 494, 494, 489, 488, 489, 494, 495, 495, 490, 489, 496, 497, 498, 498, 499, 496, 499, 498, 500, 500, 501, 499, 501, 500, 502, 502, 503, 501, 503, 502, 504, 504, 505, 503, 497, 506, 507, 507, 498, 497, 498, 507, 508, 508, 500, 498, 500, 508, 509, 509, 502, 500, 502, 509, 510, 510, 504, 502, 506, 511, 512, 512, 507, 506, 507, 512, 513, 513, 508, 507, 508, 513, 514, 514, 509, 508, 509, 514, 515, 515, 510, 509, 511, 516, 517, 517, 512, 511, 512, 517, 518, 518, 513, 512, 513, 518, 519, 519, 514, 513, 514, 519, 520, 520, 515, 514, 521, 522, 523, 523, 524, 521, 524, 523, 525, 525, 526, 524, 526, 525, 527, 527, 528, 526, 528, 527, 529, 529, 530, 528, 522, 531, 532, 532, 523, 522, 523, 532, 533, 533, 525, 523, 525, 533, 534, 534, 527, 525, 527, 534, 535, 535, 529, 527, 531, 536, 537, 537, 532, 531, 532, 537, 538, 538, 533, 532, 533, 538, 539, 539, 534, 533, 534, 539, 540, 540, 535, 534, 536, 541, 542, 542, 537, 536, 537, 542, 543, 543, 538, 537, 538, 543, 544, 544, 539, 538, 539, 544, 545, 545, 540, 539, 546, 547, 548, 548, 549, 546, 549, 548, 550, 550, 551, 549, 551, 550, 552, 552, 553, 551, 553, 552, 554, 554, 555, 553, 547, 556, 557, 557, 548, 547, 548, 557, 558, 558, 550, 548, 550, 558, 559, 559, 552, 550, 552, 559, 560, 560, 554, 552, 556, 561, 562, 562, 557, 556, 557, 562, 563, 563, 558, 557, 558, 563, 564, 564, 559, 558, 559, 564, 565, 565, 560, 559, 561, 566, 567, 567, 562, 561, 562, 567, 568, 568, 563, 562, 563, 568, 569, 569, 564, 563, 564, 569, 570, 570, 565, 564, 571, 572, 573, 573, 574, 571, 574, 573, 575, 575, 576, 574, 576, 575, 577, 577, 578, 576, 578, 577, 579, 579, 580, 578, 572, 581, 582, 582, 573, 572, 573, 582, 583, 583, 575, 573, 575, 583, 584, 584, 577, 575, 577, 584, 585, 585, 579, 577, 581, 586, 587, 587, 582, 581, 582, 587, 588, 588, 583, 582, 583, 588, 589, 589, 584, 583, 584, 589, 590, 590, 585, 584, 586, 591, 592, 592, 587, 586, 587, 592, 593, 593, 588, 587, 588, 593, 594, 594, 589, 588, 589, 594, 595, 595, 590, 589, 596, 597, 598, 597, 596, 599, 599, 600, 597, 600, 599, 601, 601, 602, 600, 602, 601, 603, 603, 604, 602, 605, 596, 606, 596, 605, 607, 607, 599, 596, 599, 607, 608, 608, 601, 599, 601, 608, 609, 609, 603, 601, 610, 605, 611, 605, 610, 612, 612, 607, 605, 607, 612, 613, 613, 608, 607, 608, 613, 614, 614, 609, 608, 615, 610, 616, 610, 615, 617, 617, 612, 610, 612, 617, 618, 618, 613, 612, 613, 618, 619, 619, 614, 613, 620, 621, 622, 621, 620, 623, 623, 624, 621, 624, 623, 625, 625, 626, 624, 626, 625, 627, 627, 628, 626, 629, 620, 630, 620, 629, 631, 631, 623, 620, 623, 631, 632, 632, 625, 623, 625, 632, 633, 633, 627, 625, 634, 629, 635, 629, 634, 636, 636, 631, 629, 631, 636, 637, 637, 632, 631, 632, 637, 638, 638, 633, 632, 639, 634, 640, 634, 639, 641, 641, 636, 634, 636, 641, 642, 642, 637, 636, 637, 642, 643, 643, 638, 637, 644, 645, 646, 645, 644, 647, 647, 648, 645, 648, 647, 649, 649, 650, 648, 650, 649, 651, 651, 652, 650, 653, 644, 654, 644, 653, 655, 655, 647, 644, 647, 655, 656, 656, 649, 647, 649, 656, 657, 657, 651, 649, 658, 653, 659, 653, 658, 660, 660, 655, 653, 655, 660, 661, 661, 656, 655, 656, 661, 662, 662, 657, 656, 663, 658, 664, 658, 663, 665, 665, 660, 658, 660, 665, 666, 666, 661, 660, 661, 666, 667, 667, 662, 661, 668, 669, 670, 669, 668, 671, 671, 672, 669, 672, 671, 673, 673, 674, 672, 674, 673, 675, 675, 676, 674, 677, 668, 678, 668, 677, 679, 679, 671, 668, 671, 679, 680, 680, 673, 671, 673, 680, 681, 681, 675, 673, 682, 677, 683, 677, 682, 684, 684, 679, 677, 679, 684, 685, 685, 680, 679, 680, 685, 686, 686, 681, 680, 687, 682, 688, 682, 687, 689, 689, 684, 682, 684, 689, 690, 690, 685, 684, 685, 690, 691, 691, 686, 685, 692, 693, 694, 694, 695, 692, 695, 694, 696, 696, 697, 695, 697, 696, 698, 698, 699, 697, 699, 698, 700, 700, 701, 699, 693, 702, 703, 703, 694, 693, 694, 703, 704, 704, 696, 694, 696, 704, 705, 705, 698, 696, 698, 705, 706, 706, 700, 698, 702, 707, 708, 708, 703, 702, 703, 708, 709, 709, 704, 703, 704, 709, 710, 710, 705, 704, 705, 710, 711, 711, 706, 705, 707, 712, 713, 713, 708, 707, 708, 713, 714, 714, 709, 708, 709, 714, 715, 715, 710, 709, 710, 715, 716, 716, 711, 710, 717, 718, 719, 719, 720, 717, 720, 719, 721, 721, 722, 720, 722, 721, 723, 723, 724, 722, 724, 723, 725, 725, 726, 724, 718, 727, 728, 728, 719, 718, 719, 728, 729, 729, 721, 719, 721, 729, 730, 730, 723, 721, 723, 730, 731, 731, 725, 723, 727, 732, 733, 733, 728, 727, 728, 733, 734, 734, 729, 728, 729, 734, 735, 735, 730, 729, 730, 735, 736, 736, 731, 730, 732, 737, 738, 738, 733, 732, 733, 738, 739, 739, 734, 733, 734, 739, 740, 740, 735, 734, 735, 740, 741, 741, 736, 735, 742, 743, 744, 744, 745, 742, 745, 744, 746, 746, 747, 745, 747, 746, 748, 748, 749, 747, 749, 748, 750, 750, 751, 749, 743, 752, 753, 753, 744, 743, 744, 753, 754, 754, 746, 744, 746, 754, 755, 755, 748, 746, 748, 755, 756, 756, 750, 748, 752, 757, 758, 758, 753, 752, 753, 758, 759, 759, 754, 753, 754, 759, 760, 760, 755, 754, 755, 760, 761, 761, 756, 755, 757, 762, 763, 763, 758, 757, 758, 763, 764, 764, 759, 758, 759, 764, 765, 765, 760, 759, 760, 765, 766, 766, 761, 760, 767, 768, 769, 769, 770, 767, 770, 769, 771, 771, 772, 770, 772, 771, 773, 773, 774, 772, 774, 773, 775, 775, 776, 774, 768, 777, 778, 778, 769, 768, 769, 778, 779, 779, 771, 769, 771, 779, 780, 780, 773, 771, 773, 780, 781, 781, 775, 773, 777, 782, 783, 783, 778, 777, 778, 783, 784, 784, 779, 778, 779, 784, 785, 785, 780, 779, 780, 785, 786, 786, 781, 780, 782, 787, 788, 788, 783, 782, 783, 788, 789, 789, 784, 783, 784, 789, 790, 790, 785, 784, 785, 790, 791, 791, 786, 785};
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+UnityPluginLoad(IUnityInterfaces* interfaces)
+{
+    s_Meshing = interfaces->Get<IUnityXRMeshInterface>();
+    if (s_Meshing == nullptr)
+        return;
+
+    UnityLifecycleProvider meshingLifecycleHandler{};
+    meshingLifecycleHandler.Initialize = [](UnitySubsystemHandle handle, void* userData) -> UnitySubsystemErrorCode {
+        UnityXRMeshProvider meshProvider{};
+        meshProvider.GetMeshInfos = [](UnitySubsystemHandle handle, void* userData, UnityXRMeshInfoAllocator* allocator) -> UnitySubsystemErrorCode {
+            auto* meshInfos = s_Meshing->MeshInfoAllocator_Allocate(allocator, 1);
+            return kUnitySubsystemErrorCodeSuccess;
+        };
+        meshProvider.AcquireMesh = [](UnitySubsystemHandle handle, void* userData, const UnityXRMeshId* meshId, UnityXRMeshDataAllocator* allocator) -> UnitySubsystemErrorCode {
+            int numVerts = sizeof(positionsTeapot) / sizeof(float) / 3;
+            int numIndices = sizeof(indicesTeapot) / sizeof(uint16_t);
+            auto* meshDesc = s_Meshing->MeshDataAllocator_AllocateMesh(allocator, numVerts, numIndices, kUnityXRIndexFormat16Bit, (UnityXRMeshVertexAttributeFlags)(kUnityXRMeshVertexAttributeFlagsNormals | kUnityXRMeshVertexAttributeFlagsUvs), kUnityXRMeshTopologyTriangles);
+            memcpy(meshDesc->positions, positionsTeapot, numVerts * sizeof(float) * 3);
+            memcpy(meshDesc->normals, normalsTeapot, numVerts * sizeof(float) * 3);
+            memcpy(meshDesc->uvs, uvsTeapot, (numVerts * 2) * sizeof(float));
+            memcpy(meshDesc->indices16, indicesTeapot, numIndices * sizeof(uint16_t));
+            return kUnitySubsystemErrorCodeSuccess;
+        };
+        meshProvider.ReleaseMesh = [](UnitySubsystemHandle handle, void* userData, const UnityXRMeshId* meshId, const UnityXRMeshDescriptor* mesh, void* pluginData) -> UnitySubsystemErrorCode {
+            return kUnitySubsystemErrorCodeSuccess;
+        };
+        meshProvider.SetMeshDensity = [](UnitySubsystemHandle handle, void* userData, float density) -> UnitySubsystemErrorCode {
+            return kUnitySubsystemErrorCodeSuccess;
+        };
+        meshProvider.SetBoundingVolume = [](UnitySubsystemHandle handle, void* userData, const UnityXRBoundingVolume* boundingVolume) -> UnitySubsystemErrorCode {
+            return kUnitySubsystemErrorCodeSuccess;
+        };
+        s_Meshing->RegisterMeshProvider(handle, &meshProvider);
+        return kUnitySubsystemErrorCodeSuccess;
+    };
+    meshingLifecycleHandler.Start = [](UnitySubsystemHandle handle, void* userData) -> UnitySubsystemErrorCode {
+        return kUnitySubsystemErrorCodeSuccess;
+    };
+    meshingLifecycleHandler.Stop = [](UnitySubsystemHandle handle, void* userData) -> void {
+
+    };
+    meshingLifecycleHandler.Shutdown = [](UnitySubsystemHandle handle, void* userData) -> void {
+
+    };
+
+    s_Meshing->RegisterLifecycleProvider("OpenXR Extension Sample", "Sample Meshing", &meshingLifecycleHandler);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+UnityPluginUnload()
+{
+}